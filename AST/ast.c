@@ -1,4 +1,5 @@
 #include "ast.h"
+#include "./../Relatorio/time_report.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -6,6 +7,78 @@
 // Declaração e Inicialização da Raiz Global
 AST_Node* root_ast = NULL;
 
+// Mensagens e erros da compilação (ver ast.h)
+FILE* compile_log = NULL;
+jmp_buf* compile_error_jump = NULL;
+
+// Último nó alocado: início da lista percorrida por ast_free_all
+static AST_Node* allocated_nodes = NULL;
+
+// Lexemas copiados pelo analisador léxico, liberados com os nós
+static char** lexemes = NULL;
+static int num_lexemes = 0;
+static int lexemes_capacity = 0;
+
+/*
+    * Função: compile_abort
+    * -------------------------------
+    * Interrompe a compilação depois de um erro léxico, sintático, semântico ou
+    * interno. O status chega ao setjmp da biblioteca ou vira o código de saída.
+*/
+_Noreturn void compile_abort(int status) {
+    if (compile_error_jump != NULL) {
+        longjmp(*compile_error_jump, status != 0 ? status : 1);
+    }
+    exit(status);
+}
+
+/*
+    * Função: ast_copy_lexeme
+    * -------------------------------
+    * Duplica o texto do token e guarda o ponteiro para liberá-lo depois.
+*/
+char* ast_copy_lexeme(const char* text) {
+    if (num_lexemes == lexemes_capacity) {
+        lexemes_capacity = lexemes_capacity ? lexemes_capacity * 2 : 256;
+        lexemes = (char**)realloc(lexemes, sizeof(char*) * lexemes_capacity);
+        if (lexemes == NULL) {
+            perror("Erro de alocação de memória para os lexemas");
+            exit(EXIT_FAILURE);
+        }
+    }
+    char* copy = strdup(text);
+    if (copy == NULL) {
+        perror("Erro ao duplicar string (strdup)");
+        exit(EXIT_FAILURE);
+    }
+    lexemes[num_lexemes++] = copy;
+    return copy;
+}
+
+/*
+    * Função: ast_free_all
+    * -------------------------------
+    * Libera os nós e os lexemas de todas as ASTs construídas até aqui.
+*/
+void ast_free_all(void) {
+    AST_Node* node = allocated_nodes;
+    while (node != NULL) {
+        AST_Node* next = node->alloc_next;
+        free(node->value);
+        free(node);
+        node = next;
+    }
+    allocated_nodes = NULL;
+    root_ast = NULL;
+
+    for (int i = 0; i < num_lexemes; i++) {
+        free(lexemes[i]);
+    }
+    free(lexemes);
+    lexemes = NULL;
+    num_lexemes = lexemes_capacity = 0;
+}
+
 
 // IMPLEMENTAÇÃO DAS FUNÇÕES DE CRIAÇÃO DE NÓS DA AST
 
@@ -25,6 +98,10 @@ AST_Node* new_ast_node(AST_NodeKind kind, int lineno) {
     // Inicializa os campos básicos
     node->kind = kind;
     node->lineno = lineno;
+
+    node->alloc_next = allocated_nodes;
+    allocated_nodes = node;
+    time_counters.ast_nodes++;
     
     return node;
 }
@@ -39,7 +116,6 @@ AST_Node* new_ast_leaf(AST_NodeKind kind, char* value, int lineno) {
         node->value = strdup(value);
         if (node->value == NULL) {
             perror("Erro ao duplicar string (strdup)");
-            free(node);
             exit(EXIT_FAILURE);
         }
     }
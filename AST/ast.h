@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <setjmp.h>
 
 // Definição dos Tipos de Nós da AST (Node Kind)
 typedef enum {
@@ -61,12 +62,43 @@ typedef struct AST_Node {
     struct AST_Node *next;
 
     int data_type;
+
+    struct AST_Node *alloc_next; // Encadeia todos os nós alocados (ast_free_all)
 } AST_Node;
 
 
 // Variável Global para a Raiz da AST
 extern AST_Node* root_ast; 
 
+// Destino das mensagens da compilação. NULL usa stdout e stderr; a biblioteca
+// (Biblioteca/goianinha.c) aponta para um buffer em memória durante gn_compile.
+extern FILE* compile_log;
+#define COMPILE_OUT (compile_log ? compile_log : stdout)
+#define COMPILE_ERR (compile_log ? compile_log : stderr)
+
+// Ponto de retorno dos erros da compilação. NULL encerra o processo.
+extern jmp_buf* compile_error_jump;
+
+/**
+ * Encerra a compilação atual após um erro já relatado. Sem compile_error_jump
+ * chama exit(status); com ele, volta para o setjmp de quem compila (a
+ * biblioteca) com o status, sem terminar o processo.
+ */
+_Noreturn void compile_abort(int status);
+
+/**
+ * Copia o lexema de um token (yylval.text). A cópia vive até ast_free_all,
+ * junto com os nós que a usam.
+ */
+char* ast_copy_lexeme(const char* text);
+
+/**
+ * Libera todos os nós criados desde a última chamada (e os lexemas copiados)
+ * e zera root_ast. Os nós formam um DAG (tipos compartilhados), então a
+ * liberação percorre a lista de alocação em vez da árvore.
+ */
+void ast_free_all(void);
+
 // Funções de Criação de Nós
 
 /**
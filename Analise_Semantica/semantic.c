@@ -41,8 +41,8 @@ int current_func_type = VOID_T;
 
 // Função para retornar o erro semântico e terminar a compilação
 void semantic_error(int line, const char* message) {
-    fprintf(stderr, "\nERRO SEMÂNTICO (Linha %d): %s\n\n", line, message);
-    exit(EXIT_FAILURE); // Termina a compilação após o primeiro erro grave
+    fprintf(COMPILE_ERR, "\nERRO SEMÂNTICO (Linha %d): %s\n\n", line, message);
+    compile_abort(EXIT_FAILURE); // Termina a compilação após o primeiro erro grave
 }
 
 // Mapeia o nó do Tipo da AST para o inteiro de DataType
@@ -90,6 +90,7 @@ int check_and_get_type(SymbolTableRef symtab, AST_Node* node) {
 
             // Anexando o tipo encontrado
             node->data_type = sym_get_data_type(symbol);
+            sym_free_ref(symbol);
             
             return node->data_type;
             
@@ -173,6 +174,7 @@ int check_and_get_type(SymbolTableRef symtab, AST_Node* node) {
                 }
 
                 int id_type = sym_get_data_type(id_symbol);
+                sym_free_ref(id_symbol);
                 
                 // ** Checando a Expressão ou outra Atribuição **
                 int expr_type = check_and_get_type(symtab, node->child2);
@@ -201,6 +203,9 @@ int check_and_get_type(SymbolTableRef symtab, AST_Node* node) {
                     semantic_error(node->lineno, msg);
                     return TYPE_ERROR;
                 }
+                int formal_count = sym_get_num_params(func_symbol);    // Contando os parâmetros formais
+                int return_type = sym_get_data_type(func_symbol);
+                sym_free_ref(func_symbol);
 
                 // Obtendo a declaração completa na AST (Para pegar a lista de Parâmetros Formais)
                 AST_Node* func_decl_node = find_function_declaration(root_ast, func_name);
@@ -239,9 +244,6 @@ int check_and_get_type(SymbolTableRef symtab, AST_Node* node) {
                     index++;
                 }
 
-                // Contando os parâmetros formais
-                int formal_count = sym_get_num_params(func_symbol); 
-                
                 // Contando os argumentos passados
                 int actual_count = count_list_items(actual_args_head);
                 
@@ -255,7 +257,6 @@ int check_and_get_type(SymbolTableRef symtab, AST_Node* node) {
                 }
 
                 // Retorna o tipo de retorno da função
-                int return_type = sym_get_data_type(func_symbol);
                 node->data_type = return_type;
                 return return_type;
             }
@@ -305,7 +306,9 @@ void analyze_node(SymbolTableRef symtab, AST_Node* node, int is_function_body) {
                     char* var_name = current_id_node->value;
                     
                     // CHECAGEM DE REDECLARAÇÃO
-                    if (symtab_lookup_current_scope(symtab, var_name) != NULL) {
+                    SymbolRef existing = symtab_lookup_current_scope(symtab, var_name);
+                    if (existing != NULL) {
+                        sym_free_ref(existing);
                         semantic_error(node->lineno, "Redeclaração de variável no escopo atual.");
                     }
 
@@ -399,6 +402,7 @@ void analyze_node(SymbolTableRef symtab, AST_Node* node, int is_function_body) {
                     break;
                 }
                 int id_type = sym_get_data_type(id_symbol);
+                sym_free_ref(id_symbol);
                 
                 // Expressão
                 int expr_type = check_and_get_type(symtab, node->child2);
@@ -407,8 +411,6 @@ void analyze_node(SymbolTableRef symtab, AST_Node* node, int is_function_body) {
                 if (id_type != expr_type) {
                     semantic_error(node->lineno, "Incompatibilidade de tipos na atribuição.");
                 }
-
-                sym_free_ref(id_symbol);
             }
             break;
             
@@ -487,6 +489,8 @@ AST_Node* find_function_declaration(AST_Node* root, const char* name) {
  * @brief Ponto de entrada para a análise semântica.
  */
 void analyze_ast(SymbolTableRef symtab) {
+    current_frame_offset = 0;       // A biblioteca analisa vários programas no mesmo processo
+    current_func_type = VOID_T;
     if (root_ast != NULL) {
         analyze_node(symtab, root_ast, 0);
     }
@@ -366,6 +366,6 @@ ListExpr: Expr
 %%
 
 void yyerror(const char *s) {
-    fprintf(stderr, "ERRO: %s na linha %d\n\n", s, yylineno);
-    exit(1);
+    fprintf(COMPILE_ERR, "ERRO: %s na linha %d\n\n", s, yylineno);
+    compile_abort(1);
 }
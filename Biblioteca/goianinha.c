@@ -0,0 +1,239 @@
+#define _GNU_SOURCE                 // open_memstream
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <pthread.h>
+#include "goianinha.h"
+#include "./../AST/ast.h"
+#include "./../Tabela_Simbulos/symbolTable.h"
+#include "./../Codigo_Intermediario/ir.h"
+#include "./../Gera_Codigo/mips.h"
+
+// Analisador léxico e sintático (Flex e Bison)
+typedef struct yy_buffer_state* YY_BUFFER_STATE;
+extern YY_BUFFER_STATE yy_scan_bytes(const char* bytes, int length);
+extern int yylex_destroy(void);
+extern int yyparse(void);
+extern int yylineno;
+
+// Fases do compilador
+extern void analyze_ast(SymbolTableRef symtab);
+extern int generate_mips_code_to(FILE* mips_file);
+extern void generate_c_code_to(AST_Node* root, FILE* out);
+extern SymbolTableRef global_symtab;
+
+// O compilador guarda o estado em globais: uma compilação por vez
+static pthread_mutex_t gn_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Flags globais que gn_compile troca pelas opções e restaura ao terminar
+typedef struct {
+    int peephole, schedule, delay_slots;
+    int tail_calls, inline_functions, inline_limit, cse, dce, licm;
+    int profile_generate;
+    const char* profile_use_file;
+} SavedFlags;
+
+/*
+    * Função: gn_options_init
+    * -------------------------------
+    * Padrões iguais aos do executável sem opções.
+*/
+void gn_options_init(gn_options* options) {
+    memset(options, 0, sizeof(*options));
+    options->target = GN_TARGET_MIPS;
+    options->use_ir = 1;
+    options->peephole = 1;
+    options->schedule = 1;
+    options->delay_slots = 0;
+    options->tail_calls = 1;
+    options->inline_functions = 1;
+    options->inline_limit = 15;
+    options->cse = 1;
+    options->dce = 1;
+    options->licm = 1;
+}
+
+/*
+    * Função: apply_options
+    * -------------------------------
+    * Guarda as flags atuais em 'saved' e aplica as opções da chamada. A
+    * otimização guiada por perfil lê e escreve arquivos, então fica desligada.
+*/
+static void apply_options(const gn_options* options, SavedFlags* saved) {
+    saved->peephole = peephole_enabled;
+    saved->schedule = schedule_enabled;
+    saved->delay_slots = delay_slots_enabled;
+    saved->tail_calls = tail_calls_enabled;
+    saved->inline_functions = inline_enabled;
+    saved->inline_limit = inline_threshold;
+    saved->cse = cse_enabled;
+    saved->dce = dce_enabled;
+    saved->licm = licm_enabled;
+    saved->profile_generate = profile_generate;
+    saved->profile_use_file = profile_use_file;
+
+    peephole_enabled = options->peephole;
+    schedule_enabled = options->schedule;
+    delay_slots_enabled = options->delay_slots;
+    tail_calls_enabled = options->tail_calls;
+    inline_enabled = options->inline_functions;
+    inline_threshold = options->inline_limit;
+    cse_enabled = options->cse;
+    dce_enabled = options->dce;
+    licm_enabled = options->licm;
+    profile_generate = 0;
+    profile_use_file = NULL;
+}
+
+static void restore_options(const SavedFlags* saved) {
+    peephole_enabled = saved->peephole;
+    schedule_enabled = saved->schedule;
+    delay_slots_enabled = saved->delay_slots;
+    tail_calls_enabled = saved->tail_calls;
+    inline_enabled = saved->inline_functions;
+    inline_threshold = saved->inline_limit;
+    cse_enabled = saved->cse;
+    dce_enabled = saved->dce;
+    licm_enabled = saved->licm;
+    profile_generate = saved->profile_generate;
+    profile_use_file = saved->profile_use_file;
+}
+
+/*
+    * Função: compile_source
+    * -------------------------------
+    * As fases de compile_file (main.c) sobre o fonte em memória, escrevendo o
+    * código em 'out'. Erros do fonte voltam pelo longjmp de compile_abort e
+    * são tratados por gn_compile.
+*/
+static gn_status compile_source(const gn_options* options, FILE* out, SymbolTableRef* symtab, IrProgram** ir) {
+    if (yyparse() != 0 || root_ast == NULL) {
+        return GN_ERRO_FONTE;
+    }
+
+    *symtab = symtab_create();
+    analyze_ast(*symtab);
+    global_symtab = *symtab;
+
+    if (options->target == GN_TARGET_C) {
+        generate_c_code_to(root_ast, out);
+        return GN_OK;
+    }
+    if (options->target == GN_TARGET_MIPS && !options->use_ir) {
+        return generate_mips_code_to(out) ? GN_OK : GN_ERRO_INTERNO;
+    }
+
+    *ir = ir_generate_program(root_ast);
+    ir_optimize_program(*ir);
+    if (ir_verify_program(*ir) > 0) {
+        fprintf(COMPILE_ERR, "IR invalida. Geracao de codigo abortada.\n");
+        return GN_ERRO_INTERNO;
+    }
+    if (options->target == GN_TARGET_X86_64) {
+        ir_generate_x86_to(*ir, out);
+    } else {
+        ir_generate_mips_to(*ir, out);
+    }
+    return GN_OK;
+}
+
+/*
+    * Função: gn_compile
+    * -------------------------------
+    * Compila o fonte em memória. Mensagens e código vão para buffers de
+    * open_memstream; um erro no fonte interrompe as fases por compile_abort e
+    * libera o que já foi construído (AST, tabela de símbolos, IR e o estado
+    * do Flex) antes de devolver o status.
+*/
+gn_status gn_compile(const char* source, size_t length, const gn_options* options, gn_result* result) {
+    if (result == NULL) return GN_ERRO_ARGUMENTO;
+    memset(result, 0, sizeof(*result));
+    if (source == NULL || length > (size_t)INT_MAX) {
+        result->status = GN_ERRO_ARGUMENTO;
+        return result->status;
+    }
+
+    gn_options defaults;
+    if (options == NULL) {
+        gn_options_init(&defaults);
+        options = &defaults;
+    }
+
+    char* messages = NULL;
+    size_t messages_len = 0;
+    char* output = NULL;
+    size_t output_len = 0;
+    FILE* log = open_memstream(&messages, &messages_len);
+    FILE* out = open_memstream(&output, &output_len);
+    if (log == NULL || out == NULL) {
+        if (log) fclose(log);
+        if (out) fclose(out);
+        free(messages);
+        free(output);
+        result->status = GN_ERRO_INTERNO;
+        return result->status;
+    }
+
+    pthread_mutex_lock(&gn_lock);
+
+    SavedFlags saved;
+    apply_options(options, &saved);
+    compile_log = log;
+
+    // Alteradas entre o setjmp e um possível longjmp: precisam ser volatile
+    SymbolTableRef volatile symtab = NULL;
+    IrProgram* volatile ir = NULL;
+    volatile gn_status status;
+
+    jmp_buf error_jump;
+    compile_error_jump = &error_jump;
+    if (setjmp(error_jump) == 0) {
+        ast_free_all();
+        yylineno = 1;
+        yy_scan_bytes(source, (int)length);
+        status = compile_source(options, out, (SymbolTableRef*)&symtab, (IrProgram**)&ir);
+    } else {
+        status = GN_ERRO_FONTE;
+    }
+    compile_error_jump = NULL;
+
+    yylex_destroy();
+    if (ir != NULL) ir_free_program(ir);
+    if (symtab != NULL) symtab_destroy(symtab);
+    global_symtab = NULL;
+    ast_free_all();
+    mips_list_clear(&text_section);
+
+    compile_log = NULL;
+    restore_options(&saved);
+    pthread_mutex_unlock(&gn_lock);
+
+    fclose(log);
+    fclose(out);
+    if (status != GN_OK) {
+        free(output);
+        output = NULL;
+        output_len = 0;
+    }
+
+    result->status = status;
+    result->output = output;
+    result->output_len = output_len;
+    result->messages = messages;
+    result->messages_len = messages_len;
+    return status;
+}
+
+/*
+    * Função: gn_result_free
+    * -------------------------------
+    * Libera os buffers e zera o resultado (pode ser chamada de novo).
+*/
+void gn_result_free(gn_result* result) {
+    if (result == NULL) return;
+    free(result->output);
+    free(result->messages);
+    memset(result, 0, sizeof(*result));
+}
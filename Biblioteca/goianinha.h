@@ -0,0 +1,91 @@
+#ifndef GOIANINHA_H
+#define GOIANINHA_H
+
+#include <stddef.h>
+
+// libgoianinha: o compilador como biblioteca (libgoianinha.a e libgoianinha.so).
+// Compila um programa que está em memória e devolve o código gerado e as
+// mensagens da compilação em buffers, sem arquivos, sem processos filhos e sem
+// terminar o processo em caso de erro no fonte.
+//
+// Exemplo:
+//   gn_options opcoes;
+//   gn_result resultado;
+//   gn_options_init(&opcoes);
+//   if (gn_compile(fonte, strlen(fonte), &opcoes, &resultado) == GN_OK)
+//       fwrite(resultado.output, 1, resultado.output_len, stdout);
+//   else
+//       fputs(resultado.messages, stderr);
+//   gn_result_free(&resultado);
+//
+// gn_compile pode ser chamada de várias threads ao mesmo tempo. O compilador
+// guarda o seu estado em globais, então as chamadas são serializadas por um
+// mutex interno: é seguro, mas não compila em paralelo (para isso, -j N).
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Arquitetura do código gerado (--target=)
+typedef enum {
+    GN_TARGET_MIPS,                 // Assembly MIPS, o mesmo de output.asm
+    GN_TARGET_X86_64,               // Assembly x86-64, o mesmo de output.s
+    GN_TARGET_C,                    // Unidade de tradução C, o mesmo de output.c
+} gn_target;
+
+// Resultado de gn_compile
+typedef enum {
+    GN_OK = 0,                      // Código gerado em output
+    GN_ERRO_FONTE = 1,              // Erro léxico, sintático ou semântico (detalhes em messages)
+    GN_ERRO_INTERNO = 2,            // IR inválida ou falha do próprio compilador
+    GN_ERRO_ARGUMENTO = 3,          // Parâmetros inválidos
+} gn_status;
+
+// Opções da compilação: os mesmos valores padrão da linha de comando
+typedef struct {
+    gn_target target;
+    int use_ir;                     // 0 traduz a AST direto para MIPS (-fno-ir)
+    int peephole;                   // -fno-peephole
+    int schedule;                   // -fno-schedule
+    int delay_slots;                // --delay-slots
+    int tail_calls;                 // -fno-tail-calls
+    int inline_functions;           // -fno-inline
+    int inline_limit;               // -finline-limit=N
+    int cse;                        // -fno-cse
+    int dce;                        // -fno-dce
+    int licm;                       // -fno-licm
+} gn_options;
+
+// Saída da compilação. Os buffers terminam em '\0' e são liberados por gn_result_free.
+typedef struct {
+    gn_status status;
+    char* output;                   // Código gerado (NULL se houve erro)
+    size_t output_len;
+    char* messages;                 // Mensagens que o executável imprimiria (relatórios e erros)
+    size_t messages_len;
+} gn_result;
+
+/**
+ * Preenche as opções com os padrões do executável (MIPS pela IR, com todas as
+ * otimizações habilitadas).
+ */
+void gn_options_init(gn_options* options);
+
+/**
+ * Compila o fonte Goianinha em source[0..length).
+ * @param options Opções; NULL usa os padrões de gn_options_init.
+ * @param result Recebe o código e as mensagens; sempre deve ser liberado com gn_result_free.
+ * @return O mesmo valor de result->status.
+ */
+gn_status gn_compile(const char* source, size_t length, const gn_options* options, gn_result* result);
+
+/**
+ * Libera os buffers do resultado.
+ */
+void gn_result_free(gn_result* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GOIANINHA_H
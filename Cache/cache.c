@@ -0,0 +1,444 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include "cache.h"
+
+#define CACHE_MAGIC "GOIANINHA-CACHE 1"
+
+const char* cache_dir = NULL;
+static char* cache_options = NULL;
+
+// ====================================================================
+// SHA-256 (FIPS 180-4)
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;                // Bytes já processados
+    unsigned char block[64];
+    size_t used;                    // Bytes em 'block'
+} Sha256;
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha256_init(Sha256* sha) {
+    static const uint32_t initial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+    memcpy(sha->state, initial, sizeof(initial));
+    sha->length = 0;
+    sha->used = 0;
+}
+
+static void sha256_block(Sha256* sha, const unsigned char* p) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t)p[i * 4] << 24 | (uint32_t)p[i * 4 + 1] << 16 | (uint32_t)p[i * 4 + 2] << 8 | p[i * 4 + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = sha->state[0], b = sha->state[1], c = sha->state[2], d = sha->state[3];
+    uint32_t e = sha->state[4], f = sha->state[5], g = sha->state[6], h = sha->state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        uint32_t t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    sha->state[0] += a; sha->state[1] += b; sha->state[2] += c; sha->state[3] += d;
+    sha->state[4] += e; sha->state[5] += f; sha->state[6] += g; sha->state[7] += h;
+}
+
+static void sha256_update(Sha256* sha, const void* data, size_t len) {
+    const unsigned char* p = (const unsigned char*)data;
+    sha->length += len;
+    while (len > 0) {
+        size_t n = 64 - sha->used;
+        if (n > len) n = len;
+        memcpy(sha->block + sha->used, p, n);
+        sha->used += n;
+        p += n;
+        len -= n;
+        if (sha->used == 64) {
+            sha256_block(sha, sha->block);
+            sha->used = 0;
+        }
+    }
+}
+
+static void sha256_final(Sha256* sha, char hex[CACHE_KEY_LEN]) {
+    uint64_t bits = sha->length * 8;
+    unsigned char pad = 0x80;
+    sha256_update(sha, &pad, 1);
+    pad = 0;
+    while (sha->used != 56) sha256_update(sha, &pad, 1);
+    unsigned char length[8];
+    for (int i = 0; i < 8; i++) length[i] = (unsigned char)(bits >> (56 - i * 8));
+    sha256_update(sha, length, 8);
+    for (int i = 0; i < 8; i++) {
+        snprintf(hex + i * 8, 9, "%08x", sha->state[i]);
+    }
+}
+
+// ====================================================================
+// Arquivos
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// Lê o arquivo inteiro; o buffer (terminado em '\0') deve ser liberado por quem chama
+static char* read_file(const char* path, size_t* length) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+    char* data = (size >= 0) ? (char*)malloc((size_t)size + 1) : NULL;
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size) {
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+    data[size] = '\0';
+    fclose(file);
+    *length = (size_t)size;
+    return data;
+}
+
+/*
+    * Função: write_atomically
+    * -------------------------------
+    * Escreve em um temporário no mesmo diretório e renomeia por cima do
+    * destino: quem lê vê o arquivo antigo ou o novo inteiro, nunca metade.
+*/
+static int write_atomically(const char* path, const char* const* parts, const size_t* lengths, int nparts) {
+    char tmp[PATH_MAX];
+    snprintf(tmp, sizeof(tmp), "%s.tmp.%ld", path, (long)getpid());
+    FILE* file = fopen(tmp, "wb");
+    if (!file) return 0;
+    int ok = 1;
+    for (int i = 0; i < nparts && ok; i++) {
+        ok = fwrite(parts[i], 1, lengths[i], file) == lengths[i];
+    }
+    if (fclose(file) != 0) ok = 0;
+    if (!ok || rename(tmp, path) != 0) {
+        unlink(tmp);
+        return 0;
+    }
+    return 1;
+}
+
+// Cria o diretório do cache na primeira vez que ele é usado
+static int make_cache_dir(void) {
+    if (mkdir(cache_dir, 0777) == 0 || errno == EEXIST) return 1;
+    fprintf(stderr, "Cache: nao foi possivel criar o diretorio '%s': %s\n", cache_dir, strerror(errno));
+    return 0;
+}
+
+static void entry_path(const char* key, char* path, size_t size) {
+    snprintf(path, size, "%s/%s.gcache", cache_dir, key);
+}
+
+// ====================================================================
+// Estatísticas
+
+typedef struct {
+    long long hits;
+    long long misses;
+    double saved_ms;                // Tempo de compilação evitado pelos acertos
+    double compile_ms;              // Tempo gasto compilando nas falhas
+} CacheStats;
+
+static void read_stats(FILE* file, CacheStats* stats) {
+    memset(stats, 0, sizeof(*stats));
+    char line[128];
+    rewind(file);
+    while (fgets(line, sizeof(line), file)) {
+        sscanf(line, "acertos %lld", &stats->hits);
+        sscanf(line, "falhas %lld", &stats->misses);
+        sscanf(line, "economizado_ms %lf", &stats->saved_ms);
+        sscanf(line, "compilando_ms %lf", &stats->compile_ms);
+    }
+}
+
+/*
+    * Função: update_stats
+    * -------------------------------
+    * Soma os valores ao arquivo de estatísticas, com o arquivo travado
+    * (flock) durante a leitura e a escrita.
+*/
+static void update_stats(long long hits, long long misses, double saved_ms, double compile_ms) {
+    char path[PATH_MAX];
+    if (!make_cache_dir()) return;
+    snprintf(path, sizeof(path), "%s/estatisticas", cache_dir);
+    int fd = open(path, O_RDWR | O_CREAT, 0666);
+    if (fd < 0) return;
+    FILE* file = fdopen(fd, "r+");
+    if (!file) {
+        close(fd);
+        return;
+    }
+    flock(fd, LOCK_EX);
+
+    CacheStats stats;
+    read_stats(file, &stats);
+    stats.hits += hits;
+    stats.misses += misses;
+    stats.saved_ms += saved_ms;
+    stats.compile_ms += compile_ms;
+
+    rewind(file);
+    fprintf(file, "acertos %lld\nfalhas %lld\neconomizado_ms %.3f\ncompilando_ms %.3f\n",
+            stats.hits, stats.misses, stats.saved_ms, stats.compile_ms);
+    fflush(file);
+    if (ftruncate(fd, ftell(file)) != 0) {
+        perror("Erro ao atualizar as estatisticas do cache");
+    }
+
+    flock(fd, LOCK_UN);
+    fclose(file);
+}
+
+// ====================================================================
+// Interface
+
+void cache_set_options(const char* options) {
+    free(cache_options);
+    cache_options = strdup(options);
+}
+
+/*
+    * Função: cache_compute_key
+    * -------------------------------
+    * A versão do compilador é o executável em uso (tamanho e data de
+    * modificação): recompilar o compilador invalida as entradas antigas.
+*/
+int cache_compute_key(const char* source_file, const char* profile_file, char key[CACHE_KEY_LEN]) {
+    size_t length;
+    char* source = read_file(source_file, &length);
+    if (!source) return 0;
+
+    char version[128];
+    struct stat exe;
+    if (stat("/proc/self/exe", &exe) == 0) {
+        snprintf(version, sizeof(version), "%lld:%lld.%09ld", (long long)exe.st_size,
+                 (long long)exe.st_mtim.tv_sec, exe.st_mtim.tv_nsec);
+    } else {
+        snprintf(version, sizeof(version), "desconhecida");
+    }
+
+    Sha256 sha;
+    sha256_init(&sha);
+    sha256_update(&sha, CACHE_MAGIC, sizeof(CACHE_MAGIC));      // Inclui o '\0': separa os campos
+    sha256_update(&sha, version, strlen(version) + 1);
+    sha256_update(&sha, cache_options ? cache_options : "", cache_options ? strlen(cache_options) + 1 : 1);
+    sha256_update(&sha, source, length);
+    free(source);
+
+    if (profile_file != NULL) {
+        size_t profile_length;
+        char* profile = read_file(profile_file, &profile_length);
+        sha256_update(&sha, "\0perfil", 7);
+        if (profile) {
+            sha256_update(&sha, profile, profile_length);
+            free(profile);
+        }
+    }
+
+    sha256_final(&sha, key);
+    return 1;
+}
+
+// Extensões que uma entrada pode conter (as saídas que main.c guarda)
+static const char* const cache_extensions[] = { ".asm", ".linhas", ".s", ".c", ".ir" };
+
+static int known_extension(const char* ext) {
+    for (size_t i = 0; i < sizeof(cache_extensions) / sizeof(cache_extensions[0]); i++) {
+        if (strcmp(ext, cache_extensions[i]) == 0) return 1;
+    }
+    return 0;
+}
+
+/*
+    * Função: parse_output
+    * -------------------------------
+    * Lê o cabeçalho "arquivo <extensão> <bytes>" em 'p' e devolve o início
+    * do conteúdo, ou NULL se a entrada estiver truncada ou malformada. A
+    * extensão vira parte do nome do arquivo gravado, então só as da lista
+    * são aceitas: uma entrada adulterada no diretório compartilhado não
+    * escreve fora de base + extensão.
+*/
+static const char* parse_output(const char* p, const char* end, char ext[32], size_t* size) {
+    const char* line_end = memchr(p, '\n', end - p);
+    int consumed = -1;
+    if (line_end == NULL || sscanf(p, "arquivo %31s %zu%n", ext, size, &consumed) != 2) return NULL;
+    if (p + consumed != line_end || !known_extension(ext)) return NULL;
+    if ((size_t)(end - line_end - 1) < *size) return NULL;
+    return line_end + 1;
+}
+
+/*
+    * Função: cache_fetch
+    * -------------------------------
+    * Formato da entrada: a linha CACHE_MAGIC, "tempo_ms <ms>" e, para cada
+    * saída, "arquivo <extensão> <bytes>" seguida dos bytes. A entrada inteira
+    * é conferida antes de gravar qualquer saída; uma entrada inválida conta
+    * como falha.
+*/
+int cache_fetch(const char* key, const char* base) {
+    double start = now_ms();
+    char path[PATH_MAX];
+    entry_path(key, path, sizeof(path));
+
+    size_t length = 0;
+    char* entry = read_file(path, &length);
+    const char* end = entry + length;
+    const char* body = NULL;
+    double compile_ms = 0;
+    if (entry != NULL && strncmp(entry, CACHE_MAGIC "\n", sizeof(CACHE_MAGIC)) == 0) {
+        const char* p = entry + sizeof(CACHE_MAGIC);
+        const char* line_end = memchr(p, '\n', end - p);
+        if (line_end != NULL && sscanf(p, "tempo_ms %lf", &compile_ms) == 1) body = line_end + 1;
+    }
+
+    int outputs = 0;
+    for (const char* p = body; p != NULL && p < end; outputs++) {
+        char ext[32];
+        size_t size;
+        const char* content = parse_output(p, end, ext, &size);
+        if (content == NULL) body = NULL;
+        p = content ? content + size : NULL;
+    }
+    if (body == NULL || outputs == 0) {
+        free(entry);
+        update_stats(0, 1, 0, 0);
+        return 0;
+    }
+
+    for (const char* p = body; p < end; ) {
+        char ext[32], output[PATH_MAX];
+        size_t size;
+        const char* content = parse_output(p, end, ext, &size);
+        snprintf(output, sizeof(output), "%s%s", base, ext);
+        if (!write_atomically(output, &content, &size, 1)) {
+            fprintf(stderr, "Erro ao gravar '%s' a partir do cache\n", output);
+            free(entry);
+            return 0;
+        }
+        p = content + size;
+    }
+    free(entry);
+
+    double elapsed = now_ms() - start;
+    update_stats(1, 0, compile_ms > elapsed ? compile_ms - elapsed : 0, 0);
+    return 1;
+}
+
+void cache_store(const char* key, const char* base, const char* const* exts, int nexts, double compile_ms) {
+    if (!make_cache_dir()) return;
+
+    // Cabeçalho, e então o cabeçalho e o conteúdo de cada saída
+    const char* parts[1 + 2 * 8];
+    size_t lengths[1 + 2 * 8];
+    char headers[1 + 8][PATH_MAX];
+    char* contents[8] = { NULL };
+    int nparts = 0, ok = 1;
+    if (nexts > 8) return;
+
+    snprintf(headers[0], sizeof(headers[0]), "%s\ntempo_ms %.3f\n", CACHE_MAGIC, compile_ms);
+    parts[nparts] = headers[0];
+    lengths[nparts++] = strlen(headers[0]);
+    for (int i = 0; i < nexts && ok; i++) {
+        char output[PATH_MAX];
+        size_t size;
+        snprintf(output, sizeof(output), "%s%s", base, exts[i]);
+        contents[i] = read_file(output, &size);
+        if (!contents[i]) {
+            ok = 0;
+            break;
+        }
+        snprintf(headers[i + 1], sizeof(headers[i + 1]), "arquivo %s %zu\n", exts[i], size);
+        parts[nparts] = headers[i + 1];
+        lengths[nparts++] = strlen(headers[i + 1]);
+        parts[nparts] = contents[i];
+        lengths[nparts++] = size;
+    }
+
+    if (ok) {
+        char path[PATH_MAX];
+        entry_path(key, path, sizeof(path));
+        if (write_atomically(path, parts, lengths, nparts)) {
+            update_stats(0, 0, 0, compile_ms);
+        }
+    }
+    for (int i = 0; i < nexts; i++) free(contents[i]);
+}
+
+int cache_print_stats(void) {
+    DIR* dir = opendir(cache_dir);
+    if (!dir) {
+        fprintf(stderr, "Cache: nao foi possivel abrir o diretorio '%s'\n", cache_dir);
+        return 1;
+    }
+    long entries = 0;
+    long long bytes = 0;
+    struct dirent* item;
+    while ((item = readdir(dir)) != NULL) {
+        size_t len = strlen(item->d_name);
+        if (len < 7 || strcmp(item->d_name + len - 7, ".gcache") != 0) continue;
+        char path[PATH_MAX];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", cache_dir, item->d_name);
+        if (stat(path, &st) == 0) {
+            entries++;
+            bytes += st.st_size;
+        }
+    }
+    closedir(dir);
+
+    CacheStats stats;
+    memset(&stats, 0, sizeof(stats));
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/estatisticas", cache_dir);
+    FILE* file = fopen(path, "r");
+    if (file) {
+        flock(fileno(file), LOCK_SH);
+        read_stats(file, &stats);
+        flock(fileno(file), LOCK_UN);
+        fclose(file);
+    }
+
+    long long lookups = stats.hits + stats.misses;
+    printf("Cache de compilacao: %s\n", cache_dir);
+    printf("  Entradas: %ld (%.1f KB)\n", entries, bytes / 1024.0);
+    printf("  Acertos: %lld, falhas: %lld (taxa de acerto: %.1f%%)\n",
+           stats.hits, stats.misses, lookups ? stats.hits * 100.0 / lookups : 0.0);
+    printf("  Tempo economizado: %.1f ms (compilando nas falhas: %.1f ms)\n", stats.saved_ms, stats.compile_ms);
+    return 0;
+}
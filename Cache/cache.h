@@ -0,0 +1,52 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+// Cache de compilação endereçado por conteúdo (--cache-dir=dir). A chave é o
+// SHA-256 do fonte, da versão do compilador (o executável em uso) e das
+// opções que mudam o código gerado. Em um acerto, os arquivos gerados são
+// copiados do cache sem passar pelo analisador léxico nem pelo parser.
+//
+// Cada entrada é um arquivo <dir>/<chave>.gcache com todas as saídas da
+// compilação (.asm e .linhas, .s ou .c, e .ir com --emit-ir). Entradas e
+// saídas são escritas em um arquivo temporário e renomeadas, então vários
+// compiladores podem usar o mesmo diretório ao mesmo tempo. As estatísticas
+// ficam em <dir>/estatisticas, atualizadas sob flock.
+
+#define CACHE_KEY_LEN 65                // SHA-256 em hexadecimal + '\0'
+
+// Diretório do cache (--cache-dir= ou a variável GOIANINHA_CACHE); NULL desliga o cache
+extern const char* cache_dir;
+
+/**
+ * Guarda as opções da linha de comando que entram na chave (tudo que muda o
+ * código gerado, na ordem em que foram passadas).
+ */
+void cache_set_options(const char* options);
+
+/**
+ * Calcula a chave do fonte com as opções atuais. Com -fprofile-use, o
+ * conteúdo do perfil também entra na chave.
+ * @return 1 em caso de sucesso, 0 se o fonte não pôde ser lido.
+ */
+int cache_compute_key(const char* source_file, const char* profile_file, char key[CACHE_KEY_LEN]);
+
+/**
+ * Procura a entrada e, se existir, grava cada saída guardada em base + extensão.
+ * @return 1 em um acerto (saídas gravadas), 0 em uma falha.
+ */
+int cache_fetch(const char* key, const char* base);
+
+/**
+ * Guarda as saídas base + extensão de uma compilação bem-sucedida.
+ * @param compile_ms Tempo que a compilação levou (usado para estimar o tempo economizado).
+ */
+void cache_store(const char* key, const char* base, const char* const* exts, int nexts, double compile_ms);
+
+/**
+ * Imprime em stdout as estatísticas do diretório: entradas, tamanho,
+ * acertos, falhas, taxa de acerto e tempo economizado.
+ * @return 0 em caso de sucesso, 1 se o diretório não pôde ser lido.
+ */
+int cache_print_stats(void);
+
+#endif // CACHE_H
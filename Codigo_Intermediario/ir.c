@@ -0,0 +1,662 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "./../Relatorio/time_report.h"
+
+// Constantes de tipo (mesmas de semantic.c e codigo.c)
+#define INT_T 1
+#define CHAR_T 2
+
+
+// IMPLEMENTAÇÃO DA CONSTRUÇÃO DA IR
+
+// Aloca memória zerada, terminando a compilação em caso de falha
+static void* ir_alloc(size_t size) {
+    void* ptr = calloc(1, size);
+    if (ptr == NULL) {
+        perror("Erro de alocação de memória para a IR");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+IrProgram* ir_new_program(void) {
+    return (IrProgram*)ir_alloc(sizeof(IrProgram));
+}
+
+IrFunction* ir_new_function(IrProgram* prog, const char* name, int return_type, int is_main) {
+    IrFunction* func = (IrFunction*)ir_alloc(sizeof(IrFunction));
+    func->name = strdup(name);
+    func->return_type = return_type;
+    func->is_main = is_main;
+
+    // Encadeia no final da lista de funções
+    IrFunction** tail = &prog->functions;
+    while (*tail != NULL) tail = &(*tail)->next;
+    *tail = func;
+    return func;
+}
+
+IrVar* ir_new_var(IrFunction* func, IrProgram* prog, const char* name, IrVarKind kind, int data_type) {
+    IrVar* var = (IrVar*)ir_alloc(sizeof(IrVar));
+    var->name = strdup(name);
+    var->kind = kind;
+    var->data_type = data_type;
+
+    if (kind == IR_VAR_GLOBAL) {
+        var->index = prog->nglobals;
+        prog->globals = (IrVar**)realloc(prog->globals, sizeof(IrVar*) * (prog->nglobals + 1));
+        prog->globals[prog->nglobals++] = var;
+    } else {
+        var->index = func->nvars;
+        func->vars = (IrVar**)realloc(func->vars, sizeof(IrVar*) * (func->nvars + 1));
+        func->vars[func->nvars++] = var;
+        if (kind == IR_VAR_PARAM) func->nparams++;
+    }
+    return var;
+}
+
+IrBlock* ir_new_block(IrFunction* func) {
+    IrBlock* block = (IrBlock*)ir_alloc(sizeof(IrBlock));
+    block->id = func->nblocks++;
+    block->rpo_index = -1;
+
+    IrBlock** tail = &func->entry;
+    while (*tail != NULL) tail = &(*tail)->next;
+    *tail = block;
+    return block;
+}
+
+IrBlock* ir_new_block_after(IrFunction* func, IrBlock* after) {
+    IrBlock* block = ir_new_block(func);
+
+    // ir_new_block encadeia no final; move para logo depois de 'after'
+    IrBlock** link = &func->entry;
+    while (*link != block) link = &(*link)->next;
+    *link = NULL;
+    block->next = after->next;
+    after->next = block;
+    return block;
+}
+
+IrInstr* ir_new_instr(IrOpcode op, int lineno) {
+    IrInstr* instr = (IrInstr*)ir_alloc(sizeof(IrInstr));
+    instr->op = op;
+    instr->dst = -1;
+    instr->src1 = -1;
+    instr->src2 = -1;
+    instr->lineno = lineno;
+    time_counters.ir_instrs++;
+    return instr;
+}
+
+int ir_new_reg(IrFunction* func) {
+    return func->nregs++;
+}
+
+void ir_append(IrBlock* block, IrInstr* instr) {
+    instr->prev = block->last;
+    instr->next = NULL;
+    if (block->last) block->last->next = instr;
+    else block->first = instr;
+    block->last = instr;
+}
+
+void ir_insert_before(IrBlock* block, IrInstr* pos, IrInstr* instr) {
+    if (pos == NULL) {
+        ir_append(block, instr);
+        return;
+    }
+    instr->next = pos;
+    instr->prev = pos->prev;
+    if (pos->prev) pos->prev->next = instr;
+    else block->first = instr;
+    pos->prev = instr;
+}
+
+void ir_unlink(IrBlock* block, IrInstr* instr) {
+    if (instr->prev) instr->prev->next = instr->next;
+    else block->first = instr->next;
+    if (instr->next) instr->next->prev = instr->prev;
+    else block->last = instr->prev;
+    instr->prev = instr->next = NULL;
+}
+
+void ir_remove(IrBlock* block, IrInstr* instr) {
+    ir_unlink(block, instr);
+
+    free(instr->name);
+    free(instr->args);
+    free(instr);
+}
+
+void ir_remove_block(IrFunction* func, IrBlock* block) {
+    IrBlock** link = &func->entry;
+    while (*link != NULL && *link != block) link = &(*link)->next;
+    if (*link == NULL) return;
+    *link = block->next;
+
+    while (block->first != NULL) ir_remove(block, block->first);
+    free(block->preds);
+    free(block);
+}
+
+static void free_var(IrVar* var) {
+    free(var->name);
+    free(var);
+}
+
+void ir_free_function(IrFunction* func) {
+    IrBlock* block = func->entry;
+    while (block != NULL) {
+        while (block->first != NULL) ir_remove(block, block->first);
+        IrBlock* next_block = block->next;
+        free(block->preds);
+        free(block);
+        block = next_block;
+    }
+    for (int i = 0; i < func->nvars; i++) free_var(func->vars[i]);
+    free(func->vars);
+    free(func->name);
+    free(func->writes_global);
+    free(func);
+}
+
+void ir_free_program(IrProgram* prog) {
+    if (prog == NULL) return;
+
+    IrFunction* func = prog->functions;
+    while (func != NULL) {
+        IrFunction* next_func = func->next;
+        ir_free_function(func);
+        func = next_func;
+    }
+
+    for (int i = 0; i < prog->nglobals; i++) free_var(prog->globals[i]);
+    free(prog->globals);
+    free(prog);
+}
+
+
+// ANÁLISES SOBRE O CFG
+
+int ir_is_terminator(const IrInstr* instr) {
+    return instr != NULL && (instr->op == IR_JUMP || instr->op == IR_BRANCH || instr->op == IR_RET);
+}
+
+int ir_instr_uses(const IrInstr* instr, int reg) {
+    if (reg < 0) return 0;
+    if (instr->src1 == reg || instr->src2 == reg) return 1;
+    for (int i = 0; i < instr->nargs; i++) {
+        if (instr->args[i] == reg) return 1;
+    }
+    return 0;
+}
+
+static void add_pred(IrBlock* block, IrBlock* pred) {
+    block->preds = (IrBlock**)realloc(block->preds, sizeof(IrBlock*) * (block->npreds + 1));
+    block->preds[block->npreds++] = pred;
+}
+
+/*
+    * Função: ir_build_cfg
+    * -------------------------------
+    * Recalcula as arestas do CFG (sucessores e predecessores) a partir do
+    * terminador de cada bloco.
+*/
+void ir_build_cfg(IrFunction* func) {
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        free(block->preds);
+        block->preds = NULL;
+        block->npreds = 0;
+        block->nsuccs = 0;
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr* term = block->last;
+        if (term == NULL) continue;
+
+        if (term->op == IR_JUMP) {
+            block->succs[block->nsuccs++] = term->target1;
+        } else if (term->op == IR_BRANCH) {
+            block->succs[block->nsuccs++] = term->target1;
+            if (term->target2 != term->target1) {
+                block->succs[block->nsuccs++] = term->target2;
+            }
+        }
+
+        for (int i = 0; i < block->nsuccs; i++) {
+            add_pred(block->succs[i], block);
+        }
+    }
+}
+
+// Busca em profundidade que numera os blocos em pós-ordem
+static void postorder_visit(IrBlock* block, IrBlock** order, int* count, char* visited) {
+    visited[block->id] = 1;
+    for (int i = 0; i < block->nsuccs; i++) {
+        if (!visited[block->succs[i]->id]) {
+            postorder_visit(block->succs[i], order, count, visited);
+        }
+    }
+    order[(*count)++] = block;
+}
+
+// Sobe nas árvores de dominadores até encontrar o ancestral comum
+static IrBlock* intersect(IrBlock* a, IrBlock* b) {
+    while (a != b) {
+        while (a->rpo_index > b->rpo_index) a = a->idom;
+        while (b->rpo_index > a->rpo_index) b = b->idom;
+    }
+    return a;
+}
+
+/*
+    * Função: ir_compute_dominators
+    * -------------------------------
+    * Calcula o dominador imediato de cada bloco alcançável com o algoritmo
+    * iterativo de Cooper, Harvey e Kennedy. Requer ir_build_cfg atualizado.
+*/
+void ir_compute_dominators(IrFunction* func) {
+    IrBlock** order = (IrBlock**)ir_alloc(sizeof(IrBlock*) * (func->nblocks + 1));
+    char* visited = (char*)ir_alloc(func->nblocks + 1);
+    int count = 0;
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        block->idom = NULL;
+        block->rpo_index = -1;
+    }
+    if (func->entry == NULL) {
+        free(order);
+        free(visited);
+        return;
+    }
+
+    postorder_visit(func->entry, order, &count, visited);
+
+    // Numeração em pós-ordem reversa: a entrada recebe 0
+    for (int i = 0; i < count; i++) {
+        order[i]->rpo_index = count - 1 - i;
+    }
+
+    func->entry->idom = func->entry;
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int i = count - 2; i >= 0; i--) {
+            IrBlock* block = order[i];
+            IrBlock* new_idom = NULL;
+
+            for (int p = 0; p < block->npreds; p++) {
+                IrBlock* pred = block->preds[p];
+                if (pred->idom == NULL) continue;
+                new_idom = new_idom ? intersect(pred, new_idom) : pred;
+            }
+
+            if (new_idom != NULL && block->idom != new_idom) {
+                block->idom = new_idom;
+                changed = 1;
+            }
+        }
+    }
+
+    free(order);
+    free(visited);
+}
+
+int ir_dominates(IrBlock* a, IrBlock* b) {
+    if (a->rpo_index < 0 || b->rpo_index < 0) return 0;
+    while (b != a) {
+        if (b->idom == b || b->idom == NULL) return 0;
+        b = b->idom;
+    }
+    return 1;
+}
+
+IrFunction* ir_find_function(IrProgram* prog, const char* name) {
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        if (strcmp(func->name, name) == 0) return func;
+    }
+    return NULL;
+}
+
+/*
+    * Função: ir_compute_side_effects
+    * -------------------------------
+    * Primeiro marca os efeitos diretos de cada função (stores em globais e
+    * comandos de entrada/saída) e depois propaga os efeitos das funções
+    * chamadas até que nada mude (cobre recursão direta e mútua).
+*/
+void ir_compute_side_effects(IrProgram* prog) {
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        free(func->writes_global);
+        func->writes_global = (char*)ir_alloc(prog->nglobals + 1);
+        func->has_io = 0;
+
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                if (instr->op == IR_STORE && instr->var->kind == IR_VAR_GLOBAL) {
+                    func->writes_global[instr->var->index] = 1;
+                } else if (instr->op == IR_READ || instr->op == IR_WRITE_INT || instr->op == IR_WRITE_CHAR ||
+                           instr->op == IR_WRITE_STR || instr->op == IR_NEWLINE) {
+                    func->has_io = 1;
+                }
+            }
+        }
+    }
+
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+            for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+                for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                    if (instr->op != IR_CALL) continue;
+                    IrFunction* callee = ir_find_function(prog, instr->name);
+                    if (callee == NULL || callee == func) continue;
+
+                    for (int g = 0; g < prog->nglobals; g++) {
+                        if (callee->writes_global[g] && !func->writes_global[g]) {
+                            func->writes_global[g] = 1;
+                            changed = 1;
+                        }
+                    }
+                    if (callee->has_io && !func->has_io) {
+                        func->has_io = 1;
+                        changed = 1;
+                    }
+                }
+            }
+        }
+    }
+}
+
+int ir_call_may_write(IrProgram* prog, const IrInstr* call, const IrVar* var) {
+    if (var->kind != IR_VAR_GLOBAL) return 0;       // Locais não têm endereço em Goianinha
+    IrFunction* callee = ir_find_function(prog, call->name);
+    if (callee == NULL || callee->writes_global == NULL) return 1;
+    return callee->writes_global[var->index] != 0;
+}
+
+
+// SAÍDA TEXTUAL
+
+const char* ir_operator_name(IrOperator oper) {
+    static const char* names[] = {
+        "add", "sub", "mul", "div", "eq", "ne", "lt", "gt", "le", "ge", "neg", "not"
+    };
+    return names[oper];
+}
+
+static void dump_var(IrVar* var, FILE* out) {
+    if (var->kind == IR_VAR_GLOBAL) fprintf(out, "@%s", var->name);
+    else fprintf(out, "%s.%d", var->name, var->index);
+}
+
+static void dump_instr(IrInstr* instr, FILE* out) {
+    fprintf(out, "    ");
+    if (instr->dst >= 0) fprintf(out, "v%d = ", instr->dst);
+
+    switch (instr->op) {
+        case IR_CONST:      fprintf(out, "const %d", instr->imm); break;
+        case IR_COPY:       fprintf(out, "copy v%d", instr->src1); break;
+        case IR_BINOP:
+            fprintf(out, "%s v%d, v%d", ir_operator_name(instr->oper), instr->src1, instr->src2);
+            break;
+        case IR_UNOP:       fprintf(out, "%s v%d", ir_operator_name(instr->oper), instr->src1); break;
+        case IR_LOAD:       fprintf(out, "load "); dump_var(instr->var, out); break;
+        case IR_STORE:
+            fprintf(out, "store ");
+            dump_var(instr->var, out);
+            fprintf(out, ", v%d", instr->src1);
+            break;
+        case IR_CALL:
+            fprintf(out, "call %s(", instr->name);
+            for (int i = 0; i < instr->nargs; i++) {
+                fprintf(out, "%sv%d", i ? ", " : "", instr->args[i]);
+            }
+            fprintf(out, ")");
+            break;
+        case IR_READ:       fprintf(out, "leia"); break;
+        case IR_WRITE_INT:  fprintf(out, "escreva.int v%d", instr->src1); break;
+        case IR_WRITE_CHAR: fprintf(out, "escreva.car v%d", instr->src1); break;
+        case IR_WRITE_STR:  fprintf(out, "escreva.str %s", instr->name); break;
+        case IR_NEWLINE:    fprintf(out, "novalinha"); break;
+        case IR_JUMP:       fprintf(out, "jump bb%d", instr->target1->id); break;
+        case IR_BRANCH:
+            fprintf(out, "br v%d, bb%d, bb%d", instr->src1, instr->target1->id, instr->target2->id);
+            break;
+        case IR_RET:
+            if (instr->src1 >= 0) fprintf(out, "ret v%d", instr->src1);
+            else fprintf(out, "ret");
+            break;
+    }
+    fprintf(out, "\n");
+}
+
+/*
+    * Função: ir_dump_program
+    * -------------------------------
+    * Escreve a IR em formato textual: globais, e para cada função suas
+    * variáveis e blocos básicos com predecessores e sucessores.
+*/
+void ir_dump_program(IrProgram* prog, FILE* out) {
+    for (int i = 0; i < prog->nglobals; i++) {
+        IrVar* var = prog->globals[i];
+        fprintf(out, "global %s @%s\n", var->data_type == CHAR_T ? "car" : "int", var->name);
+    }
+    if (prog->nglobals > 0) fprintf(out, "\n");
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        ir_build_cfg(func);
+
+        fprintf(out, "funcao %s(", func->name);
+        for (int i = 0; i < func->nparams; i++) {
+            fprintf(out, "%s", i ? ", " : "");
+            dump_var(func->vars[i], out);
+        }
+        fprintf(out, ")\n");
+
+        if (func->nvars > func->nparams) {
+            fprintf(out, "  locais:");
+            for (int i = func->nparams; i < func->nvars; i++) {
+                fprintf(out, " ");
+                dump_var(func->vars[i], out);
+            }
+            fprintf(out, "\n");
+        }
+
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            fprintf(out, "  bb%d:", block->id);
+            if (block->npreds > 0) {
+                fprintf(out, "%*s; preds:", block->id < 10 ? 20 : 19, "");
+                for (int i = 0; i < block->npreds; i++) fprintf(out, " bb%d", block->preds[i]->id);
+            }
+            if (func->profiled) fprintf(out, "  (executado %lld vezes)", block->count);
+            fprintf(out, "\n");
+
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                dump_instr(instr, out);
+            }
+        }
+        fprintf(out, "\n");
+    }
+}
+
+
+// VERIFICADOR
+
+static int verify_error(IrFunction* func, IrBlock* block, const char* message) {
+    fprintf(COMPILE_ERR, "ERRO NA IR (funcao %s, bb%d): %s\n", func->name, block ? block->id : -1, message);
+    return 1;
+}
+
+// Verifica se 'reg' é definido antes de 'use' dentro do mesmo bloco
+static int defined_before(IrInstr* use, int reg) {
+    for (IrInstr* instr = use->prev; instr != NULL; instr = instr->prev) {
+        if (instr->dst == reg) return 1;
+    }
+    return 0;
+}
+
+static int verify_use(IrFunction* func, IrBlock* block, IrInstr* instr, int reg,
+                      IrBlock** def_block) {
+    char message[128];
+
+    if (reg < 0 || reg >= func->nregs) {
+        snprintf(message, sizeof(message), "registrador v%d fora do intervalo", reg);
+        return verify_error(func, block, message);
+    }
+    if (def_block[reg] == NULL) {
+        snprintf(message, sizeof(message), "v%d usado mas nunca definido", reg);
+        return verify_error(func, block, message);
+    }
+
+    // Blocos inalcançáveis não precisam respeitar dominância
+    if (block->rpo_index < 0) return 0;
+
+    if (def_block[reg] == block ? !defined_before(instr, reg) : !ir_dominates(def_block[reg], block)) {
+        snprintf(message, sizeof(message), "definicao de v%d nao domina o uso", reg);
+        return verify_error(func, block, message);
+    }
+    return 0;
+}
+
+static int verify_function(IrProgram* prog, IrFunction* func) {
+    int errors = 0;
+
+    if (func->entry == NULL) return verify_error(func, NULL, "funcao sem blocos");
+
+    ir_build_cfg(func);
+    ir_compute_dominators(func);
+
+    if (func->entry->npreds > 0) errors += verify_error(func, func->entry, "bloco de entrada tem predecessores");
+
+    IrBlock** def_block = (IrBlock**)ir_alloc(sizeof(IrBlock*) * (func->nregs + 1));
+
+    // Estrutura dos blocos e definições únicas
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->last == NULL || !ir_is_terminator(block->last)) {
+            errors += verify_error(func, block, "bloco nao termina com jump/br/ret");
+        }
+
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (ir_is_terminator(instr) && instr != block->last) {
+                errors += verify_error(func, block, "terminador no meio do bloco");
+            }
+            if ((instr->op == IR_JUMP || instr->op == IR_BRANCH) && instr->target1 == NULL) {
+                errors += verify_error(func, block, "salto sem destino");
+            }
+            if (instr->op == IR_BRANCH && instr->target2 == NULL) {
+                errors += verify_error(func, block, "desvio sem destino falso");
+            }
+            if ((instr->op == IR_LOAD || instr->op == IR_STORE) && instr->var == NULL) {
+                errors += verify_error(func, block, "load/store sem variavel");
+            }
+            if (instr->op == IR_LOAD || instr->op == IR_STORE) {
+                IrVar* var = instr->var;
+                int owned = var->kind == IR_VAR_GLOBAL
+                          ? var->index < prog->nglobals && prog->globals[var->index] == var
+                          : var->index < func->nvars && func->vars[var->index] == var;
+                if (!owned) errors += verify_error(func, block, "variavel nao pertence a funcao");
+            }
+            if (instr->dst >= 0) {
+                if (instr->dst >= func->nregs) {
+                    errors += verify_error(func, block, "registrador de destino fora do intervalo");
+                } else if (def_block[instr->dst] != NULL) {
+                    char message[64];
+                    snprintf(message, sizeof(message), "v%d definido mais de uma vez", instr->dst);
+                    errors += verify_error(func, block, message);
+                } else {
+                    def_block[instr->dst] = block;
+                }
+            }
+        }
+    }
+
+    // Arestas do CFG: alvos dos saltos pertencem à função
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (int i = 0; i < block->nsuccs; i++) {
+            int found = 0;
+            for (IrBlock* other = func->entry; other != NULL; other = other->next) {
+                if (other == block->succs[i]) found = 1;
+            }
+            if (!found) errors += verify_error(func, block, "sucessor fora da funcao");
+        }
+    }
+
+    // Cada uso é dominado pela definição
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->src1 >= 0) errors += verify_use(func, block, instr, instr->src1, def_block);
+            if (instr->src2 >= 0) errors += verify_use(func, block, instr, instr->src2, def_block);
+            for (int i = 0; i < instr->nargs; i++) {
+                errors += verify_use(func, block, instr, instr->args[i], def_block);
+            }
+        }
+    }
+
+    // Chamadas: a função chamada existe e recebe o número certo de argumentos
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->op != IR_CALL) continue;
+            IrFunction* callee = prog->functions;
+            while (callee != NULL && strcmp(callee->name, instr->name) != 0) callee = callee->next;
+            if (callee == NULL) {
+                errors += verify_error(func, block, "chamada de funcao inexistente");
+            } else if (callee->nparams != instr->nargs) {
+                errors += verify_error(func, block, "numero de argumentos difere dos parametros");
+            }
+        }
+    }
+
+    free(def_block);
+    return errors;
+}
+
+int ir_verify_program(IrProgram* prog) {
+    int errors = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        errors += verify_function(prog, func);
+    }
+    return errors;
+}
+
+/*
+    * Função: ir_optimize_program
+    * -------------------------------
+    * Sequência de otimizações sobre a IR, cada uma sob a sua flag.
+*/
+void ir_optimize_program(IrProgram* prog) {
+    if (tail_calls_enabled) {
+        time_report_begin(PHASE_CAUDA);
+        ir_eliminate_tail_calls(prog);      // Antes do inliner: a função deixa de ser recursiva
+        time_report_end(PHASE_CAUDA);
+    }
+    if (inline_enabled) {
+        time_report_begin(PHASE_INLINE);
+        ir_inline_functions(prog);
+        time_report_end(PHASE_INLINE);
+    }
+    if (cse_enabled) {
+        time_report_begin(PHASE_CSE);
+        ir_eliminate_common_subexpressions(prog);   // Antes do DCE: deixa stores e loads mortos
+        time_report_end(PHASE_CSE);
+    }
+    if (dce_enabled) {
+        time_report_begin(PHASE_DCE);
+        ir_eliminate_dead_code(prog);
+        time_report_end(PHASE_DCE);
+    }
+    if (licm_enabled) {
+        time_report_begin(PHASE_LICM);
+        ir_hoist_loop_invariants(prog);
+        time_report_end(PHASE_LICM);
+    }
+    if (profile_use_file) {
+        time_report_begin(PHASE_PERFIL);
+        ir_optimize_with_profile(prog);     // Rotação de laços e layout: depois do LICM
+        time_report_end(PHASE_PERFIL);
+    }
+}
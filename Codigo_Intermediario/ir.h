@@ -0,0 +1,270 @@
+#ifndef IR_H
+#define IR_H
+
+#include <stdio.h>
+#include "./../AST/ast.h"
+
+// Representação intermediária de três endereços.
+// Cada função é um grafo de fluxo de controle (CFG) de blocos básicos. Valores
+// temporários vivem em registradores virtuais (v0, v1, ...) definidos uma única
+// vez; variáveis do programa são acessadas apenas por load/store.
+
+// Operações da IR
+typedef enum {
+    IR_CONST,      // dst = imm
+    IR_COPY,       // dst = src1
+    IR_BINOP,      // dst = src1 <binop> src2
+    IR_UNOP,       // dst = <unop> src1
+    IR_LOAD,       // dst = var
+    IR_STORE,      // var = src1
+    IR_CALL,       // dst = call func(args...)
+    IR_READ,       // dst = leia
+    IR_WRITE_INT,  // escreva src1 (inteiro)
+    IR_WRITE_CHAR, // escreva src1 (caractere)
+    IR_WRITE_STR,  // escreva "str"
+    IR_NEWLINE,    // novalinha
+    // Terminadores (último comando de cada bloco)
+    IR_JUMP,       // jump target1
+    IR_BRANCH,     // br src1, target1 (se != 0), target2 (se == 0)
+    IR_RET,        // ret src1
+} IrOpcode;
+
+// Operadores binários e unários
+typedef enum {
+    IR_ADD, IR_SUB, IR_MUL, IR_DIV,
+    IR_EQ, IR_NE, IR_LT, IR_GT, IR_LE, IR_GE,
+    IR_NEG, IR_NOT
+} IrOperator;
+
+// Onde a variável vive
+typedef enum {
+    IR_VAR_GLOBAL,
+    IR_VAR_PARAM,
+    IR_VAR_LOCAL,
+} IrVarKind;
+
+typedef struct IrVar {
+    char* name;
+    IrVarKind kind;
+    int index;      // Posição na tabela de globais ou de variáveis da função
+    int data_type;  // INT_T ou CHAR_T
+} IrVar;
+
+struct IrBlock;
+
+typedef struct IrInstr {
+    IrOpcode op;
+    IrOperator oper;          // IR_BINOP / IR_UNOP
+    int dst;                  // Registrador virtual definido (-1 se nenhum)
+    int src1, src2;           // Registradores virtuais lidos (-1 se nenhum)
+    int imm;                  // IR_CONST
+    IrVar* var;               // IR_LOAD / IR_STORE
+    char* name;               // IR_CALL: função; IR_WRITE_STR: literal entre aspas
+    int* args;                // IR_CALL: registradores dos argumentos
+    int nargs;
+    struct IrBlock* target1;  // IR_JUMP / IR_BRANCH
+    struct IrBlock* target2;  // IR_BRANCH
+    int lineno;               // Linha de origem no arquivo .g
+
+    struct IrInstr* prev;
+    struct IrInstr* next;
+} IrInstr;
+
+typedef struct IrBlock {
+    int id;
+    IrInstr* first;
+    IrInstr* last;
+
+    // Arestas do CFG (preenchidas por ir_build_cfg)
+    struct IrBlock* succs[2];
+    int nsuccs;
+    struct IrBlock** preds;
+    int npreds;
+
+    // Dominador imediato (preenchido por ir_compute_dominators)
+    struct IrBlock* idom;
+    int rpo_index;            // Posição na ordem pós-ordem reversa (-1 se inalcançável)
+
+    long long count;          // Execuções medidas (-fprofile-use); 0 sem perfil
+
+    struct IrBlock* next;     // Ordem de layout
+} IrBlock;
+
+typedef struct IrFunction {
+    char* name;
+    int return_type;
+    int is_main;
+
+    IrVar** vars;             // Parâmetros (primeiro) e variáveis locais de todos os blocos
+    int nvars;
+    int nparams;
+
+    IrBlock* entry;           // Primeiro bloco do layout
+    int nblocks;
+    int nregs;                // Número de registradores virtuais usados
+
+    // Efeitos colaterais (preenchidos por ir_compute_side_effects), incluindo as funções chamadas
+    char* writes_global;      // writes_global[i] != 0 se a função pode alterar a global i
+    int has_io;               // Faz leia/escreva/novalinha
+
+    int profiled;             // As contagens dos blocos vieram de um perfil (-fprofile-use)
+
+    struct IrFunction* next;
+} IrFunction;
+
+typedef struct {
+    IrVar** globals;
+    int nglobals;
+    IrFunction* functions;    // Funções na ordem do fonte; main por último
+} IrProgram;
+
+// --- Construção (ir.c) ---
+IrProgram* ir_new_program(void);
+IrFunction* ir_new_function(IrProgram* prog, const char* name, int return_type, int is_main);
+IrVar* ir_new_var(IrFunction* func, IrProgram* prog, const char* name, IrVarKind kind, int data_type);
+IrBlock* ir_new_block(IrFunction* func);
+IrBlock* ir_new_block_after(IrFunction* func, IrBlock* after);
+IrInstr* ir_new_instr(IrOpcode op, int lineno);
+int ir_new_reg(IrFunction* func);
+void ir_append(IrBlock* block, IrInstr* instr);
+void ir_insert_before(IrBlock* block, IrInstr* pos, IrInstr* instr);
+void ir_unlink(IrBlock* block, IrInstr* instr);          // Tira do bloco sem liberar
+void ir_remove(IrBlock* block, IrInstr* instr);
+void ir_remove_block(IrFunction* func, IrBlock* block);   // Remove do layout e libera (arestas devem ser recalculadas)
+void ir_free_function(IrFunction* func);                  // Não remove da lista do programa
+void ir_free_program(IrProgram* prog);
+
+// --- Análises (ir.c) ---
+int ir_is_terminator(const IrInstr* instr);
+void ir_build_cfg(IrFunction* func);
+void ir_compute_dominators(IrFunction* func);
+int ir_dominates(IrBlock* a, IrBlock* b);
+int ir_instr_uses(const IrInstr* instr, int reg);
+const char* ir_operator_name(IrOperator oper);
+IrFunction* ir_find_function(IrProgram* prog, const char* name);
+
+/**
+ * Calcula, para cada função, quais globais ela pode alterar e se faz entrada
+ * ou saída, considerando também as funções que ela chama (ponto fixo).
+ */
+void ir_compute_side_effects(IrProgram* prog);
+
+/** Retorna 1 se a chamada pode alterar a variável global 'var'. */
+int ir_call_may_write(IrProgram* prog, const IrInstr* call, const IrVar* var);
+
+// --- Saída e verificação (ir.c) ---
+void ir_dump_program(IrProgram* prog, FILE* out);
+
+/**
+ * Verifica a consistência da IR (terminadores, arestas do CFG, definições únicas
+ * e dominância entre definição e uso dos registradores virtuais).
+ * @return Número de erros encontrados (impressos em stderr).
+ */
+int ir_verify_program(IrProgram* prog);
+
+// --- Otimizações sobre a IR ---
+
+// Flag de linha de comando: 0 desliga a troca de recursão de cauda por saltos (-fno-tail-calls)
+extern int tail_calls_enabled;
+
+/**
+ * Troca chamadas recursivas de cauda por saltos para o início da função e
+ * reescreve "retorne x op f(...)" (op associativo) como um laço com
+ * acumulador (ir_tail.c). Imprime quantas chamadas foram transformadas.
+ */
+void ir_eliminate_tail_calls(IrProgram* prog);
+
+// Flag de linha de comando: 0 desliga a eliminação de código morto (-fno-dce)
+extern int dce_enabled;
+
+/**
+ * Remove blocos inalcançáveis (inclusive braços de condições constantes),
+ * stores mortos em variáveis locais e valores nunca lidos (ir_dce.c).
+ * Imprime o que foi removido em cada função.
+ */
+void ir_eliminate_dead_code(IrProgram* prog);
+
+// Flags de linha de comando do inliner: -fno-inline e -finline-limit=N
+extern int inline_enabled;
+extern int inline_threshold;
+
+/**
+ * Expande no local das chamadas as funções pequenas e não recursivas cujo
+ * tamanho (em instruções da IR) não passa de inline_threshold (ir_inline.c).
+ * Imprime o que foi expandido e onde.
+ */
+void ir_inline_functions(IrProgram* prog);
+
+// Flag de linha de comando: 0 desliga a movimentação de invariantes de laço (-fno-licm)
+extern int licm_enabled;
+
+/**
+ * Move para um pré-cabeçalho as operações puras de cada laço cujos operandos
+ * não mudam dentro dele (ir_licm.c). Respeita as globais que as chamadas
+ * dentro do laço podem alterar.
+ */
+void ir_hoist_loop_invariants(IrProgram* prog);
+
+// Flag de linha de comando: 0 desliga a eliminação de subexpressões comuns (-fno-cse)
+extern int cse_enabled;
+
+/**
+ * Numeração de valores sobre a árvore de dominadores (ir_cse.c): troca
+ * cálculos e loads repetidos pelo registrador que já tem o valor, dentro do
+ * bloco e entre blocos. Stores e chamadas invalidam as variáveis que alteram.
+ */
+void ir_eliminate_common_subexpressions(IrProgram* prog);
+
+// Flags de linha de comando da otimização guiada por perfil (ir_profile.c):
+// -fprofile-generate e -fprofile-use[=arquivo]
+extern int profile_generate;
+extern const char* profile_use_file;
+
+/**
+ * Instrumenta o programa recém-gerado (ir_profile.c): cada bloco básico ganha
+ * um contador global incrementado na entrada, e main imprime as contagens ao
+ * terminar, em linhas "@perfil <funcao> <bloco> <contagem>".
+ */
+void ir_instrument_program(IrProgram* prog);
+
+/**
+ * Lê as linhas "@perfil" de uma execução instrumentada e guarda as contagens
+ * nos blocos do programa recém-gerado (os números dos blocos são os mesmos).
+ * @return 1 em caso de sucesso, 0 se o arquivo não pôde ser lido.
+ */
+int ir_load_profile(IrProgram* prog, const char* filename);
+
+/**
+ * Usa as contagens depois das otimizações: rotaciona os laços quentes (o
+ * teste do cabeçalho é copiado para o fim do corpo) e move os blocos nunca
+ * executados para o fim da função. Imprime o que foi feito.
+ */
+void ir_optimize_with_profile(IrProgram* prog);
+
+/**
+ * Perfil por linha a partir das contagens lidas (--profile-lines com
+ * -fprofile-use): cada instrução da IR soma a contagem do seu bloco à sua
+ * linha. Vale para perfis coletados em qualquer simulador MIPS.
+ */
+void ir_report_line_profile(IrProgram* prog);
+
+/**
+ * Roda as otimizações habilitadas pelas flags, sempre na mesma ordem
+ * (independente da ordem das opções na linha de comando): recursão de cauda,
+ * inlining, CSE, DCE, LICM e, com -fprofile-use, as otimizações guiadas por
+ * perfil. Usada por main.c e pela biblioteca.
+ */
+void ir_optimize_program(IrProgram* prog);
+
+// --- Geração a partir da AST (ir_gera.c) ---
+IrProgram* ir_generate_program(AST_Node* root);
+
+// --- Geração de MIPS a partir da IR (Gera_Codigo/ir_mips.c) ---
+void ir_generate_mips(IrProgram* prog, const char* output_filename);
+void ir_generate_mips_to(IrProgram* prog, FILE* mips_file);
+
+// --- Geração de x86-64 a partir da IR (Gera_Codigo/ir_x86.c) ---
+void ir_generate_x86(IrProgram* prog, const char* output_filename);
+void ir_generate_x86_to(IrProgram* prog, FILE* out);
+
+#endif // IR_H
@@ -0,0 +1,358 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+
+// Flag de linha de comando (-fno-cse desliga a eliminação de subexpressões comuns)
+int cse_enabled = 1;
+
+#define CSE_BUCKETS 211
+
+// Valor de uma variável ainda não calculado pela análise (otimista)
+#define VALUE_TOP -2
+// Valor desconhecido (a variável pode ter qualquer valor)
+#define VALUE_UNKNOWN -1
+
+// Entrada da tabela: expressão (operação, operador, números de valor dos operandos)
+typedef struct CseEntry {
+    IrOpcode op;
+    IrOperator oper;
+    int a, b, imm;
+    int epoch;               // Constantes só são reaproveitadas no mesmo trecho sem chamadas
+    int reg;                 // Registrador que já tem o valor
+    struct CseEntry* next;
+} CseEntry;
+
+// Tabela hash com escopos: as entradas de um bloco valem nos blocos que ele domina
+typedef struct {
+    CseEntry* buckets[CSE_BUCKETS];
+    int* undo;               // Buckets das inserções, na ordem (pilha)
+    int nundo, capacity;
+} CseTable;
+
+// Estado da função sendo otimizada
+typedef struct {
+    IrProgram* prog;
+    IrFunction* func;
+    int* canon;              // Registrador que substitui cada registrador removido
+    int* vn;                 // Número de valor de cada registrador
+    int nslots;              // Variáveis da função seguidas das globais
+    int* avail_in;           // Valor de cada variável na entrada de cada bloco
+    IrBlock** children;      // Filhos na árvore de dominadores (listas encadeadas por índice)
+    int* first_child;
+    int* next_sibling;
+    CseTable table;
+    int epoch;               // Muda a cada bloco e a cada chamada
+    int loads;               // Loads substituídos por um valor já conhecido
+    int exprs;               // Expressões substituídas por um valor já calculado
+} CseState;
+
+
+// --- Tabela de expressões ---
+
+static int resolve(CseState* state, int reg) {
+    while (reg >= 0 && state->canon[reg] != reg) reg = state->canon[reg];
+    return reg;
+}
+
+static int value_number(CseState* state, int reg) {
+    return reg >= 0 ? state->vn[resolve(state, reg)] : reg;
+}
+
+static int is_commutative(IrOperator oper) {
+    return oper == IR_ADD || oper == IR_MUL || oper == IR_EQ || oper == IR_NE;
+}
+
+static unsigned hash_key(IrOpcode op, IrOperator oper, int a, int b, int imm) {
+    unsigned h = (unsigned)op * 31u + (unsigned)oper;
+    h = h * 131u + (unsigned)a;
+    h = h * 131u + (unsigned)b;
+    h = h * 131u + (unsigned)imm;
+    return h % CSE_BUCKETS;
+}
+
+static CseEntry* table_find(CseTable* table, IrOpcode op, IrOperator oper, int a, int b, int imm, int epoch) {
+    for (CseEntry* e = table->buckets[hash_key(op, oper, a, b, imm)]; e != NULL; e = e->next) {
+        if (e->op == op && e->oper == oper && e->a == a && e->b == b && e->imm == imm &&
+            (op != IR_CONST || e->epoch == epoch)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void table_insert(CseTable* table, IrOpcode op, IrOperator oper, int a, int b, int imm,
+                         int epoch, int reg) {
+    unsigned bucket = hash_key(op, oper, a, b, imm);
+    CseEntry* e = (CseEntry*)malloc(sizeof(CseEntry));
+    e->op = op;
+    e->oper = oper;
+    e->a = a;
+    e->b = b;
+    e->imm = imm;
+    e->epoch = epoch;
+    e->reg = reg;
+    e->next = table->buckets[bucket];
+    table->buckets[bucket] = e;
+
+    if (table->nundo == table->capacity) {
+        table->capacity = table->capacity ? table->capacity * 2 : 64;
+        table->undo = (int*)realloc(table->undo, sizeof(int) * table->capacity);
+    }
+    table->undo[table->nundo++] = (int)bucket;
+}
+
+// Desfaz as inserções até a pilha voltar a 'mark' (saída do escopo de um bloco)
+static void table_pop(CseTable* table, int mark) {
+    while (table->nundo > mark) {
+        int bucket = table->undo[--table->nundo];
+        CseEntry* e = table->buckets[bucket];
+        table->buckets[bucket] = e->next;
+        free(e);
+    }
+}
+
+
+// --- Disponibilidade dos valores das variáveis ---
+
+static int var_slot(CseState* state, const IrVar* var) {
+    return var->kind == IR_VAR_GLOBAL ? state->func->nvars + var->index : var->index;
+}
+
+/*
+    * Função: transfer
+    * -------------------------------
+    * Efeito de uma instrução sobre o valor conhecido de cada variável: load e
+    * store tornam o valor conhecido; uma chamada esquece as globais que ela
+    * pode alterar.
+*/
+static void transfer(CseState* state, IrInstr* instr, int* values) {
+    if (instr->op == IR_LOAD) {
+        int slot = var_slot(state, instr->var);
+        if (values[slot] < 0) values[slot] = instr->dst;
+    } else if (instr->op == IR_STORE) {
+        values[var_slot(state, instr->var)] = instr->src1;
+    } else if (instr->op == IR_CALL) {
+        for (int g = 0; g < state->prog->nglobals; g++) {
+            if (ir_call_may_write(state->prog, instr, state->prog->globals[g])) {
+                values[state->func->nvars + g] = VALUE_UNKNOWN;
+            }
+        }
+    }
+}
+
+/*
+    * Função: compute_available_values
+    * -------------------------------
+    * Análise de expressões disponíveis para os loads: na entrada de um bloco,
+    * uma variável tem valor conhecido v se todos os predecessores chegam com
+    * o mesmo v. Como cada registrador tem uma única definição, v então
+    * domina o bloco e pode substituir um novo load.
+*/
+static void compute_available_values(CseState* state) {
+    IrFunction* func = state->func;
+    int nslots = state->nslots;
+    int nblocks = func->nblocks;
+    int* avail_out = (int*)malloc(sizeof(int) * (size_t)nblocks * nslots + sizeof(int));
+    int* values = (int*)malloc(sizeof(int) * nslots + sizeof(int));
+
+    state->avail_in = (int*)malloc(sizeof(int) * (size_t)nblocks * nslots + sizeof(int));
+    for (int i = 0; i < nblocks * nslots; i++) {
+        state->avail_in[i] = VALUE_TOP;
+        avail_out[i] = VALUE_TOP;
+    }
+    for (int s = 0; s < nslots; s++) state->avail_in[func->entry->id * nslots + s] = VALUE_UNKNOWN;
+
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            if (block->rpo_index < 0) continue;
+            int* in = state->avail_in + (size_t)block->id * nslots;
+
+            if (block != func->entry) {
+                for (int s = 0; s < nslots; s++) {
+                    int meet = VALUE_TOP;
+                    for (int p = 0; p < block->npreds; p++) {
+                        IrBlock* pred = block->preds[p];
+                        if (pred->rpo_index < 0) continue;
+                        int v = avail_out[(size_t)pred->id * nslots + s];
+                        if (v == VALUE_TOP) continue;
+                        meet = (meet == VALUE_TOP || meet == v) ? v : VALUE_UNKNOWN;
+                    }
+                    in[s] = meet;
+                }
+            }
+
+            memcpy(values, in, sizeof(int) * nslots);
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                transfer(state, instr, values);
+            }
+
+            int* out = avail_out + (size_t)block->id * nslots;
+            if (memcmp(out, values, sizeof(int) * nslots) != 0) {
+                memcpy(out, values, sizeof(int) * nslots);
+                changed = 1;
+            }
+        }
+    }
+
+    free(avail_out);
+    free(values);
+}
+
+
+// --- Numeração de valores ---
+
+/*
+    * Função: number_block
+    * -------------------------------
+    * Numeração de valores do bloco, com a tabela já contendo as expressões
+    * dos blocos que o dominam. Depois desce na árvore de dominadores.
+    *
+    * Um load cujo valor veio de outro bloco, ou de antes de uma chamada, não
+    * é removido: o gerador guardaria o registrador no frame, o que custa
+    * mais que o próprio load. Ele só recebe o número de valor conhecido, para
+    * que as expressões sobre ele encontrem as dos dominadores. Pelo mesmo
+    * motivo, constantes não são reaproveitadas depois de uma chamada.
+*/
+static void number_block(CseState* state, IrBlock* block) {
+    int mark = state->table.nundo;
+    int* values = (int*)malloc(sizeof(int) * state->nslots + sizeof(int));
+    char* local = (char*)calloc(state->nslots + 1, 1);
+    memcpy(values, state->avail_in + (size_t)block->id * state->nslots, sizeof(int) * state->nslots);
+    state->epoch++;
+
+    IrInstr* instr = block->first;
+    while (instr != NULL) {
+        IrInstr* next = instr->next;
+
+        if (instr->src1 >= 0) instr->src1 = resolve(state, instr->src1);
+        if (instr->src2 >= 0) instr->src2 = resolve(state, instr->src2);
+        for (int i = 0; i < instr->nargs; i++) instr->args[i] = resolve(state, instr->args[i]);
+
+        if (instr->op == IR_LOAD) {
+            int slot = var_slot(state, instr->var);
+            int known = values[slot];
+            if (known >= 0 && local[slot]) {
+                state->canon[instr->dst] = resolve(state, known);
+                state->loads++;
+                ir_remove(block, instr);
+                instr = next;
+                continue;
+            }
+            if (known >= 0) state->vn[instr->dst] = value_number(state, known);
+            values[slot] = instr->dst;
+            local[slot] = 1;
+        } else if (instr->op == IR_STORE) {
+            int slot = var_slot(state, instr->var);
+            values[slot] = instr->src1;
+            local[slot] = 1;
+        } else if (instr->op == IR_CONST || instr->op == IR_BINOP || instr->op == IR_UNOP) {
+            int a = value_number(state, instr->src1);
+            int b = value_number(state, instr->src2);
+            if (instr->op == IR_BINOP && is_commutative(instr->oper) && a > b) {
+                int t = a; a = b; b = t;
+            }
+            IrOperator oper = instr->op == IR_CONST ? IR_ADD : instr->oper;
+
+            CseEntry* found = table_find(&state->table, instr->op, oper, a, b, instr->imm, state->epoch);
+            if (found != NULL) {
+                state->canon[instr->dst] = found->reg;
+                state->exprs++;
+                ir_remove(block, instr);
+                instr = next;
+                continue;
+            }
+            table_insert(&state->table, instr->op, oper, a, b, instr->imm, state->epoch, instr->dst);
+        } else if (instr->op == IR_COPY) {
+            state->canon[instr->dst] = instr->src1;
+            ir_remove(block, instr);
+            instr = next;
+            continue;
+        } else {
+            transfer(state, instr, values);
+            if (instr->op == IR_CALL) {
+                memset(local, 0, state->nslots);
+                state->epoch++;
+            }
+        }
+        instr = next;
+    }
+    free(values);
+    free(local);
+
+    for (int c = state->first_child[block->id]; c >= 0; c = state->next_sibling[c]) {
+        number_block(state, state->children[c]);
+    }
+    table_pop(&state->table, mark);
+}
+
+static void cse_function(IrProgram* prog, IrFunction* func) {
+    CseState state;
+    memset(&state, 0, sizeof(state));
+    state.prog = prog;
+    state.func = func;
+    state.nslots = func->nvars + prog->nglobals;
+
+    ir_build_cfg(func);
+    ir_compute_dominators(func);
+
+    int nregs = func->nregs + 1;
+    state.canon = (int*)malloc(sizeof(int) * nregs);
+    state.vn = (int*)malloc(sizeof(int) * nregs);
+    for (int v = 0; v < nregs; v++) state.canon[v] = state.vn[v] = v;
+
+    // Árvore de dominadores: filhos de cada bloco, indexados pelo id
+    int nblocks = func->nblocks + 1;
+    state.children = (IrBlock**)calloc(nblocks, sizeof(IrBlock*));
+    state.first_child = (int*)malloc(sizeof(int) * nblocks);
+    state.next_sibling = (int*)malloc(sizeof(int) * nblocks);
+    for (int i = 0; i < nblocks; i++) state.first_child[i] = state.next_sibling[i] = -1;
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        state.children[block->id] = block;
+        if (block->rpo_index < 0 || block == func->entry) continue;
+        state.next_sibling[block->id] = state.first_child[block->idom->id];
+        state.first_child[block->idom->id] = block->id;
+    }
+
+    compute_available_values(&state);
+    number_block(&state, func->entry);
+
+    // Blocos inalcançáveis não foram visitados, mas podem usar registradores substituídos
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->src1 >= 0) instr->src1 = resolve(&state, instr->src1);
+            if (instr->src2 >= 0) instr->src2 = resolve(&state, instr->src2);
+            for (int i = 0; i < instr->nargs; i++) instr->args[i] = resolve(&state, instr->args[i]);
+        }
+    }
+
+    fprintf(COMPILE_OUT, "  %-16s %d loads e %d expressoes reaproveitados\n", func->name, state.loads, state.exprs);
+
+    table_pop(&state.table, 0);
+    free(state.table.undo);
+    free(state.canon);
+    free(state.vn);
+    free(state.avail_in);
+    free(state.children);
+    free(state.first_child);
+    free(state.next_sibling);
+}
+
+/*
+    * Função: ir_eliminate_common_subexpressions
+    * -------------------------------
+    * Numeração de valores sobre a árvore de dominadores: dentro de um bloco
+    * (numeração local) e entre blocos, usando as expressões dos dominadores e
+    * os valores disponíveis das variáveis. Stores e chamadas invalidam os
+    * valores das variáveis que alteram.
+*/
+void ir_eliminate_common_subexpressions(IrProgram* prog) {
+    fprintf(COMPILE_OUT, "Eliminacao de subexpressoes comuns:\n");
+    ir_compute_side_effects(prog);
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        cse_function(prog, func);
+    }
+}
@@ -0,0 +1,365 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+
+// Flag de linha de comando (-fno-dce desliga a eliminação de código morto)
+int dce_enabled = 1;
+
+// O que foi removido de uma função
+typedef struct {
+    int branches;        // Desvios com condição constante trocados por jump
+    int unreachable;     // Instruções em blocos inalcançáveis
+    int dead_stores;     // Stores em variáveis locais nunca lidas depois
+    int dead_values;     // Instruções puras cujo valor nunca é lido
+    int* lines;          // Linhas dos comandos removidos (sem repetição)
+    int nlines;
+} DceStats;
+
+static void record_line(DceStats* stats, int lineno) {
+    for (int i = 0; i < stats->nlines; i++) {
+        if (stats->lines[i] == lineno) return;
+    }
+    stats->lines = (int*)realloc(stats->lines, sizeof(int) * (stats->nlines + 1));
+    stats->lines[stats->nlines++] = lineno;
+}
+
+// Instruções sem efeito além de definir 'dst'
+static int is_pure(const IrInstr* instr, IrInstr** def_instr) {
+    switch (instr->op) {
+        case IR_CONST:
+        case IR_COPY:
+        case IR_UNOP:
+        case IR_LOAD:
+            return 1;
+        case IR_BINOP: {
+            if (instr->oper != IR_DIV) return 1;
+            // Divisão só com divisor constante diferente de zero e de -1 (as outras podem falhar)
+            IrInstr* divisor = def_instr[instr->src2];
+            return divisor != NULL && divisor->op == IR_CONST && divisor->imm != 0 && divisor->imm != -1;
+        }
+        default:
+            return 0;
+    }
+}
+
+/*
+    * Função: eval_operator
+    * -------------------------------
+    * Calcula o resultado de um operador sobre constantes, com a aritmética de
+    * 32 bits do MIPS. Divisões que podem falhar não são avaliadas.
+    *
+    * Retorna: 1 se o resultado foi calculado em 'result', 0 caso contrário.
+*/
+static int eval_operator(IrOperator oper, int a, int b, int* result) {
+    unsigned ua = (unsigned)a, ub = (unsigned)b;
+    switch (oper) {
+        case IR_ADD: *result = (int)(ua + ub); return 1;
+        case IR_SUB: *result = (int)(ua - ub); return 1;
+        case IR_MUL: *result = (int)(ua * ub); return 1;
+        case IR_DIV:
+            if (b == 0 || (a == (int)0x80000000 && b == -1)) return 0;
+            *result = a / b;
+            return 1;
+        case IR_EQ:  *result = a == b; return 1;
+        case IR_NE:  *result = a != b; return 1;
+        case IR_LT:  *result = a < b; return 1;
+        case IR_GT:  *result = a > b; return 1;
+        case IR_LE:  *result = a <= b; return 1;
+        case IR_GE:  *result = a >= b; return 1;
+        case IR_NEG: *result = (int)(0u - ua); return 1;
+        case IR_NOT: *result = a == 0; return 1;
+    }
+    return 0;
+}
+
+/*
+    * Função: fold_constant_branches
+    * -------------------------------
+    * Descobre quais registradores virtuais têm valor constante e troca os
+    * desvios sobre eles por um jump para o único braço possível.
+*/
+static int fold_constant_branches(IrFunction* func, DceStats* stats) {
+    int nregs = func->nregs > 0 ? func->nregs : 1;
+    char* known = (char*)calloc(nregs, 1);
+    int* value = (int*)calloc(nregs, sizeof(int));
+    int changed = 1;
+    int folded = 0;
+
+    // Cada registrador é definido uma única vez, então basta repetir até estabilizar
+    while (changed) {
+        changed = 0;
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                if (instr->dst < 0 || known[instr->dst]) continue;
+
+                int result;
+                int ok = 0;
+                if (instr->op == IR_CONST) {
+                    result = instr->imm;
+                    ok = 1;
+                } else if (instr->op == IR_COPY && known[instr->src1]) {
+                    result = value[instr->src1];
+                    ok = 1;
+                } else if (instr->op == IR_BINOP && known[instr->src1] && known[instr->src2]) {
+                    ok = eval_operator(instr->oper, value[instr->src1], value[instr->src2], &result);
+                } else if (instr->op == IR_UNOP && known[instr->src1]) {
+                    ok = eval_operator(instr->oper, value[instr->src1], 0, &result);
+                }
+
+                if (ok) {
+                    known[instr->dst] = 1;
+                    value[instr->dst] = result;
+                    changed = 1;
+                }
+            }
+        }
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr* term = block->last;
+        if (term == NULL || term->op != IR_BRANCH || !known[term->src1]) continue;
+
+        term->op = IR_JUMP;
+        if (value[term->src1] == 0) term->target1 = term->target2;
+        term->target2 = NULL;
+        term->src1 = -1;
+        stats->branches++;
+        folded = 1;
+    }
+
+    free(known);
+    free(value);
+    return folded;
+}
+
+/*
+    * Função: remove_unreachable_blocks
+    * -------------------------------
+    * Remove os blocos que não são alcançados a partir da entrada: comandos
+    * depois de um retorne e braços de condições constantes.
+*/
+static int remove_unreachable_blocks(IrFunction* func, DceStats* stats) {
+    int removed = 0;
+
+    ir_build_cfg(func);
+    ir_compute_dominators(func);
+
+    IrBlock* block = func->entry;
+    while (block != NULL) {
+        IrBlock* next = block->next;
+        if (block->rpo_index < 0) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                // Saltos e retornos implícitos criados pela geração não são comandos do fonte
+                if (ir_is_terminator(instr) && instr->src1 < 0) continue;
+                stats->unreachable++;
+                record_line(stats, instr->lineno);
+            }
+            ir_remove_block(func, block);
+            removed = 1;
+        }
+        block = next;
+    }
+
+    if (removed) ir_build_cfg(func);
+    return removed;
+}
+
+/*
+    * Função: merge_straight_blocks
+    * -------------------------------
+    * Junta um bloco ao seu único predecessor quando este termina com um jump
+    * para ele. Limpa as cadeias de blocos vazios que sobram depois que os
+    * braços constantes e os blocos inalcançáveis são removidos.
+*/
+static int merge_straight_blocks(IrFunction* func) {
+    int merged = 0;
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        while (block->last != NULL && block->last->op == IR_JUMP) {
+            IrBlock* succ = block->last->target1;
+            if (succ == block || succ == func->entry || succ->npreds != 1) break;
+
+            ir_remove(block, block->last);
+            while (succ->first != NULL) {
+                IrInstr* instr = succ->first;
+                succ->first = instr->next;
+                ir_append(block, instr);
+            }
+            succ->last = NULL;
+
+            // As arestas que saíam do sucessor agora saem deste bloco
+            ir_remove_block(func, succ);
+            ir_build_cfg(func);
+            merged = 1;
+        }
+    }
+    return merged;
+}
+
+// Só variáveis locais e parâmetros têm o tempo de vida limitado à função
+static int is_scalar_local(const IrVar* var) {
+    return var->kind != IR_VAR_GLOBAL;
+}
+
+/*
+    * Função: remove_dead_stores
+    * -------------------------------
+    * Análise de vivacidade das variáveis locais sobre o CFG. Um store é morto
+    * quando a variável é sobrescrita ou a função retorna antes de uma nova
+    * leitura. Chamadas não leem locais (não há endereços em Goianinha).
+*/
+static int remove_dead_stores(IrFunction* func, DceStats* stats) {
+    int nvars = func->nvars > 0 ? func->nvars : 1;
+    int nblocks = func->nblocks > 0 ? func->nblocks : 1;
+    char* live_in = (char*)calloc((size_t)nblocks * nvars, 1);
+    char* live_out = (char*)calloc((size_t)nblocks * nvars, 1);
+    char* live = (char*)malloc(nvars);
+    int changed = 1;
+    int removed = 0;
+
+    // Iteração até o ponto fixo: out(B) = união de in(S); in(B) = uses U (out - defs)
+    while (changed) {
+        changed = 0;
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            char* out = live_out + (size_t)block->id * nvars;
+            char* in = live_in + (size_t)block->id * nvars;
+
+            for (int s = 0; s < block->nsuccs; s++) {
+                char* succ_in = live_in + (size_t)block->succs[s]->id * nvars;
+                for (int v = 0; v < func->nvars; v++) {
+                    if (succ_in[v] && !out[v]) out[v] = changed = 1;
+                }
+            }
+
+            memcpy(live, out, func->nvars);
+            for (IrInstr* instr = block->last; instr != NULL; instr = instr->prev) {
+                if (instr->var == NULL || !is_scalar_local(instr->var)) continue;
+                if (instr->op == IR_STORE) live[instr->var->index] = 0;
+                else if (instr->op == IR_LOAD) live[instr->var->index] = 1;
+            }
+            for (int v = 0; v < func->nvars; v++) {
+                if (live[v] && !in[v]) in[v] = changed = 1;
+            }
+        }
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        memcpy(live, live_out + (size_t)block->id * nvars, func->nvars);
+
+        IrInstr* instr = block->last;
+        while (instr != NULL) {
+            IrInstr* prev = instr->prev;
+            if (instr->var != NULL && is_scalar_local(instr->var)) {
+                int index = instr->var->index;
+                if (instr->op == IR_STORE) {
+                    if (!live[index]) {
+                        stats->dead_stores++;
+                        record_line(stats, instr->lineno);
+                        ir_remove(block, instr);
+                        removed = 1;
+                    }
+                    live[index] = 0;
+                } else if (instr->op == IR_LOAD) {
+                    live[index] = 1;
+                }
+            }
+            instr = prev;
+        }
+    }
+
+    free(live_in);
+    free(live_out);
+    free(live);
+    return removed;
+}
+
+/*
+    * Função: remove_dead_values
+    * -------------------------------
+    * Remove instruções puras cujo registrador de destino nunca é lido (ex: o
+    * cálculo do valor de um store morto ou de uma condição já resolvida).
+*/
+static int remove_dead_values(IrFunction* func, DceStats* stats) {
+    int nregs = func->nregs > 0 ? func->nregs : 1;
+    int* uses = (int*)malloc(sizeof(int) * nregs);
+    IrInstr** def_instr = (IrInstr**)malloc(sizeof(IrInstr*) * nregs);
+    int removed = 0;
+    int changed = 1;
+
+    while (changed) {
+        changed = 0;
+        memset(uses, 0, sizeof(int) * nregs);
+        memset(def_instr, 0, sizeof(IrInstr*) * nregs);
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                if (instr->dst >= 0) def_instr[instr->dst] = instr;
+                if (instr->src1 >= 0) uses[instr->src1]++;
+                if (instr->src2 >= 0) uses[instr->src2]++;
+                for (int i = 0; i < instr->nargs; i++) uses[instr->args[i]]++;
+            }
+        }
+
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            IrInstr* instr = block->first;
+            while (instr != NULL) {
+                IrInstr* next = instr->next;
+                if (is_pure(instr, def_instr) && uses[instr->dst] == 0) {
+                    stats->dead_values++;
+                    ir_remove(block, instr);
+                    removed = changed = 1;
+                }
+                instr = next;
+            }
+        }
+    }
+
+    free(uses);
+    free(def_instr);
+    return removed;
+}
+
+static int compare_ints(const void* a, const void* b) {
+    return *(const int*)a - *(const int*)b;
+}
+
+static void print_stats(IrFunction* func, DceStats* stats) {
+    int total = stats->unreachable + stats->dead_stores + stats->dead_values;
+    fprintf(COMPILE_OUT, "  %-16s %d inalcancaveis, %d stores mortos, %d valores mortos, %d desvios constantes",
+           func->name, stats->unreachable, stats->dead_stores, stats->dead_values, stats->branches);
+
+    if (total > 0 && stats->nlines > 0) {
+        qsort(stats->lines, stats->nlines, sizeof(int), compare_ints);
+        fprintf(COMPILE_OUT, " (linhas");
+        for (int i = 0; i < stats->nlines; i++) fprintf(COMPILE_OUT, "%s %d", i ? "," : "", stats->lines[i]);
+        fprintf(COMPILE_OUT, ")");
+    }
+    fprintf(COMPILE_OUT, "\n");
+}
+
+/*
+    * Função: ir_eliminate_dead_code
+    * -------------------------------
+    * Aplica as eliminações em cada função até que nenhuma delas altere mais a
+    * IR (um store removido pode tornar outro load, e logo outro store, morto).
+*/
+void ir_eliminate_dead_code(IrProgram* prog) {
+    fprintf(COMPILE_OUT, "Eliminacao de codigo morto:\n");
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        DceStats stats = { 0 };
+        int changed = 1;
+
+        while (changed) {
+            changed = 0;
+            changed |= fold_constant_branches(func, &stats);
+            changed |= remove_unreachable_blocks(func, &stats);
+            changed |= merge_straight_blocks(func);
+            changed |= remove_dead_stores(func, &stats);
+            changed |= remove_dead_values(func, &stats);
+        }
+
+        print_stats(func, &stats);
+        free(stats.lines);
+    }
+}
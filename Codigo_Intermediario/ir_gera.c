@@ -0,0 +1,442 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "./../Tabela_Simbulos/symbolTable.h"
+
+// Constantes de tipo (mesmas de semantic.c e codigo.c)
+#define INT_T 1
+#define CHAR_T 2
+#define VOID_T 4
+
+// Profundidade, na tabela de símbolos, do escopo das variáveis globais
+#define GLOBAL_SCOPE_DEPTH 1
+
+// Funções da análise semântica reaproveitadas
+int ast_type_to_data_type(AST_Node* type_node);
+
+// Estado da geração (função e bloco onde as instruções estão sendo emitidas)
+static IrProgram* ir_prog = NULL;
+static IrFunction* ir_func = NULL;
+static IrBlock* ir_block = NULL;
+static SymbolTableRef ir_symtab = NULL;
+
+static int lower_expr(AST_Node* node);
+static void lower_cond(AST_Node* node, IrBlock* if_true, IrBlock* if_false);
+static void lower_stmt(AST_Node* node);
+
+
+// --- Funções auxiliares ---
+
+/*
+    * Função: start_block
+    * -------------------------------
+    * Passa a emitir instruções em 'block' e o move para o final do layout,
+    * para que os blocos fiquem na ordem em que o código foi escrito.
+*/
+static void start_block(IrBlock* block) {
+    IrBlock** link = &ir_func->entry;
+    while (*link != block) link = &(*link)->next;
+    *link = block->next;
+    block->next = NULL;
+
+    IrBlock** tail = &ir_func->entry;
+    while (*tail != NULL) tail = &(*tail)->next;
+    *tail = block;
+
+    ir_block = block;
+}
+
+/*
+    * Função: emit
+    * -------------------------------
+    * Adiciona a instrução no bloco atual. Se o bloco já terminou (ex: depois
+    * de um retorne), o código seguinte é inalcançável e vai para um bloco novo.
+*/
+static IrInstr* emit(IrInstr* instr) {
+    if (ir_is_terminator(ir_block->last)) {
+        start_block(ir_new_block(ir_func));
+    }
+    ir_append(ir_block, instr);
+    return instr;
+}
+
+static int emit_const(int value, int lineno) {
+    IrInstr* instr = ir_new_instr(IR_CONST, lineno);
+    instr->dst = ir_new_reg(ir_func);
+    instr->imm = value;
+    return emit(instr)->dst;
+}
+
+static int emit_load(IrVar* var, int lineno) {
+    IrInstr* instr = ir_new_instr(IR_LOAD, lineno);
+    instr->dst = ir_new_reg(ir_func);
+    instr->var = var;
+    return emit(instr)->dst;
+}
+
+static void emit_store(IrVar* var, int value, int lineno) {
+    IrInstr* instr = ir_new_instr(IR_STORE, lineno);
+    instr->var = var;
+    instr->src1 = value;
+    emit(instr);
+}
+
+static void emit_jump(IrBlock* target, int lineno) {
+    IrInstr* instr = ir_new_instr(IR_JUMP, lineno);
+    instr->target1 = target;
+    emit(instr);
+}
+
+static void emit_branch(int cond, IrBlock* if_true, IrBlock* if_false, int lineno) {
+    IrInstr* instr = ir_new_instr(IR_BRANCH, lineno);
+    instr->src1 = cond;
+    instr->target1 = if_true;
+    instr->target2 = if_false;
+    emit(instr);
+}
+
+// Declara uma variável na função atual e no escopo atual da tabela de símbolos
+static IrVar* declare_var(const char* name, IrVarKind kind, int data_type) {
+    IrVar* var = ir_new_var(ir_func, ir_prog, name, kind, data_type);
+    symtab_insert_var(ir_symtab, name, data_type, var->index);
+    return var;
+}
+
+// Resolve um identificador para a variável da IR correspondente
+static IrVar* lookup_var(const char* name) {
+    SymbolRef symbol = symtab_lookup(ir_symtab, name);
+    if (symbol == NULL) {
+        fprintf(COMPILE_ERR, "Erro interno: variavel '%s' nao encontrada na geracao da IR.\n", name);
+        compile_abort(EXIT_FAILURE);
+    }
+
+    int depth = sym_get_variable_depth(symbol);
+    int index = sym_get_position(symbol);
+    sym_free_ref(symbol);
+
+    return depth == GLOBAL_SCOPE_DEPTH ? ir_prog->globals[index] : ir_func->vars[index];
+}
+
+// Converte o lexema do operador para o operador da IR
+static IrOperator binary_operator(const char* op) {
+    static const struct { const char* lexeme; IrOperator oper; } table[] = {
+        { "+", IR_ADD }, { "-", IR_SUB }, { "*", IR_MUL }, { "/", IR_DIV },
+        { "==", IR_EQ }, { "!=", IR_NE }, { "<", IR_LT }, { ">", IR_GT },
+        { "<=", IR_LE }, { ">=", IR_GE },
+    };
+    for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+        if (strcmp(op, table[i].lexeme) == 0) return table[i].oper;
+    }
+    fprintf(COMPILE_ERR, "Erro interno: operador binario desconhecido '%s'.\n", op);
+    compile_abort(EXIT_FAILURE);
+}
+
+static int is_logical(AST_Node* node, const char* op) {
+    return node->kind == AST_EXPR_BINARIA && strcmp(node->value, op) == 0;
+}
+
+
+// --- Expressões ---
+
+/*
+    * Função: lower_expr
+    * -------------------------------
+    * Gera a IR de uma expressão.
+    *
+    * Retorna: o registrador virtual com o valor da expressão.
+*/
+static int lower_expr(AST_Node* node) {
+    switch (node->kind) {
+        case AST_CONST_INT:
+            return emit_const(atoi(node->value), node->lineno);
+
+        case AST_CONST_CAR:
+            return emit_const(node->value[1], node->lineno);
+
+        case AST_EXPR_ID:
+            return emit_load(lookup_var(node->value), node->lineno);
+
+        case AST_EXPR_BINARIA:
+            if (is_logical(node, "E") || is_logical(node, "OU")) {
+                // Valor de 'e'/'ou' com curto-circuito, guardado em uma variável temporária
+                IrVar* result = ir_new_var(ir_func, ir_prog, "__logico", IR_VAR_LOCAL, INT_T);
+                IrBlock* if_true = ir_new_block(ir_func);
+                IrBlock* if_false = ir_new_block(ir_func);
+                IrBlock* join = ir_new_block(ir_func);
+
+                lower_cond(node, if_true, if_false);
+
+                start_block(if_true);
+                emit_store(result, emit_const(1, node->lineno), node->lineno);
+                emit_jump(join, node->lineno);
+
+                start_block(if_false);
+                emit_store(result, emit_const(0, node->lineno), node->lineno);
+                emit_jump(join, node->lineno);
+
+                start_block(join);
+                return emit_load(result, node->lineno);
+            } else {
+                int left = lower_expr(node->child1);
+                int right = lower_expr(node->child2);
+
+                IrInstr* instr = ir_new_instr(IR_BINOP, node->lineno);
+                instr->oper = binary_operator(node->value);
+                instr->src1 = left;
+                instr->src2 = right;
+                instr->dst = ir_new_reg(ir_func);
+                return emit(instr)->dst;
+            }
+
+        case AST_EXPR_UNARIA: {
+            int operand = lower_expr(node->child1);
+
+            IrInstr* instr = ir_new_instr(IR_UNOP, node->lineno);
+            instr->oper = strcmp(node->value, "-") == 0 ? IR_NEG : IR_NOT;
+            instr->src1 = operand;
+            instr->dst = ir_new_reg(ir_func);
+            return emit(instr)->dst;
+        }
+
+        case AST_COMANDO_ATRIB: {
+            int value = lower_expr(node->child2);
+            emit_store(lookup_var(node->child1->value), value, node->lineno);
+            return value;
+        }
+
+        case AST_EXPR_CHAMADA_FUNC: {
+            int nargs = 0;
+            for (AST_Node* arg = node->child2; arg != NULL; arg = arg->next) nargs++;
+
+            // Todos os argumentos são avaliados antes da chamada
+            int* args = nargs ? (int*)malloc(sizeof(int) * nargs) : NULL;
+            int i = 0;
+            for (AST_Node* arg = node->child2; arg != NULL; arg = arg->next) {
+                args[i++] = lower_expr(arg);
+            }
+
+            IrInstr* instr = ir_new_instr(IR_CALL, node->lineno);
+            instr->name = strdup(node->child1->value);
+            instr->args = args;
+            instr->nargs = nargs;
+            instr->dst = ir_new_reg(ir_func);
+            return emit(instr)->dst;
+        }
+
+        default:
+            fprintf(COMPILE_ERR, "Erro interno: expressao inesperada (%d) na linha %d.\n", node->kind, node->lineno);
+            compile_abort(EXIT_FAILURE);
+    }
+}
+
+/*
+    * Função: lower_cond
+    * -------------------------------
+    * Gera a IR de uma condição desviando para 'if_true' ou 'if_false'.
+    * 'e', 'ou' e '!' viram desvios com curto-circuito em vez de valores.
+*/
+static void lower_cond(AST_Node* node, IrBlock* if_true, IrBlock* if_false) {
+    if (is_logical(node, "E")) {
+        IrBlock* right = ir_new_block(ir_func);
+        lower_cond(node->child1, right, if_false);
+        start_block(right);
+        lower_cond(node->child2, if_true, if_false);
+    } else if (is_logical(node, "OU")) {
+        IrBlock* right = ir_new_block(ir_func);
+        lower_cond(node->child1, if_true, right);
+        start_block(right);
+        lower_cond(node->child2, if_true, if_false);
+    } else if (node->kind == AST_EXPR_UNARIA && strcmp(node->value, "!") == 0) {
+        lower_cond(node->child1, if_false, if_true);
+    } else {
+        emit_branch(lower_expr(node), if_true, if_false, node->lineno);
+    }
+}
+
+
+// --- Comandos ---
+
+static void lower_stmt_list(AST_Node* head) {
+    for (AST_Node* node = head; node != NULL; node = node->next) {
+        lower_stmt(node);
+    }
+}
+
+static void lower_stmt(AST_Node* node) {
+    if (node == NULL) return;
+
+    switch (node->kind) {
+        case AST_BLOCO:
+            symtab_enter_scope(ir_symtab);
+            for (AST_Node* decl = node->child1; decl != NULL; decl = decl->next) {
+                int data_type = ast_type_to_data_type(decl->child1);
+                for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+                    declare_var(id->value, IR_VAR_LOCAL, data_type);
+                }
+            }
+            lower_stmt_list(node->child2);
+            symtab_exit_scope(ir_symtab);
+            return;
+
+        case AST_COMANDO_ATRIB:
+        case AST_EXPR_CHAMADA_FUNC:
+            lower_expr(node);
+            return;
+
+        case AST_COMANDO_SE: {
+            IrBlock* then_block = ir_new_block(ir_func);
+            IrBlock* join = ir_new_block(ir_func);
+
+            lower_cond(node->child1, then_block, join);
+            start_block(then_block);
+            lower_stmt(node->child2);
+            emit_jump(join, node->lineno);
+            start_block(join);
+            return;
+        }
+
+        case AST_COMANDO_SE_SENAO: {
+            IrBlock* then_block = ir_new_block(ir_func);
+            IrBlock* else_block = ir_new_block(ir_func);
+            IrBlock* join = ir_new_block(ir_func);
+
+            lower_cond(node->child1, then_block, else_block);
+            start_block(then_block);
+            lower_stmt(node->child2);
+            emit_jump(join, node->lineno);
+            start_block(else_block);
+            lower_stmt(node->child3);
+            emit_jump(join, node->lineno);
+            start_block(join);
+            return;
+        }
+
+        case AST_COMANDO_ENQUANTO: {
+            IrBlock* header = ir_new_block(ir_func);
+            IrBlock* body = ir_new_block(ir_func);
+            IrBlock* exit_block = ir_new_block(ir_func);
+
+            emit_jump(header, node->lineno);
+            start_block(header);
+            lower_cond(node->child1, body, exit_block);
+            start_block(body);
+            lower_stmt(node->child2);
+            emit_jump(header, node->lineno);
+            start_block(exit_block);
+            return;
+        }
+
+        case AST_COMANDO_RETORNE: {
+            IrInstr* instr = ir_new_instr(IR_RET, node->lineno);
+            instr->src1 = lower_expr(node->child1);
+            emit(instr);
+            return;
+        }
+
+        case AST_COMANDO_LEIA: {
+            IrInstr* instr = ir_new_instr(IR_READ, node->lineno);
+            instr->dst = ir_new_reg(ir_func);
+            emit(instr);
+            emit_store(lookup_var(node->child1->value), instr->dst, node->lineno);
+            return;
+        }
+
+        case AST_COMANDO_ESCREVA: {
+            AST_Node* expr = node->child1;
+            if (expr->kind == AST_CONST_CADEIA) {
+                IrInstr* instr = ir_new_instr(IR_WRITE_STR, node->lineno);
+                instr->name = strdup(expr->value);
+                emit(instr);
+                return;
+            }
+
+            // Como em codigo.c, apenas variáveis do tipo car são escritas como caractere
+            IrOpcode op = IR_WRITE_INT;
+            if (expr->kind == AST_EXPR_ID && lookup_var(expr->value)->data_type == CHAR_T) {
+                op = IR_WRITE_CHAR;
+            }
+            IrInstr* instr = ir_new_instr(op, node->lineno);
+            instr->src1 = lower_expr(expr);
+            emit(instr);
+            return;
+        }
+
+        case AST_COMANDO_NOVALINHA:
+            emit(ir_new_instr(IR_NEWLINE, node->lineno));
+            return;
+
+        default:
+            return;
+    }
+}
+
+
+// --- Funções e programa ---
+
+/*
+    * Função: lower_function
+    * -------------------------------
+    * Gera a IR de uma função (ou de main quando 'decl' é NULL e 'body' é o
+    * bloco do programa). Parâmetros viram as primeiras variáveis da função.
+*/
+static void lower_function(AST_Node* decl, AST_Node* body) {
+    int is_main = decl == NULL;
+    const char* name = is_main ? "main" : decl->child2->value;
+    int return_type = is_main ? VOID_T : ast_type_to_data_type(decl->child1);
+
+    ir_func = ir_new_function(ir_prog, name, return_type, is_main);
+    ir_block = ir_new_block(ir_func);
+
+    symtab_enter_scope(ir_symtab);
+    if (!is_main) {
+        for (AST_Node* param = decl->child3; param != NULL; param = param->next) {
+            declare_var(param->child2->value, IR_VAR_PARAM, ast_type_to_data_type(param->child1));
+        }
+    }
+
+    lower_stmt(body);
+
+    // Função que termina sem retorne
+    if (!ir_is_terminator(ir_block->last)) {
+        emit(ir_new_instr(IR_RET, body->lineno));
+    }
+    symtab_exit_scope(ir_symtab);
+}
+
+/*
+    * Função: ir_generate_program
+    * -------------------------------
+    * Ponto de entrada: gera a IR do programa inteiro a partir da AST já
+    * verificada pela análise semântica.
+*/
+IrProgram* ir_generate_program(AST_Node* root) {
+    ir_prog = ir_new_program();
+    ir_symtab = symtab_create();
+
+    // Escopo das variáveis globais (profundidade GLOBAL_SCOPE_DEPTH)
+    symtab_enter_scope(ir_symtab);
+
+    for (AST_Node* decl = root->child1; decl != NULL; decl = decl->next) {
+        if (decl->kind == AST_DECL_VAR) {
+            int data_type = ast_type_to_data_type(decl->child1);
+            for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+                IrVar* var = ir_new_var(NULL, ir_prog, id->value, IR_VAR_GLOBAL, data_type);
+                symtab_insert_var(ir_symtab, id->value, data_type, var->index);
+            }
+        } else if (decl->kind == AST_DECL_FUNC) {
+            lower_function(decl, decl->child4);
+        }
+    }
+
+    lower_function(NULL, root->child2);
+
+    symtab_exit_scope(ir_symtab);
+    symtab_destroy(ir_symtab);
+    ir_symtab = NULL;
+
+    for (IrFunction* func = ir_prog->functions; func != NULL; func = func->next) {
+        ir_build_cfg(func);
+    }
+    return ir_prog;
+}
@@ -0,0 +1,281 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+
+// Constantes de tipo (mesmas de semantic.c e codigo.c)
+#define INT_T 1
+#define VOID_T 4
+
+// Flags de linha de comando
+int inline_enabled = 1;          // -fno-inline desliga o inliner
+int inline_threshold = 15;       // -finline-limit=N: tamanho máximo da função expandida
+
+// Limite de expansões por função, para que cadeias de chamadas não explodam o código
+#define INLINE_MAX_PER_FUNCTION 64
+
+// Com perfil, chamadas executadas mais vezes que a função que as contém aceitam um custo maior
+#define INLINE_HOT_FACTOR 4
+
+
+// --- Grafo de chamadas ---
+
+static int function_index(IrProgram* prog, IrFunction* func) {
+    int index = 0;
+    for (IrFunction* f = prog->functions; f != func; f = f->next) index++;
+    return index;
+}
+
+// Busca em profundidade no grafo de chamadas: 'from' chama, direta ou indiretamente, 'target'?
+static int reaches(IrProgram* prog, IrFunction* from, IrFunction* target, char* visited) {
+    for (IrBlock* block = from->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->op != IR_CALL) continue;
+
+            IrFunction* callee = ir_find_function(prog, instr->name);
+            if (callee == NULL) continue;
+            if (callee == target) return 1;
+
+            int index = function_index(prog, callee);
+            if (visited[index]) continue;
+            visited[index] = 1;
+            if (reaches(prog, callee, target, visited)) return 1;
+        }
+    }
+    return 0;
+}
+
+static int is_recursive(IrProgram* prog, IrFunction* func) {
+    int count = 0;
+    for (IrFunction* f = prog->functions; f != NULL; f = f->next) count++;
+
+    char* visited = (char*)calloc(count + 1, 1);
+    int result = reaches(prog, func, func, visited);
+    free(visited);
+    return result;
+}
+
+/*
+    * Função: function_cost
+    * -------------------------------
+    * Modelo de custo: número de instruções da IR do corpo, sem contar saltos
+    * incondicionais (que somem no layout). É comparado com inline_threshold.
+*/
+static int function_cost(IrFunction* func) {
+    int cost = 0;
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->op != IR_JUMP) cost++;
+        }
+    }
+    return cost;
+}
+
+
+// --- Expansão ---
+
+/*
+    * Função: inline_call
+    * -------------------------------
+    * Substitui a chamada 'call' (no bloco 'block' de 'caller') por uma cópia do
+    * corpo de 'callee':
+    *   - o bloco é dividido depois da chamada (bloco de continuação);
+    *   - parâmetros e locais da função chamada viram locais novas do chamador,
+    *     e os argumentos são guardados nos parâmetros copiados;
+    *   - cada ret vira "store resultado; jump continuação" e o registrador da
+    *     chamada passa a ser definido por um load do resultado.
+*/
+static void inline_call(IrProgram* prog, IrFunction* caller, IrBlock* block, IrInstr* call, IrFunction* callee) {
+    // Bloco de continuação com as instruções depois da chamada
+    IrBlock* cont = ir_new_block_after(caller, block);
+    while (call->next != NULL) {
+        IrInstr* instr = call->next;
+        call->next = instr->next;
+        if (instr->next) instr->next->prev = call;
+        else block->last = call;
+        ir_append(cont, instr);
+    }
+
+    // Variáveis da função chamada viram locais do chamador
+    IrVar** var_map = (IrVar**)malloc(sizeof(IrVar*) * (callee->nvars + 1));
+    for (int i = 0; i < callee->nvars; i++) {
+        char name[128];
+        snprintf(name, sizeof(name), "%s.%s", callee->name, callee->vars[i]->name);
+        var_map[i] = ir_new_var(caller, prog, name, IR_VAR_LOCAL, callee->vars[i]->data_type);
+    }
+    IrVar* result = ir_new_var(caller, prog, "__retorno", IR_VAR_LOCAL,
+                               callee->return_type == VOID_T ? INT_T : callee->return_type);
+
+    int* reg_map = (int*)malloc(sizeof(int) * (callee->nregs + 1));
+    for (int v = 0; v < callee->nregs; v++) reg_map[v] = ir_new_reg(caller);
+
+    // Blocos copiados ficam entre o bloco da chamada e a continuação
+    int nblocks = callee->nblocks;
+    IrBlock** block_map = (IrBlock**)calloc(nblocks + 1, sizeof(IrBlock*));
+    IrBlock* after = block;
+    for (IrBlock* src = callee->entry; src != NULL; src = src->next) {
+        block_map[src->id] = ir_new_block_after(caller, after);
+        after = block_map[src->id];
+
+        // Com perfil, a cópia recebe a fração das execuções do bloco que vem desta chamada
+        if (callee->entry->count > 0) after->count = src->count * block->count / callee->entry->count;
+    }
+    cont->count = block->count;
+
+    // Argumentos vão para os parâmetros copiados
+    for (int i = 0; i < call->nargs; i++) {
+        IrInstr* store = ir_new_instr(IR_STORE, call->lineno);
+        store->var = var_map[i];
+        store->src1 = call->args[i];
+        ir_insert_before(block, call, store);
+    }
+    IrInstr* enter = ir_new_instr(IR_JUMP, call->lineno);
+    enter->target1 = block_map[callee->entry->id];
+    ir_insert_before(block, call, enter);
+
+    int returns_value = 0;
+    for (IrBlock* src = callee->entry; src != NULL; src = src->next) {
+        IrBlock* dst_block = block_map[src->id];
+
+        for (IrInstr* instr = src->first; instr != NULL; instr = instr->next) {
+            if (instr->op == IR_RET) {
+                if (instr->src1 >= 0) {
+                    IrInstr* store = ir_new_instr(IR_STORE, instr->lineno);
+                    store->var = result;
+                    store->src1 = reg_map[instr->src1];
+                    ir_append(dst_block, store);
+                    returns_value = 1;
+                }
+                IrInstr* jump = ir_new_instr(IR_JUMP, instr->lineno);
+                jump->target1 = cont;
+                ir_append(dst_block, jump);
+                continue;
+            }
+
+            IrInstr* copy = ir_new_instr(instr->op, instr->lineno);
+            copy->oper = instr->oper;
+            copy->imm = instr->imm;
+            copy->dst = instr->dst >= 0 ? reg_map[instr->dst] : -1;
+            copy->src1 = instr->src1 >= 0 ? reg_map[instr->src1] : -1;
+            copy->src2 = instr->src2 >= 0 ? reg_map[instr->src2] : -1;
+            copy->name = instr->name ? strdup(instr->name) : NULL;
+            copy->nargs = instr->nargs;
+            if (instr->nargs > 0) {
+                copy->args = (int*)malloc(sizeof(int) * instr->nargs);
+                for (int i = 0; i < instr->nargs; i++) copy->args[i] = reg_map[instr->args[i]];
+            }
+            if (instr->var != NULL) {
+                copy->var = instr->var->kind == IR_VAR_GLOBAL ? instr->var : var_map[instr->var->index];
+            }
+            copy->target1 = instr->target1 ? block_map[instr->target1->id] : NULL;
+            copy->target2 = instr->target2 ? block_map[instr->target2->id] : NULL;
+            ir_append(dst_block, copy);
+        }
+    }
+
+    // O valor da chamada passa a ser o resultado guardado pelos retornos
+    IrInstr* value = ir_new_instr(returns_value ? IR_LOAD : IR_CONST, call->lineno);
+    value->dst = call->dst;
+    value->var = returns_value ? result : NULL;
+    if (cont->first) ir_insert_before(cont, cont->first, value);
+    else ir_append(cont, value);
+
+    ir_remove(block, call);
+
+    free(var_map);
+    free(reg_map);
+    free(block_map);
+    ir_build_cfg(caller);
+}
+
+/*
+    * Função: remove_uncalled_functions
+    * -------------------------------
+    * Funções que não são mais chamadas por ninguém (todas as chamadas foram
+    * expandidas) não precisam ser geradas.
+*/
+static void remove_uncalled_functions(IrProgram* prog) {
+    IrFunction** link = &prog->functions;
+    while (*link != NULL) {
+        IrFunction* func = *link;
+        int called = func->is_main;
+
+        for (IrFunction* other = prog->functions; other != NULL && !called; other = other->next) {
+            if (other == func) continue;
+            for (IrBlock* block = other->entry; block != NULL && !called; block = block->next) {
+                for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                    if (instr->op == IR_CALL && strcmp(instr->name, func->name) == 0) {
+                        called = 1;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (called) {
+            link = &func->next;
+        } else {
+            fprintf(COMPILE_OUT, "  %s removida (nenhuma chamada restante)\n", func->name);
+            *link = func->next;
+            func->next = NULL;
+            ir_free_function(func);
+        }
+    }
+}
+
+/*
+    * Função: ir_inline_functions
+    * -------------------------------
+    * Percorre as chamadas de cada função e expande as que passam no modelo de
+    * custo. As cópias são percorridas em seguida, então funções pequenas que
+    * chamam outras funções pequenas também são expandidas por completo.
+*/
+void ir_inline_functions(IrProgram* prog) {
+    fprintf(COMPILE_OUT, "Inlining (limite: %d instrucoes):\n", inline_threshold);
+
+    int total = 0;
+    for (IrFunction* caller = prog->functions; caller != NULL; caller = caller->next) {
+        int expanded = 0;
+
+        for (IrBlock* block = caller->entry; block != NULL; block = block->next) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                if (instr->op != IR_CALL) continue;
+
+                IrFunction* callee = ir_find_function(prog, instr->name);
+                if (callee == NULL || callee == caller) continue;
+
+                int cost = function_cost(callee);
+                int limit = inline_threshold;
+                if (caller->profiled && block->count == 0) {
+                    fprintf(COMPILE_OUT, "  %s em %s (linha %d): nao expandida, nunca executada no perfil\n",
+                           callee->name, caller->name, instr->lineno);
+                    continue;
+                }
+                if (caller->profiled && block->count > caller->entry->count) {
+                    limit = inline_threshold * INLINE_HOT_FACTOR;     // Chamada dentro de laço quente
+                }
+                if (is_recursive(prog, callee)) {
+                    fprintf(COMPILE_OUT, "  %s em %s (linha %d): nao expandida, funcao recursiva\n",
+                           callee->name, caller->name, instr->lineno);
+                    continue;
+                }
+                if (cost > limit) {
+                    fprintf(COMPILE_OUT, "  %s em %s (linha %d): nao expandida, custo %d\n",
+                           callee->name, caller->name, instr->lineno, cost);
+                    continue;
+                }
+                if (expanded >= INLINE_MAX_PER_FUNCTION) continue;
+
+                fprintf(COMPILE_OUT, "  %s em %s (linha %d): expandida, custo %d\n",
+                       callee->name, caller->name, instr->lineno, cost);
+                inline_call(prog, caller, block, instr, callee);
+                expanded++;
+                total++;
+                break;      // O bloco agora termina no salto para a cópia, que é o próximo bloco
+            }
+        }
+    }
+
+    if (total > 0) remove_uncalled_functions(prog);
+    fprintf(COMPILE_OUT, "  %d chamadas expandidas\n", total);
+}
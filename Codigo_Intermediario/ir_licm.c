@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+
+// Flag de linha de comando (-fno-licm desliga a movimentação de invariantes)
+int licm_enabled = 1;
+
+// Um laço natural: cabeçalho, blocos do corpo e o pré-cabeçalho criado para ele
+typedef struct {
+    IrBlock* header;
+    char* in_loop;       // in_loop[id] != 0 se o bloco pertence ao laço
+    int nblocks;
+    IrBlock* preheader;
+} IrLoop;
+
+
+// --- Laços ---
+
+/*
+    * Função: find_loop_body
+    * -------------------------------
+    * Marca os blocos do laço natural de 'header': o próprio cabeçalho e todos
+    * os blocos que alcançam uma aresta de retorno sem passar por ele.
+*/
+static int find_loop_body(IrFunction* func, IrBlock* header, char* in_loop) {
+    IrBlock** stack = (IrBlock**)malloc(sizeof(IrBlock*) * (func->nblocks + 1));
+    int top = 0;
+    int count = 1;
+
+    memset(in_loop, 0, func->nblocks + 1);
+    in_loop[header->id] = 1;
+
+    for (int i = 0; i < header->npreds; i++) {
+        IrBlock* pred = header->preds[i];
+        if (ir_dominates(header, pred) && !in_loop[pred->id]) {
+            in_loop[pred->id] = 1;
+            stack[top++] = pred;
+            count++;
+        }
+    }
+    while (top > 0) {
+        IrBlock* block = stack[--top];
+        for (int i = 0; i < block->npreds; i++) {
+            IrBlock* pred = block->preds[i];
+            if (pred->rpo_index >= 0 && !in_loop[pred->id]) {
+                in_loop[pred->id] = 1;
+                stack[top++] = pred;
+                count++;
+            }
+        }
+    }
+
+    free(stack);
+    return count;
+}
+
+static int is_loop_header(IrBlock* block) {
+    if (block->rpo_index < 0) return 0;
+    for (int i = 0; i < block->npreds; i++) {
+        if (ir_dominates(block, block->preds[i])) return 1;
+    }
+    return 0;
+}
+
+/*
+    * Função: make_preheader
+    * -------------------------------
+    * Garante um bloco que é o único predecessor do cabeçalho vindo de fora do
+    * laço. Se o único predecessor externo já termina com jump para o
+    * cabeçalho, ele é reaproveitado; senão um bloco novo é criado e os saltos
+    * de fora do laço são redirecionados para ele.
+*/
+static IrBlock* make_preheader(IrFunction* func, IrLoop* loop) {
+    IrBlock* header = loop->header;
+    IrBlock* outside = NULL;
+    int noutside = 0;
+
+    for (int i = 0; i < header->npreds; i++) {
+        if (!loop->in_loop[header->preds[i]->id]) {
+            outside = header->preds[i];
+            noutside++;
+        }
+    }
+    if (noutside == 1 && outside->last->op == IR_JUMP) return outside;
+
+    // Insere logo antes do cabeçalho no layout
+    IrBlock* preheader = ir_new_block(func);
+    IrBlock** link = &func->entry;
+    while (*link != preheader) link = &(*link)->next;
+    *link = NULL;
+    link = &func->entry;
+    while (*link != header) link = &(*link)->next;
+    preheader->next = header;
+    *link = preheader;
+    preheader->count = header->count;       // Perfil: executado se o laço é alcançado
+
+    IrInstr* jump = ir_new_instr(IR_JUMP, header->first ? header->first->lineno : 0);
+    jump->target1 = header;
+    ir_append(preheader, jump);
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block == preheader || loop->in_loop[block->id]) continue;
+        IrInstr* term = block->last;
+        if (term == NULL) continue;
+        if (term->target1 == header) term->target1 = preheader;
+        if (term->target2 == header) term->target2 = preheader;
+    }
+
+    ir_build_cfg(func);
+    return preheader;
+}
+
+
+// --- Invariantes ---
+
+// A variável é alterada dentro do laço (por store ou por uma chamada)?
+static int var_written_in_loop(IrProgram* prog, IrFunction* func, IrLoop* loop, IrVar* var) {
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (!loop->in_loop[block->id]) continue;
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->op == IR_STORE && instr->var == var) return 1;
+            if (instr->op == IR_CALL && ir_call_may_write(prog, instr, var)) return 1;
+        }
+    }
+    return 0;
+}
+
+// O registrador é definido fora do laço?
+static int defined_outside(IrBlock** def_block, IrLoop* loop, int reg) {
+    return def_block[reg] != NULL && !loop->in_loop[def_block[reg]->id];
+}
+
+/*
+    * Função: is_invariant_leaf
+    * -------------------------------
+    * Folhas que podem ser calculadas no pré-cabeçalho: constantes e loads de
+    * variáveis que o laço não altera.
+*/
+static int is_invariant_leaf(IrProgram* prog, IrFunction* func, IrLoop* loop, IrInstr* instr) {
+    if (instr->op == IR_CONST) return 1;
+    if (instr->op == IR_LOAD) return !var_written_in_loop(prog, func, loop, instr->var);
+    return 0;
+}
+
+/*
+    * Função: hoist_operand
+    * -------------------------------
+    * Faz o operando 'reg' de uma instrução que será movida ficar disponível
+    * no pré-cabeçalho. Uma folha com um único uso é movida; com mais usos é
+    * copiada com um registrador novo, para não tirar o valor dos outros usos.
+    *
+    * Retorna: o registrador a usar no pré-cabeçalho, ou -1 se não for possível.
+*/
+static int hoist_operand(IrProgram* prog, IrFunction* func, IrLoop* loop, IrBlock** def_block,
+                         IrInstr** def_instr, int* uses, int reg, int* moved) {
+    if (defined_outside(def_block, loop, reg)) return reg;
+
+    IrInstr* leaf = def_instr[reg];
+    if (leaf == NULL || !is_invariant_leaf(prog, func, loop, leaf)) return -1;
+
+    if (uses[reg] == 1) {
+        ir_unlink(def_block[reg], leaf);
+        ir_insert_before(loop->preheader, loop->preheader->last, leaf);
+        def_block[reg] = loop->preheader;
+        (*moved)++;
+        return reg;
+    }
+
+    IrInstr* copy = ir_new_instr(leaf->op, leaf->lineno);
+    copy->imm = leaf->imm;
+    copy->var = leaf->var;
+    copy->dst = ir_new_reg(func);
+    ir_insert_before(loop->preheader, loop->preheader->last, copy);
+    (*moved)++;
+    return copy->dst;
+}
+
+// Operações que podem ser executadas mesmo que o laço não rode (sem exceção)
+static int is_safe_to_speculate(IrInstr* instr, IrInstr** def_instr) {
+    if (instr->op == IR_UNOP) return 1;
+    if (instr->op != IR_BINOP) return 0;
+    if (instr->oper != IR_DIV) return 1;
+
+    // Divisão só com divisor constante diferente de zero e de -1
+    IrInstr* divisor = def_instr[instr->src2];
+    return divisor != NULL && divisor->op == IR_CONST && divisor->imm != 0 && divisor->imm != -1;
+}
+
+/*
+    * Função: hoist_loop
+    * -------------------------------
+    * Move para o pré-cabeçalho as operações do laço cujos operandos são
+    * invariantes, repetindo até que nada mais mude (uma operação movida pode
+    * tornar invariante a que usa o seu resultado).
+    *
+    * Retorna: quantas instruções foram movidas ou copiadas.
+*/
+static int hoist_loop(IrProgram* prog, IrFunction* func, IrLoop* loop) {
+    int nregs = func->nregs + 1;
+    IrBlock** def_block = (IrBlock**)calloc(nregs, sizeof(IrBlock*));
+    IrInstr** def_instr = (IrInstr**)calloc(nregs, sizeof(IrInstr*));
+    int* uses = (int*)calloc(nregs, sizeof(int));
+    int moved = 0;
+    int changed = 1;
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->dst >= 0) {
+                def_block[instr->dst] = block;
+                def_instr[instr->dst] = instr;
+            }
+            if (instr->src1 >= 0) uses[instr->src1]++;
+            if (instr->src2 >= 0) uses[instr->src2]++;
+            for (int i = 0; i < instr->nargs; i++) uses[instr->args[i]]++;
+        }
+    }
+
+    while (changed) {
+        changed = 0;
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            if (!loop->in_loop[block->id]) continue;
+
+            IrInstr* instr = block->first;
+            while (instr != NULL) {
+                IrInstr* next = instr->next;
+
+                if (is_safe_to_speculate(instr, def_instr)) {
+                    // Todos os operandos precisam ser invariantes antes de mexer em qualquer um
+                    int ok = 1;
+                    int operands[2] = { instr->src1, instr->src2 };
+                    for (int i = 0; i < 2 && ok; i++) {
+                        int reg = operands[i];
+                        if (reg < 0 || defined_outside(def_block, loop, reg)) continue;
+                        if (def_instr[reg] == NULL || !is_invariant_leaf(prog, func, loop, def_instr[reg])) ok = 0;
+                    }
+
+                    if (ok) {
+                        int same = instr->src1 == instr->src2;
+                        if (instr->src1 >= 0) {
+                            instr->src1 = hoist_operand(prog, func, loop, def_block, def_instr, uses, instr->src1, &moved);
+                        }
+                        if (same) {
+                            instr->src2 = instr->src1;
+                        } else if (instr->src2 >= 0) {
+                            instr->src2 = hoist_operand(prog, func, loop, def_block, def_instr, uses, instr->src2, &moved);
+                        }
+                        ir_unlink(block, instr);
+                        ir_insert_before(loop->preheader, loop->preheader->last, instr);
+                        def_block[instr->dst] = loop->preheader;
+                        moved++;
+                        changed = 1;
+                    }
+                }
+                instr = next;
+            }
+        }
+    }
+
+    free(def_block);
+    free(def_instr);
+    free(uses);
+    return moved;
+}
+
+/*
+    * Função: licm_function
+    * -------------------------------
+    * Trata os laços dos mais internos (menores) para os mais externos, para
+    * que um invariante possa subir vários níveis.
+*/
+static void licm_function(IrProgram* prog, IrFunction* func) {
+    ir_build_cfg(func);
+    ir_compute_dominators(func);
+
+    // Cabeçalhos na ordem do tamanho do laço
+    int nheaders = 0;
+    IrBlock** headers = (IrBlock**)malloc(sizeof(IrBlock*) * (func->nblocks + 1));
+    int* sizes = (int*)malloc(sizeof(int) * (func->nblocks + 1));
+    char* in_loop = (char*)malloc(func->nblocks + 1);
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (!is_loop_header(block)) continue;
+        int size = find_loop_body(func, block, in_loop);
+        int pos = nheaders++;
+        while (pos > 0 && sizes[pos - 1] > size) {
+            headers[pos] = headers[pos - 1];
+            sizes[pos] = sizes[pos - 1];
+            pos--;
+        }
+        headers[pos] = block;
+        sizes[pos] = size;
+    }
+    free(in_loop);
+
+    for (int h = 0; h < nheaders; h++) {
+        IrLoop loop;
+        loop.header = headers[h];
+
+        // O CFG muda a cada pré-cabeçalho criado: recalcula o corpo do laço
+        ir_build_cfg(func);
+        ir_compute_dominators(func);
+        int old_nblocks = func->nblocks;
+        loop.in_loop = (char*)malloc(old_nblocks + 1);
+        loop.nblocks = find_loop_body(func, loop.header, loop.in_loop);
+        loop.preheader = make_preheader(func, &loop);
+
+        // Um pré-cabeçalho novo ganha um id novo, fora do laço
+        loop.in_loop = (char*)realloc(loop.in_loop, func->nblocks + 1);
+        for (int id = old_nblocks; id <= func->nblocks; id++) loop.in_loop[id] = 0;
+
+        int moved = hoist_loop(prog, func, &loop);
+        if (moved > 0) {
+            fprintf(COMPILE_OUT, "  %-16s laco da linha %d: %d instrucoes movidas para o pre-cabecalho\n",
+                   func->name, loop.header->first ? loop.header->first->lineno : 0, moved);
+        }
+        free(loop.in_loop);
+    }
+
+    free(headers);
+    free(sizes);
+    ir_build_cfg(func);
+}
+
+/*
+    * Função: ir_hoist_loop_invariants
+    * -------------------------------
+    * Movimentação de código invariante de laço em todas as funções. Loads de
+    * globais só saem do laço se nenhuma chamada dentro dele pode alterá-las.
+*/
+void ir_hoist_loop_invariants(IrProgram* prog) {
+    fprintf(COMPILE_OUT, "Movimentacao de invariantes de laco:\n");
+    ir_compute_side_effects(prog);
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        licm_function(prog, func);
+    }
+}
@@ -0,0 +1,345 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+#include "./../Gera_Codigo/line_profile.h"
+
+// Constante de tipo (mesma de semantic.c e codigo.c)
+#define INT_T 1
+
+// Flags de linha de comando
+int profile_generate = 0;               // -fprofile-generate instrumenta o programa
+const char* profile_use_file = NULL;    // -fprofile-use[=arquivo] lê as contagens de uma execução
+
+// Marca das linhas de contagem na saída do programa instrumentado
+#define PROFILE_TAG "@perfil"
+
+// Maior cabeçalho de laço copiado para o fim do corpo na rotação
+#define ROTATE_MAX_INSTRS 8
+
+
+// --- Instrumentação ---
+
+/*
+    * Função: insert_counter
+    * -------------------------------
+    * Acrescenta "contador = contador + 1" no começo do bloco.
+*/
+static void insert_counter(IrFunction* func, IrBlock* block, IrVar* counter) {
+    int lineno = block->first ? block->first->lineno : 0;
+
+    IrInstr* load = ir_new_instr(IR_LOAD, lineno);
+    load->dst = ir_new_reg(func);
+    load->var = counter;
+    IrInstr* one = ir_new_instr(IR_CONST, lineno);
+    one->dst = ir_new_reg(func);
+    one->imm = 1;
+    IrInstr* add = ir_new_instr(IR_BINOP, lineno);
+    add->oper = IR_ADD;
+    add->dst = ir_new_reg(func);
+    add->src1 = load->dst;
+    add->src2 = one->dst;
+    IrInstr* store = ir_new_instr(IR_STORE, lineno);
+    store->var = counter;
+    store->src1 = add->dst;
+
+    IrInstr* first = block->first;
+    IrInstr* sequence[] = { load, one, add, store };
+    for (int i = 0; i < 4; i++) {
+        if (first != NULL) ir_insert_before(block, first, sequence[i]);
+        else ir_append(block, sequence[i]);
+    }
+}
+
+/*
+    * Função: insert_dump
+    * -------------------------------
+    * Antes do retorno de main, imprime uma linha "@perfil funcao bloco contagem"
+    * para cada contador (começando em uma linha nova).
+*/
+static void insert_dump(IrProgram* prog, IrFunction* main_func, IrBlock* block, IrInstr* ret,
+                        IrVar** counters, int ncounters) {
+    ir_insert_before(block, ret, ir_new_instr(IR_NEWLINE, ret->lineno));
+
+    int index = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        for (IrBlock* b = func->entry; b != NULL && index < ncounters; b = b->next, index++) {
+            char literal[256];
+            snprintf(literal, sizeof(literal), "\"%s %s %d \"", PROFILE_TAG, func->name, b->id);
+
+            IrInstr* label = ir_new_instr(IR_WRITE_STR, ret->lineno);
+            label->name = strdup(literal);
+            IrInstr* load = ir_new_instr(IR_LOAD, ret->lineno);
+            load->dst = ir_new_reg(main_func);
+            load->var = counters[index];
+            IrInstr* write = ir_new_instr(IR_WRITE_INT, ret->lineno);
+            write->src1 = load->dst;
+
+            ir_insert_before(block, ret, label);
+            ir_insert_before(block, ret, load);
+            ir_insert_before(block, ret, write);
+            ir_insert_before(block, ret, ir_new_instr(IR_NEWLINE, ret->lineno));
+        }
+    }
+}
+
+void ir_instrument_program(IrProgram* prog) {
+    int ncounters = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) ncounters++;
+    }
+
+    // Um contador global por bloco, na ordem em que as contagens são impressas
+    IrVar** counters = (IrVar**)malloc(sizeof(IrVar*) * (ncounters + 1));
+    int index = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            char name[128];
+            snprintf(name, sizeof(name), "__perfil_%s_%d", func->name, block->id);
+            counters[index] = ir_new_var(NULL, prog, name, IR_VAR_GLOBAL, INT_T);
+            insert_counter(func, block, counters[index]);
+            index++;
+        }
+    }
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        if (!func->is_main) continue;
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            if (block->last != NULL && block->last->op == IR_RET) {
+                insert_dump(prog, func, block, block->last, counters, ncounters);
+            }
+        }
+    }
+
+    fprintf(COMPILE_OUT, "Perfil: %d contadores inseridos (as contagens sao impressas ao fim da execucao)\n", ncounters);
+    free(counters);
+}
+
+
+// --- Leitura do perfil ---
+
+static IrBlock* find_block(IrFunction* func, int id) {
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->id == id) return block;
+    }
+    return NULL;
+}
+
+int ir_load_profile(IrProgram* prog, const char* filename) {
+    FILE* in = fopen(filename, "r");
+    if (in == NULL) {
+        fprintf(COMPILE_ERR, "Erro ao abrir o perfil '%s'\n", filename);
+        return 0;
+    }
+
+    char line[512];
+    int loaded = 0, ignored = 0;
+    while (fgets(line, sizeof(line), in) != NULL) {
+        // A linha pode começar com o resto da saída do programa
+        char* tag = strstr(line, PROFILE_TAG " ");
+        if (tag == NULL) continue;
+
+        char name[256];
+        int id;
+        long long count;
+        if (sscanf(tag + strlen(PROFILE_TAG), "%255s %d %lld", name, &id, &count) != 3) continue;
+
+        IrFunction* func = ir_find_function(prog, name);
+        IrBlock* block = func != NULL ? find_block(func, id) : NULL;
+        if (block == NULL) {
+            ignored++;
+            continue;
+        }
+        block->count = count;
+        func->profiled = 1;
+        loaded++;
+    }
+    fclose(in);
+
+    fprintf(COMPILE_OUT, "Perfil: %d contagens lidas de %s", loaded, filename);
+    if (ignored > 0) fprintf(COMPILE_OUT, " (%d ignoradas: o perfil nao corresponde ao programa)", ignored);
+    fprintf(COMPILE_OUT, "\n");
+    return 1;
+}
+
+
+// --- Rotação de laços ---
+
+/*
+    * Função: rotate_loop
+    * -------------------------------
+    * Troca o "jump cabeçalho" do fim do corpo ('latch') por uma cópia do
+    * cabeçalho, que termina no mesmo desvio condicional: cada iteração passa
+    * a ter um desvio só, e o cabeçalho original fica como guarda na entrada.
+    * Só vale quando os valores definidos no cabeçalho não são lidos fora dele
+    * (a cópia define registradores novos).
+*/
+static int rotate_loop(IrFunction* func, IrBlock* header, IrBlock* latch) {
+    int size = 0;
+    for (IrInstr* instr = header->first; instr != NULL; instr = instr->next) size++;
+    if (size > ROTATE_MAX_INSTRS) return 0;
+
+    int nregs = func->nregs > 0 ? func->nregs : 1;
+    int* reg_map = (int*)malloc(sizeof(int) * nregs);
+    for (int v = 0; v < nregs; v++) reg_map[v] = -1;
+    for (IrInstr* instr = header->first; instr != NULL; instr = instr->next) {
+        if (instr->op == IR_CALL) {
+            free(reg_map);
+            return 0;
+        }
+        if (instr->dst >= 0) reg_map[instr->dst] = instr->dst;
+    }
+
+    // Valores do cabeçalho lidos em outros blocos impedem a cópia
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block == header) continue;
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            for (int v = 0; v < nregs; v++) {
+                if (reg_map[v] >= 0 && ir_instr_uses(instr, v)) {
+                    free(reg_map);
+                    return 0;
+                }
+            }
+        }
+    }
+
+    for (int v = 0; v < nregs; v++) {
+        if (reg_map[v] >= 0) reg_map[v] = ir_new_reg(func);
+    }
+
+    ir_remove(latch, latch->last);
+    for (IrInstr* instr = header->first; instr != NULL; instr = instr->next) {
+        IrInstr* copy = ir_new_instr(instr->op, instr->lineno);
+        copy->oper = instr->oper;
+        copy->imm = instr->imm;
+        copy->var = instr->var;
+        copy->name = instr->name ? strdup(instr->name) : NULL;
+        copy->dst = instr->dst >= 0 ? reg_map[instr->dst] : -1;
+        copy->src1 = instr->src1 >= 0 && reg_map[instr->src1] >= 0 ? reg_map[instr->src1] : instr->src1;
+        copy->src2 = instr->src2 >= 0 && reg_map[instr->src2] >= 0 ? reg_map[instr->src2] : instr->src2;
+        copy->target1 = instr->target1;
+        copy->target2 = instr->target2;
+        ir_append(latch, copy);
+    }
+
+    free(reg_map);
+    ir_build_cfg(func);
+    return 1;
+}
+
+/*
+    * Função: rotate_hot_loops
+    * -------------------------------
+    * Um laço é quente quando a aresta de retorno é percorrida pelo menos
+    * tantas vezes quanto o laço é iniciado (em média, duas iterações ou mais).
+*/
+static int rotate_hot_loops(IrFunction* func) {
+    int rotated = 0;
+    int changed = 1;
+
+    while (changed) {
+        changed = 0;
+        ir_build_cfg(func);
+        ir_compute_dominators(func);
+
+        for (IrBlock* header = func->entry; header != NULL && !changed; header = header->next) {
+            if (header->rpo_index < 0 || header->last == NULL || header->last->op != IR_BRANCH) continue;
+
+            for (int i = 0; i < header->npreds && !changed; i++) {
+                IrBlock* latch = header->preds[i];
+                if (latch == header || !ir_dominates(header, latch)) continue;
+                if (latch->last == NULL || latch->last->op != IR_JUMP || latch->last->target1 != header) continue;
+
+                long long entries = header->count - latch->count;
+                if (latch->count == 0 || latch->count < entries) continue;
+
+                if (rotate_loop(func, header, latch)) {
+                    rotated++;
+                    changed = 1;
+                }
+            }
+        }
+    }
+    return rotated;
+}
+
+
+// --- Layout ---
+
+/*
+    * Função: move_cold_blocks
+    * -------------------------------
+    * Blocos nunca executados vão para o fim da função (na mesma ordem), para
+    * que o caminho quente fique contíguo. A entrada não se move.
+*/
+static int move_cold_blocks(IrFunction* func) {
+    if (func->entry->count == 0) return 0;      // Função nunca executada: nada a separar
+
+    IrBlock* hot_tail = func->entry;
+    IrBlock* cold_head = NULL;
+    IrBlock* cold_tail = NULL;
+    int moved = 0, pending = 0;
+
+    IrBlock* block = func->entry->next;
+    while (block != NULL) {
+        IrBlock* next = block->next;
+        block->next = NULL;
+        if (block->count == 0) {
+            if (cold_tail) cold_tail->next = block;
+            else cold_head = block;
+            cold_tail = block;
+            pending++;
+        } else {
+            hot_tail->next = block;
+            hot_tail = block;
+            moved += pending;       // Os frios vistos até aqui passam para depois deste bloco
+            pending = 0;
+        }
+        block = next;
+    }
+    hot_tail->next = cold_head;
+    return moved;
+}
+
+/*
+    * Função: ir_optimize_with_profile
+    * -------------------------------
+    * Roda por último (depois do LICM, que precisa dos laços no formato
+    * original com pré-cabeçalho) e só nas funções que têm perfil.
+*/
+void ir_optimize_with_profile(IrProgram* prog) {
+    fprintf(COMPILE_OUT, "Otimizacao guiada por perfil:\n");
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        if (!func->profiled) continue;
+
+        int rotated = rotate_hot_loops(func);
+        int moved = move_cold_blocks(func);
+        ir_build_cfg(func);
+
+        fprintf(COMPILE_OUT, "  %-16s entrada executada %lld vezes, %d lacos rotacionados, %d blocos frios movidos para o fim\n",
+               func->name, func->entry->count, rotated, moved);
+    }
+}
+
+
+// --- Perfil por linha ---
+
+/*
+    * Função: ir_report_line_profile
+    * -------------------------------
+    * Roda logo depois de ir_load_profile, sobre a IR ainda sem otimizações:
+    * as linhas contam as operações do programa como escrito.
+*/
+void ir_report_line_profile(IrProgram* prog) {
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                line_profile_add(func->name, instr->lineno, block->count, 0);
+            }
+        }
+    }
+
+    char title[300];
+    snprintf(title, sizeof(title), "Perfil por linha do fonte (operacoes da IR, contagens de %s):", profile_use_file);
+    line_profile_report(title, "Operacoes", 0);
+}
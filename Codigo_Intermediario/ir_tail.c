@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir.h"
+
+// Constantes de tipo (mesmas de semantic.c e codigo.c)
+#define INT_T 1
+
+// Flag de linha de comando (-fno-tail-calls desliga a transformação)
+int tail_calls_enabled = 1;
+
+// Como o valor da chamada recursiva é usado no retorno
+typedef enum {
+    SITE_NONE,
+    SITE_TAIL,          // retorne f(...)
+    SITE_ACCUMULATE,    // retorne x op f(...)  ou  retorne f(...) op x, com op associativo
+} TailSiteKind;
+
+static int is_self_call(IrFunction* func, const IrInstr* instr) {
+    return instr != NULL && instr->op == IR_CALL && strcmp(instr->name, func->name) == 0;
+}
+
+/*
+    * Função: can_skip_call
+    * -------------------------------
+    * Instrução entre a chamada e a operação que pode executar antes da
+    * chamada: pura, não usa o resultado da chamada e não lê globais (que a
+    * chamada poderia alterar). Ex: o load de 'b' em "retorne f(n-1) * b".
+*/
+static int can_skip_call(const IrInstr* instr, const IrInstr* call) {
+    switch (instr->op) {
+        case IR_CONST:
+            return 1;
+        case IR_LOAD:
+            return instr->var->kind != IR_VAR_GLOBAL;
+        case IR_COPY:
+        case IR_UNOP:
+        case IR_BINOP:
+            return instr->oper != IR_DIV && !ir_instr_uses(instr, call->dst);
+        default:
+            return 0;
+    }
+}
+
+/*
+    * Função: classify_site
+    * -------------------------------
+    * Reconhece os retornos que terminam em chamada recursiva. O bloco precisa
+    * terminar com "call; ret" ou "call; ...; binop; ret", onde "..." só tem
+    * instruções aceitas por can_skip_call.
+*/
+static TailSiteKind classify_site(IrFunction* func, IrBlock* block, IrInstr** call_out, IrInstr** op_out) {
+    IrInstr* ret = block->last;
+    if (ret == NULL || ret->op != IR_RET || ret->src1 < 0) return SITE_NONE;
+
+    IrInstr* prev = ret->prev;
+    if (is_self_call(func, prev) && prev->dst == ret->src1) {
+        *call_out = prev;
+        return SITE_TAIL;
+    }
+
+    if (prev != NULL && prev->op == IR_BINOP && prev->dst == ret->src1 &&
+        (prev->oper == IR_ADD || prev->oper == IR_MUL)) {
+        IrInstr* call = prev->prev;
+        while (call != NULL && call->op != IR_CALL) call = call->prev;
+        if (!is_self_call(func, call)) return SITE_NONE;
+        for (IrInstr* instr = call->next; instr != prev; instr = instr->next) {
+            if (!can_skip_call(instr, call)) return SITE_NONE;
+        }
+        if ((prev->src1 == call->dst) != (prev->src2 == call->dst)) {
+            *call_out = call;
+            *op_out = prev;
+            return SITE_ACCUMULATE;
+        }
+    }
+    return SITE_NONE;
+}
+
+static IrInstr* insert_load(IrFunction* func, IrBlock* block, IrInstr* pos, IrVar* var, int lineno) {
+    IrInstr* load = ir_new_instr(IR_LOAD, lineno);
+    load->dst = ir_new_reg(func);
+    load->var = var;
+    ir_insert_before(block, pos, load);
+    return load;
+}
+
+static IrInstr* insert_binop(IrFunction* func, IrBlock* block, IrInstr* pos, IrOperator oper,
+                             int a, int b, int lineno) {
+    IrInstr* binop = ir_new_instr(IR_BINOP, lineno);
+    binop->oper = oper;
+    binop->src1 = a;
+    binop->src2 = b;
+    binop->dst = ir_new_reg(func);
+    ir_insert_before(block, pos, binop);
+    return binop;
+}
+
+static void insert_store(IrBlock* block, IrInstr* pos, IrVar* var, int value, int lineno) {
+    IrInstr* store = ir_new_instr(IR_STORE, lineno);
+    store->var = var;
+    store->src1 = value;
+    ir_insert_before(block, pos, store);
+}
+
+/*
+    * Função: transform_function
+    * -------------------------------
+    * Troca as chamadas recursivas de cauda por "parâmetros = argumentos; jump"
+    * para o início do corpo. Quando os retornos têm a forma x op f(...) com o
+    * mesmo operador associativo (+ ou *), x é acumulado em uma variável local
+    * iniciada com o elemento neutro, e os demais retornos devolvem acc op valor.
+    *
+    * Retorna: quantas chamadas viraram saltos.
+*/
+static int transform_function(IrProgram* prog, IrFunction* func, int* accumulated, IrOperator* acc_oper) {
+    int sites = 0;
+    int accumulate = 0;
+    int mixed = 0;
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr *call = NULL, *op = NULL;
+        TailSiteKind kind = classify_site(func, block, &call, &op);
+        if (kind == SITE_NONE) continue;
+        sites++;
+        if (kind == SITE_ACCUMULATE) {
+            if (accumulate && op->oper != *acc_oper) mixed = 1;
+            *acc_oper = op->oper;
+            accumulate = 1;
+        }
+    }
+    if (sites == 0) return 0;
+
+    // Operadores diferentes não podem dividir o mesmo acumulador: só as chamadas de cauda puras mudam
+    if (mixed) accumulate = 0;
+
+    // Novo bloco de entrada, para que o corpo original possa receber os saltos
+    IrBlock* body = func->entry;
+    IrBlock* entry = ir_new_block(func);
+    IrBlock** link = &func->entry;
+    while (*link != entry) link = &(*link)->next;
+    *link = NULL;
+    entry->next = func->entry;
+    func->entry = entry;
+    entry->count = body->count;             // Perfil: as chamadas que ainda entram pela função
+
+    IrVar* acc = NULL;
+    if (accumulate) {
+        acc = ir_new_var(func, prog, "__acumulador", IR_VAR_LOCAL, INT_T);
+        IrInstr* identity = ir_new_instr(IR_CONST, body->first ? body->first->lineno : 0);
+        identity->dst = ir_new_reg(func);
+        identity->imm = *acc_oper == IR_MUL ? 1 : 0;
+        ir_append(entry, identity);
+        insert_store(entry, NULL, acc, identity->dst, identity->lineno);
+    }
+    IrInstr* enter = ir_new_instr(IR_JUMP, body->first ? body->first->lineno : 0);
+    enter->target1 = body;
+    ir_append(entry, enter);
+
+    int transformed = 0;
+    for (IrBlock* block = body; block != NULL; block = block->next) {
+        IrInstr *call = NULL, *op = NULL;
+        TailSiteKind kind = classify_site(func, block, &call, &op);
+        IrInstr* ret = block->last;
+
+        if (kind == SITE_TAIL || (kind == SITE_ACCUMULATE && accumulate)) {
+            // O novo código entra no lugar da operação (ou do ret), depois do valor x
+            IrInstr* pos = kind == SITE_ACCUMULATE ? op : ret;
+
+            if (kind == SITE_ACCUMULATE) {
+                // acc = acc op x
+                int other = op->src1 == call->dst ? op->src2 : op->src1;
+                IrInstr* old = insert_load(func, block, pos, acc, call->lineno);
+                IrInstr* sum = insert_binop(func, block, pos, op->oper, old->dst, other, call->lineno);
+                insert_store(block, pos, acc, sum->dst, call->lineno);
+            }
+
+            // Argumentos já estão em registradores: podem ir para os parâmetros em qualquer ordem
+            for (int i = 0; i < call->nargs; i++) {
+                insert_store(block, pos, func->vars[i], call->args[i], call->lineno);
+            }
+            IrInstr* jump = ir_new_instr(IR_JUMP, call->lineno);
+            jump->target1 = body;
+            ir_insert_before(block, pos, jump);
+
+            if (kind == SITE_ACCUMULATE) ir_remove(block, op);
+            ir_remove(block, ret);
+            ir_remove(block, call);
+            transformed++;
+        } else if (accumulate && ret != NULL && ret->op == IR_RET && ret->src1 >= 0) {
+            // Caso base: devolve acc op valor
+            IrInstr* old = insert_load(func, block, ret, acc, ret->lineno);
+            IrInstr* sum = insert_binop(func, block, ret, *acc_oper, old->dst, ret->src1, ret->lineno);
+            ret->src1 = sum->dst;
+        }
+    }
+
+    *accumulated = accumulate;
+    ir_build_cfg(func);
+    return transformed;
+}
+
+/*
+    * Função: ir_eliminate_tail_calls
+    * -------------------------------
+    * Aplica a transformação em todas as funções (exceto main, que não pode
+    * ser chamada) e imprime quantas chamadas recursivas viraram saltos.
+*/
+void ir_eliminate_tail_calls(IrProgram* prog) {
+    fprintf(COMPILE_OUT, "Recursao de cauda:\n");
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        if (func->is_main) continue;
+
+        int accumulated = 0;
+        IrOperator acc_oper = IR_ADD;
+        int transformed = transform_function(prog, func, &accumulated, &acc_oper);
+        if (transformed == 0) continue;
+
+        fprintf(COMPILE_OUT, "  %-16s %d chamadas viraram saltos", func->name, transformed);
+        if (accumulated) fprintf(COMPILE_OUT, " (acumulador: %s)", ir_operator_name(acc_oper));
+        fprintf(COMPILE_OUT, "\n");
+    }
+}
@@ -4,33 +4,41 @@
 #include <string.h>
 #include "./../AST/ast.h"
 #include "./../Tabela_Simbulos/symbolTable.h"
+#include "mips.h"
+#include "./../Relatorio/time_report.h"
 
 // Definição das constantes de tipo
 #define INT_T 1
 #define CHAR_T 2
 #define VOID_T 4
 
+// Profundidade, na tabela de símbolos, do escopo das variáveis globais
+#define GLOBAL_SCOPE_DEPTH 1
+
 // Declaração da raiz da AST e Tabela de Símbolos
 extern AST_Node* root_ast;
-extern SymbolTableRef global_symtab;
-
-// Lista ligada para variáveis globais serem armazenadasno scopo do programa
-typedef struct GlobalVarNode {
-    AST_Node* node;
-    struct GlobalVarNode* next;
-} GlobalVarNode;
-
-GlobalVarNode* global_var_list = NULL;
-GlobalVarNode* global_var_list_tail = NULL;
+SymbolTableRef global_symtab = NULL;   // Tabela preenchida pela análise semântica (main.c ou a biblioteca)
 
 // Buffers para acumular o código MIPS
 char data_section_buffer[4096] = "";        // Armazena .data (strings)
-char text_section_buffer[16384] = "";       // Armazena .text (instruções)
+char pending_text_line[512] = "";           // Linha da seção .text ainda sem '\n'
 int label_count = 0;                        // Contador para geração de rótulos únicos
 int is_global_scope_flag = 1;               // Flag para indicar se estamos no escopo global
 int current_var_offset = 0;                 // Offset atual para variáveis locais
 int within_function = 0;                    // Flag para indicar se estamos dentro de uma função
-int blocos_func = 0;                        // Contador de blocos dentro de funções
+int global_var_offset = 0;                  // Offset da próxima variável global a partir de __globais
+
+// Pool de cadeias constantes: cada texto distinto recebe um único rótulo em .data
+#define STRING_POOL_BUCKETS 64
+#define OUTPUT_RUN_MAX 400                  // Tamanho máximo de uma cadeia formada por escritas juntadas
+
+typedef struct PooledString {
+    char* literal;                          // Cadeia com aspas, como escrita no .asciiz
+    char* label;
+    struct PooledString* next;
+} PooledString;
+
+static PooledString* string_pool[STRING_POOL_BUCKETS];
 
 
 // Funções
@@ -38,22 +46,33 @@ void generate_mips_code(const char *output_filename);
 void generate_node_code(AST_Node *node);
 void generate_list_code(AST_Node* head);
 int generate_expression(AST_Node *node); 
+void generate_condition(AST_Node *node, const char *label, int jump_if);
 char* new_label(); 
 void append_text(const char* format, ...);
 void append_data(const char* format, ...);
 int ast_type_to_data_type(AST_Node* type_node);
-void add_global_var_node(AST_Node* node);
+int count_list_items(AST_Node* head);
+void declare_global_var(AST_Node* node);
+void write_global_vars(FILE* mips_file);
+int compute_frame_slots(AST_Node* node);
+const char* string_pool_label(const char* literal);
+void string_pool_clear(void);
+static AST_Node* generate_output_run(AST_Node* first);
+static void generate_statement_code(AST_Node *node);
 
 
 /*
     * Função: load_variable_address
     * -------------------------------
-    * Gera o código MIPS para atualizar o registrador para apontar para o frame
-    * pointer a cima de omde a variável está. Além disso, retorna o offset da variável
+    * Retorna o offset da variável e, em 'base_reg', o registrador base do acesso.
+    * Variáveis de uma função (parâmetros e locais de qualquer bloco aninhado) vivem
+    * em um único frame e são acessadas por $fp. Variáveis globais ficam na seção
+    * .data, a partir do rótulo __globais, e são acessadas por $gp. Nenhum código
+    * precisa ser gerado: o acesso é sempre uma única instrução lw/sw.
     *
     * Retorna: offset da variável em caso de sucesso, -1 em caso de erro.
 */
-int load_variable_address(AST_Node *node) {
+int load_variable_address(AST_Node *node, const char **base_reg) {
     const char *var_name;
 
     // --- Determinando da Estrutura (Cada kind armazena a informação em lugares diferentes) ---
@@ -62,7 +81,7 @@ int load_variable_address(AST_Node *node) {
     } else if (node->kind == AST_COMANDO_ATRIB || node->kind == AST_COMANDO_LEIA) {
         var_name = node->child1->value;
     } else {
-        fprintf(stderr, "Erro de AST: load_variable_address chamada com tipo de nó invalido (%d).\n", node->kind);
+        fprintf(COMPILE_ERR, "Erro de AST: load_variable_address chamada com tipo de nó invalido (%d).\n", node->kind);
         return -1;
     }
     
@@ -70,97 +89,106 @@ int load_variable_address(AST_Node *node) {
     SymbolRef symbol = symtab_lookup(global_symtab, var_name);
     
     if (symbol == NULL) {
-        fprintf(stderr, "Erro de acesso: Variavel '%s' nao declarada.\n", var_name);
+        fprintf(COMPILE_ERR, "Erro de acesso: Variavel '%s' nao declarada.\n", var_name);
         return -1;
     }
 
-    int var_depth = sym_get_variable_depth(symbol);    // Obtendo a profundidade da variável
-    int tree_depth = symtab_get_depth(global_symtab);  // Obtendo a profundidade atual da árvore de símbolos
     int offset_id = sym_get_position(symbol);          // Obtendo o offset da variável
+    int var_depth = sym_get_variable_depth(symbol);    // Obtendo a profundidade da variável
     
     // Liberando a referência logo após obter os dados
     sym_free_ref(symbol); 
 
-    // Calculando a diferença de profundidade
-    int depth_difference = tree_depth - var_depth;
-
-    append_text("\n  # Acesso a variavel aninhada/global (%s)\n", var_name);
-
-    // Geração do Código MIPS para Achar o Frame Pointer (FP) Correto
-    
-    // O registrador $t1 será o nosso ponteiro de frame (Base FP)
-    // Começa apontando para o FP do escopo atual.
-    append_text("  move $t1, $fp\n");
-    
-    // Se a variável for aninhada (depth_difference > 0), saltamos para o FP correto.
-    if (depth_difference > 0) {
-        for (int i = 0; i < depth_difference; i++) {
-            // Carrega o valor do antigo FP na pilha
-            append_text("  lw $t1, 0($t1)\n"); 
-        }
-    } else if (depth_difference < 0) {
-        // Tentativa de acessar um escopo que não existe
-        fprintf(stderr, "Erro critico: Profundidade da variavel e maior que a profundidade atual.\n");
-        return -1;
-    }
-    
+    *base_reg = (var_depth == GLOBAL_SCOPE_DEPTH) ? "$gp" : "$fp";
     return offset_id;
 }
 
 /*
-    * Função: process_global_vars
+    * Função: compute_frame_slots
     * -------------------------------
-    * Processa todas as variáveis globais armazenadas na lista ligada.
-    * Chama generate_node_code para cada nó AST_DECL_VAR, que contem
-    * a lógica para adicionar a variável no escopo.
+    * Passo de layout do frame: calcula quantas posições de 4 bytes as variáveis
+    * declaradas em blocos dentro de 'node' precisam no frame da função. Blocos
+    * irmãos (ex: ENTAO e SENAO) nunca estão vivos ao mesmo tempo, então reutilizam
+    * as mesmas posições; blocos aninhados ficam abaixo das posições do bloco pai.
+    *
+    * Retorna: número de posições necessárias.
 */
-void process_global_vars() {
-    GlobalVarNode* current = global_var_list;
-    
-    // Processando os nós armazenados um por um
-    while (current != NULL) {
-        generate_node_code(current->node); 
+int compute_frame_slots(AST_Node* node) {
+    if (node == NULL) return 0;
 
-        // Avança e libera o nó da lista
-        GlobalVarNode* temp = current;
-        current = current->next;
-        free(temp); 
-    }
+    switch (node->kind) {
+        case AST_BLOCO: {
+            int own_slots = 0;
+            for (AST_Node* decl = node->child1; decl != NULL; decl = decl->next) {
+                for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+                    own_slots++;
+                }
+            }
+
+            // O comando mais exigente define o espaço extra dos blocos internos
+            int inner_slots = 0;
+            for (AST_Node* cmd = node->child2; cmd != NULL; cmd = cmd->next) {
+                int slots = compute_frame_slots(cmd);
+                if (slots > inner_slots) inner_slots = slots;
+            }
+            return own_slots + inner_slots;
+        }
+
+        case AST_COMANDO_SE_SENAO: {
+            int entao_slots = compute_frame_slots(node->child2);
+            int senao_slots = compute_frame_slots(node->child3);
+            return entao_slots > senao_slots ? entao_slots : senao_slots;
+        }
 
-    // Reseta a lista após o processamento
-    global_var_list = NULL;
-    global_var_list_tail = NULL;
+        case AST_COMANDO_SE:
+        case AST_COMANDO_ENQUANTO:
+            return compute_frame_slots(node->child2);
+
+        default:
+            return 0;
+    }
 }
 
 /*
-    * Função: add_global_var_node
+    * Função: declare_global_var
     * -------------------------------
-    * Adiciona um nó AST_DECL_VAR à lista ligada de variáveis globais.
-    * Esses nós serão processados posteriormente na função process_global_vars.
+    * Insere as variáveis de um nó AST_DECL_VAR global no escopo global da tabela
+    * de símbolos. Cada uma recebe uma palavra na seção .data (emitida depois por
+    * write_global_vars), e sua posição é o offset a partir do rótulo __globais.
 */
-void add_global_var_node(AST_Node* node) {
-    GlobalVarNode* new_node = (GlobalVarNode*)malloc(sizeof(GlobalVarNode));
-    if (new_node == NULL) {
-        perror("Falha ao alocar memoria para variavel global");
-        return;
+void declare_global_var(AST_Node* node) {
+    AST_Node* current_id_node = node->child2;
+    int data_type = ast_type_to_data_type(node->child1);
+
+    while (current_id_node != NULL) {
+        symtab_insert_var(global_symtab, current_id_node->value, data_type, global_var_offset);
+        global_var_offset += 4;
+        current_id_node = current_id_node->next;
     }
-    new_node->node = node;
-    new_node->next = NULL;
+}
 
-    if (global_var_list == NULL) {
-        global_var_list = new_node;
-        global_var_list_tail = new_node;
-    } else {
-        global_var_list_tail->next = new_node;
-        global_var_list_tail = new_node;
+/*
+    * Função: write_global_vars
+    * -------------------------------
+    * Escreve na seção .data uma palavra rotulada para cada variável global,
+    * na mesma ordem em que declare_global_var atribuiu os offsets.
+*/
+void write_global_vars(FILE* mips_file) {
+    fprintf(mips_file, "__globais:\n");
+    for (AST_Node* decl = root_ast->child1; decl != NULL; decl = decl->next) {
+        if (decl->kind != AST_DECL_VAR) continue;
+        for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+            fprintf(mips_file, "__g_%s: .word 0\n", id->value);
+        }
     }
 }
 
-
 /*
     * Função: append_text
     * -------------------------------
-    * Adiciona uma linha no arquivo do código MIPS no campo .text
+    * Adiciona uma linha no arquivo do código MIPS no campo .text. Cada linha
+    * completa é separada em operação e operandos e guardada na lista
+    * text_section, sobre a qual os otimizadores trabalham.
 */
 void append_text(const char* format, ...) {
     va_list args;
@@ -169,12 +197,22 @@ void append_text(const char* format, ...) {
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
     
-    // Concatena no buffer global
-    if (strlen(text_section_buffer) + strlen(buffer) < sizeof(text_section_buffer)) {
-        strcat(text_section_buffer, buffer);
-    } else {
-        fprintf(stderr, "Buffer da seção .text estourou!\n");
+    char* line = buffer;
+    char* newline;
+    while ((newline = strchr(line, '\n')) != NULL) {
+        *newline = '\0';
+
+        // Completa a linha que ficou pendente na chamada anterior
+        if (pending_text_line[0] != '\0') {
+            strncat(pending_text_line, line, sizeof(pending_text_line) - strlen(pending_text_line) - 1);
+            mips_list_append_line(&text_section, pending_text_line);
+            pending_text_line[0] = '\0';
+        } else {
+            mips_list_append_line(&text_section, line);
+        }
+        line = newline + 1;
     }
+    strncat(pending_text_line, line, sizeof(pending_text_line) - strlen(pending_text_line) - 1);
 }
 
 /*
@@ -185,6 +223,11 @@ void append_text(const char* format, ...) {
 void generate_list_code(AST_Node* head) {
     AST_Node* current = head;
     while (current != NULL) {
+        AST_Node* merged = generate_output_run(current);
+        if (merged != NULL) {
+            current = merged->next;
+            continue;
+        }
         generate_node_code(current);
         current = current->next;
     }
@@ -206,7 +249,7 @@ void append_data(const char* format, ...) {
     if (strlen(data_section_buffer) + strlen(buffer) < sizeof(data_section_buffer)) {
         strcat(data_section_buffer, buffer);
     } else {
-        fprintf(stderr, "Buffer da seção .data estourou!\n");
+        fprintf(COMPILE_ERR, "Buffer da seção .data estourou!\n");
     }
 }
 
@@ -221,6 +264,120 @@ char* new_label() {
     return label;
 }
 
+/*
+    * Função: string_pool_label
+    * -------------------------------
+    * Rótulo da cadeia 'literal' (com aspas) na seção .data. Cadeias iguais
+    * compartilham a mesma entrada: a primeira ocorrência cria o .asciiz e as
+    * seguintes só encontram o rótulo na tabela hash.
+*/
+const char* string_pool_label(const char* literal) {
+    unsigned hash = 5381;
+    for (const char* c = literal; *c != '\0'; c++) hash = hash * 33 + (unsigned char)*c;
+    hash %= STRING_POOL_BUCKETS;
+
+    for (PooledString* entry = string_pool[hash]; entry != NULL; entry = entry->next) {
+        if (strcmp(entry->literal, literal) == 0) return entry->label;
+    }
+
+    PooledString* entry = (PooledString*)malloc(sizeof(PooledString));
+    entry->literal = strdup(literal);
+    entry->label = new_label();
+    entry->next = string_pool[hash];
+    string_pool[hash] = entry;
+
+    append_data("%s: .asciiz %s\n", entry->label, literal);
+    return entry->label;
+}
+
+/*
+    * Função: string_pool_clear
+    * -------------------------------
+    * Esvazia o pool. Chamada junto com a limpeza da seção .data.
+*/
+void string_pool_clear(void) {
+    for (int i = 0; i < STRING_POOL_BUCKETS; i++) {
+        while (string_pool[i] != NULL) {
+            PooledString* entry = string_pool[i];
+            string_pool[i] = entry->next;
+            free(entry->literal);
+            free(entry->label);
+            free(entry);
+        }
+    }
+}
+
+/*
+    * Função: append_output_text
+    * -------------------------------
+    * Acrescenta a 'buffer' (conteúdo de uma cadeia, sem aspas) o texto que um
+    * comando de escrita com valor conhecido produz: a própria cadeia, o número
+    * de uma constante (caracteres constantes saem como número, como em
+    * generate_node_code) ou a quebra de linha de novalinha.
+    *
+    * Retorna: 1 se o comando tem texto conhecido e coube no buffer.
+*/
+static int append_output_text(AST_Node* node, char* buffer, size_t size) {
+    char piece[OUTPUT_RUN_MAX];
+
+    if (node->kind == AST_COMANDO_NOVALINHA) {
+        snprintf(piece, sizeof(piece), "\\n");
+    } else if (node->kind != AST_COMANDO_ESCREVA) {
+        return 0;
+    } else if (node->child1->kind == AST_CONST_CADEIA) {
+        const char* literal = node->child1->value;
+        size_t len = strlen(literal);
+        if (len < 2 || len - 2 >= sizeof(piece)) return 0;
+        snprintf(piece, sizeof(piece), "%.*s", (int)(len - 2), literal + 1);
+    } else if (node->child1->kind == AST_CONST_INT) {
+        snprintf(piece, sizeof(piece), "%d", atoi(node->child1->value));
+    } else if (node->child1->kind == AST_CONST_CAR) {
+        snprintf(piece, sizeof(piece), "%d", node->child1->value[1]);
+    } else {
+        return 0;
+    }
+
+    if (strlen(buffer) + strlen(piece) >= size) return 0;
+    strcat(buffer, piece);
+    return 1;
+}
+
+/*
+    * Função: generate_output_run
+    * -------------------------------
+    * Junta escritas seguidas com texto conhecido em tempo de compilação (ex:
+    * escreva "a"; escreva "b"; novalinha;) em uma única cadeia e uma única
+    * syscall.
+    *
+    * Retorna: o último comando consumido, ou NULL se não há pelo menos dois
+    * comandos para juntar (o primeiro é gerado normalmente).
+*/
+static AST_Node* generate_output_run(AST_Node* first) {
+    char text[OUTPUT_RUN_MAX] = "";
+    AST_Node* last = NULL;
+    int count = 0;
+
+    for (AST_Node* node = first; node != NULL; node = node->next) {
+        if (!append_output_text(node, text, sizeof(text))) break;
+        last = node;
+        count++;
+    }
+    if (count < 2) return NULL;
+
+    char literal[OUTPUT_RUN_MAX + 2];
+    snprintf(literal, sizeof(literal), "\"%s\"", text);
+
+    // A escrita juntada fica na linha do primeiro comando
+    int saved_line = mips_source_line;
+    mips_source_line = first->lineno;
+    append_text("\n  # Comando: Escreva (%d escritas juntadas)\n", count);
+    append_text("  li $v0, 4\n");
+    append_text("  la $a0, %s\n", string_pool_label(literal));
+    append_text("  syscall\n");
+    mips_source_line = saved_line;
+    return last;
+}
+
 /*
     * Função: generate_expression
     * -------------------------------
@@ -245,17 +402,32 @@ int generate_expression(AST_Node *node) {
             {
                 append_text("\n  # Expressao: Variavel ID (%s)\n", node->value);
 
-                int offset_id = load_variable_address(node);
+                const char* base_id;
+                int offset_id = load_variable_address(node, &base_id);
                 if (offset_id == -1) {
                     return -1;
                 }
 
-                append_text("  lw $t0, %d($t1)\n", offset_id); 
+                append_text("  lw $t0, %d(%s)\n", offset_id, base_id); 
                 return 0;
             }
 
         case AST_EXPR_BINARIA:
             append_text("\n  # Expressao: Binaria %s\n", node->value);
+
+            // 'e' e 'ou' com curto-circuito: o valor 0/1 sai dos desvios
+            if (strcmp(node->value, "E") == 0 || strcmp(node->value, "OU") == 0) {
+                char *label_falso = new_label();
+                char *label_fim = new_label();
+
+                generate_condition(node, label_falso, 0);
+                append_text("  li $t0, 1\n");
+                append_text("  j %s\n", label_fim);
+                append_text("%s:\n", label_falso);
+                append_text("  li $t0, 0\n");
+                append_text("%s:\n", label_fim);
+                return 0;
+            }
             
             // Parte Esquerda da expressão
             generate_expression(node->child1);    // Chama AST_EXPR_ID
@@ -291,6 +463,12 @@ int generate_expression(AST_Node *node) {
                 append_text("  slt $t0, $t0, $t1\n");       // $t0 = (t0 < t1) ? 1 : 0
             } else if (strcmp(node->value, "<") == 0) {
                 append_text("  slt $t0, $t1, $t0\n");
+            } else if (strcmp(node->value, "<=") == 0) {
+                append_text("  slt $t0, $t0, $t1\n");       // $t0 = (direita < esquerda)
+                append_text("  xori $t0, $t0, 1\n");        // esquerda <= direita  ==  !(direita < esquerda)
+            } else if (strcmp(node->value, ">=") == 0) {
+                append_text("  slt $t0, $t1, $t0\n");       // $t0 = (esquerda < direita)
+                append_text("  xori $t0, $t0, 1\n");
             }
             append_text("  addi $sp, $sp, 4\n");
             return 0;
@@ -310,7 +488,7 @@ int generate_expression(AST_Node *node) {
                 // SLTIU $t0, $t0, 1 -> $t0 = ($t0 < 1) ? 1 : 0. Isso nega 0 e torna não-zeros em 0.
                 append_text("  sltiu $t0, $t0, 1\n"); 
             } else {
-                fprintf(stderr, "Erro de compilacao: Operador unario desconhecido '%s'.\n", node->value);
+                fprintf(COMPILE_ERR, "Erro de compilacao: Operador unario desconhecido '%s'.\n", node->value);
                 return -1;
             }
             return 0;
@@ -319,18 +497,17 @@ int generate_expression(AST_Node *node) {
             generate_expression(node->child2); 
             append_text("\n  # Comando: Atribuicao %s = \n", node->child1->value);
             
-            int offset_atrib = load_variable_address(node);
+            const char* base_atrib;
+            int offset_atrib = load_variable_address(node, &base_atrib);
             if (offset_atrib == -1) {
                 return -1;
             }
             
             // Salva o valor no offset obtido
-            append_text("  sw $t0, %d($t1)\n", offset_atrib);
+            append_text("  sw $t0, %d(%s)\n", offset_atrib, base_atrib);
             return 0;
 
         case AST_EXPR_CHAMADA_FUNC:
-            int aux_blocos_func = blocos_func;
-            blocos_func = 0;
             char* func_name_call = node->child1->value;
             AST_Node* actual_args = node->child2;
             
@@ -376,7 +553,6 @@ int generate_expression(AST_Node *node) {
             
             // O valor de retorno está em $v0. Move para $t0 para ser usado na expressão.
             append_text("  move $t0, $v0\n");
-            blocos_func = aux_blocos_func;
             return 0;
             
         default:
@@ -385,19 +561,116 @@ int generate_expression(AST_Node *node) {
 }
 
 
+/*
+    * Função: relational_branch
+    * -------------------------------
+    * Mnemônico do desvio que salta quando "esquerda op direita" vale 'jump_if'.
+    *
+    * Retorna: o mnemônico, ou NULL se 'op' não é relacional.
+*/
+static const char* relational_branch(const char *op, int jump_if) {
+    static const char *branches[][3] = {
+        { "==", "beq", "bne" }, { "!=", "bne", "beq" },
+        { "<",  "blt", "bge" }, { ">=", "bge", "blt" },
+        { ">",  "bgt", "ble" }, { "<=", "ble", "bgt" },
+    };
+    for (size_t i = 0; i < sizeof(branches) / sizeof(branches[0]); i++) {
+        if (strcmp(op, branches[i][0]) == 0) return jump_if ? branches[i][1] : branches[i][2];
+    }
+    return NULL;
+}
+
+/*
+    * Função: generate_condition
+    * -------------------------------
+    * Gera o teste de uma condição de se/enquanto sem calcular o valor 0/1:
+    * salta para 'label' quando a condição vale 'jump_if' e segue em frente
+    * caso contrário. Comparações viram um único desvio (blt, bge, ...), e
+    * 'e'/'ou' param no primeiro operando que decide o resultado.
+*/
+void generate_condition(AST_Node *node, const char *label, int jump_if) {
+    if (node->kind == AST_EXPR_UNARIA && strcmp(node->value, "!") == 0) {
+        generate_condition(node->child1, label, !jump_if);
+        return;
+    }
+
+    if (node->kind == AST_EXPR_BINARIA) {
+        int is_and = strcmp(node->value, "E") == 0;
+        if (is_and || strcmp(node->value, "OU") == 0) {
+            if (is_and != jump_if) {
+                // 'e' falso ou 'ou' verdadeiro: qualquer operando decide sozinho
+                generate_condition(node->child1, label, jump_if);
+                generate_condition(node->child2, label, jump_if);
+            } else {
+                // 'e' verdadeiro ou 'ou' falso: o primeiro operando pode encerrar o teste
+                char *label_fim = new_label();
+                generate_condition(node->child1, label_fim, !jump_if);
+                generate_condition(node->child2, label, jump_if);
+                append_text("%s:\n", label_fim);
+            }
+            return;
+        }
+
+        const char *branch = relational_branch(node->value, jump_if);
+        if (branch != NULL) {
+            append_text("\n  # Condicao: %s\n", node->value);
+            generate_expression(node->child1);
+
+            AST_Node *right = node->child2;
+            if (right->kind == AST_CONST_INT && atoi(right->value) == 0 &&
+                strcmp(branch, "beq") != 0 && strcmp(branch, "bne") != 0) {
+                append_text("  %sz $t0, %s\n", branch, label);         // Comparação com zero: bltz, bgez, ...
+            } else if (right->kind == AST_CONST_INT || right->kind == AST_CONST_CAR || right->kind == AST_EXPR_ID) {
+                // Direita é uma folha: não suja $t1, então a esquerda não precisa ir para a pilha
+                append_text("  move $t1, $t0\n");
+                generate_expression(right);
+                append_text("  %s $t1, $t0, %s\n", branch, label);
+            } else {
+                append_text("  sw $t0, 0($sp)\n");
+                append_text("  addi $sp, $sp, -4\n");
+                generate_expression(right);
+                append_text("  lw $t1, 4($sp)\n");
+                append_text("  addi $sp, $sp, 4\n");
+                append_text("  %s $t1, $t0, %s\n", branch, label);
+            }
+            return;
+        }
+    }
+
+    // Qualquer outro valor: verdadeiro se diferente de zero
+    generate_expression(node);
+    append_text("  %s $t0, $zero, %s\n", jump_if ? "bne" : "beq", label);
+}
+
+
+/*
+    * Função: generate_node_code
+    * -------------------------------
+    * Gera o código de um nó marcando as instruções com a linha dele (para a
+    * tabela de linhas). A linha anterior volta ao final, então o salto de
+    * volta de um enquanto fica na linha do enquanto, e não na do corpo.
+*/
+void generate_node_code(AST_Node *node) {
+    if (node == NULL) return;
+
+    int saved_line = mips_source_line;
+    if (node->lineno > 0) mips_source_line = node->lineno;
+    generate_statement_code(node);
+    mips_source_line = saved_line;
+}
+
 /*
     * Gera o código MIPS para um nó AST específico.
     * @param node O nó AST para o qual gerar o código.
 */
-void generate_node_code(AST_Node *node) {
+static void generate_statement_code(AST_Node *node) {
     if (node == NULL) return;
 
-    // Verifica se a declaração de variável foi feita no escopo global e
-    // guarda essa informação para colocar no primeiro escopo do programa
+    // Verifica se a declaração de variável foi feita no escopo global.
+    // Variáveis globais vão para a seção .data em vez de ocupar um frame.
     if ((is_global_scope_flag) && (within_function == 0)) {
         if (node->kind == AST_DECL_VAR) {
-            // Se for uma declaração de variável global, armazena para processamento posterior
-            add_global_var_node(node);
+            declare_global_var(node);
             return;
         }
     }
@@ -405,6 +678,9 @@ void generate_node_code(AST_Node *node) {
     switch (node->kind) {
         
         case AST_PROGRAMA:
+            // Escopo das variáveis globais (profundidade GLOBAL_SCOPE_DEPTH)
+            symtab_enter_scope(global_symtab);
+
             // Chamando as declarações globais primeiro
             generate_list_code(node->child1);
             
@@ -412,14 +688,21 @@ void generate_node_code(AST_Node *node) {
             append_text(".globl main\n");
             append_text("main:\n");
 
-            // --- Prólogo de MAIN ---
-            append_text("\n  # Prologo: Salva $ra e $fp, e configura $fp para main\n");
-            append_text("  addi $sp, $sp, -4\n"); 
-            append_text("  sw $ra, 4($sp)\n");                    // Salva o endereço de retorno
-            append_text("  sw $fp, 0($sp)\n");                    // Salva o $fp antigo
-            append_text("  move $fp, $sp\n");                     // Configura $fp para a base do frame
-            append_text("  addi $sp, $sp, -4\n");
+            {
+                // Layout do frame de main: apenas as locais dos blocos
+                int main_slots = compute_frame_slots(node->child2);
+
+                // --- Prólogo de MAIN ---
+                append_text("\n  # Prologo: Salva $ra e $fp, e configura $fp para main\n");
+                append_text("  addi $sp, $sp, -4\n"); 
+                append_text("  sw $ra, 4($sp)\n");                    // Salva o endereço de retorno
+                append_text("  sw $fp, 0($sp)\n");                    // Salva o $fp antigo
+                append_text("  move $fp, $sp\n");                     // Configura $fp para a base do frame
+                append_text("  addi $sp, $sp, %d\n", -4 - 4 * main_slots); // Reserva o frame inteiro de uma vez
+                append_text("  la $gp, __globais\n");                 // $gp aponta para as variáveis globais
+            }
 
+            current_var_offset = 0;
             is_global_scope_flag = 0;
             generate_list_code(node->child2);                     // Bloco Principal
 
@@ -432,40 +715,27 @@ void generate_node_code(AST_Node *node) {
             append_text("\n  # Fim da execucao\n");
             append_text("  li $v0, 10\n");
             append_text("  syscall\n");
+
+            symtab_exit_scope(global_symtab);
             return;
             
         case AST_BLOCO:
-            blocos_func +=1;
-            // Prologo do bloco
-            append_text("\n  # Prologo: Salva $ra e $fp, e configura $fp\n");
-            append_text("  sw $fp, 0($sp)\n"); 
-            append_text("  move $fp, $sp\n");
-            append_text("  addi $sp, $sp, -4\n");
+            // O bloco não cria frame próprio: suas variáveis ocupam posições fixas
+            // do frame da função, logo abaixo das variáveis do bloco pai.
+            append_text("\n  # Bloco de comandos (Entrada)\n");
 
             symtab_enter_scope(global_symtab);
     
             int previous_frame_offset = current_var_offset;     // Salva o offset do escopo pai
-            current_var_offset = 0;                             // O novo offset para o escopo atual começa em 0
             
 
-            // Processa variáveis globais que foram armazenadas anteriormente
-            if ((global_var_list != NULL) && !is_global_scope_flag) {
-                process_global_vars();
-            }
-
             generate_list_code(node->child1); 
             generate_list_code(node->child2); 
 
-            // Epilogo do bloco
-            append_text("\n  # Epilogo: Restaura $fp e $ra\n");
-            append_text("  move $sp, $fp\n");
-            append_text("  lw $fp, 0($sp)\n");
-            
             symtab_exit_scope(global_symtab);
-            current_var_offset = previous_frame_offset;         // Restaura o offset do escopo pai
+            current_var_offset = previous_frame_offset;         // Libera as posições para os blocos irmãos
             
             append_text("\n  # Bloco de comandos (Saida)\n");
-            blocos_func -=1;
             return;
 
         case AST_DECL_VAR:
@@ -473,11 +743,8 @@ void generate_node_code(AST_Node *node) {
             AST_Node* current_id_node = node->child2; 
             
             while (current_id_node != NULL) {
-                // Decrementando o offset para a nova variável
+                // Decrementando o offset para a nova variável (posição já reservada no prólogo)
                 current_var_offset -= 4;                        // Aloca 4 bytes
-                
-                // Deixando o lugar da variável separado na pilha
-                append_text("  addi $sp, $sp, -4\n");
 
                 // Obtendo o tipo
                 int data_type = ast_type_to_data_type(node->child1);
@@ -497,10 +764,8 @@ void generate_node_code(AST_Node *node) {
             
         case AST_COMANDO_ESCREVA:
             if (node->child1->kind == AST_CONST_CADEIA) {
-                char *str_label = new_label();
-                
-                // Escrevendo a string na seção de dados
-                append_data("%s: .asciiz %s\n", str_label, node->child1->value);
+                // Cadeias iguais compartilham o mesmo rótulo na seção de dados
+                const char *str_label = string_pool_label(node->child1->value);
                 
                 append_text("\n  # Comando: Escreva String\n");
                 append_text("  li $v0, 4\n");
@@ -518,7 +783,7 @@ void generate_node_code(AST_Node *node) {
                     SymbolRef symbol = symtab_lookup(global_symtab, node->child1->value);
                     
                     if (symbol == NULL) {
-                        fprintf(stderr, "Erro de compilacao: Variavel '%s' nao declarada para escrita.\n", node->child1->value);
+                        fprintf(COMPILE_ERR, "Erro de compilacao: Variavel '%s' nao declarada para escrita.\n", node->child1->value);
                         return;
                     }
 
@@ -546,12 +811,16 @@ void generate_node_code(AST_Node *node) {
             return;
 
         case AST_DECL_FUNC:
-            blocos_func = 0;
             within_function += 1;
     
             char* func_name = node->child2->value;
             append_text("\n.globl %s\n", func_name);
             append_text("%s:\n", func_name);
+
+            // Layout do frame: argumentos em registradores seguidos das locais dos blocos
+            int reg_params = count_list_items(node->child3);
+            if (reg_params > 4) reg_params = 4;
+            int frame_slots = reg_params + compute_frame_slots(node->child4);
             
             // --- Prólogo da Função ---
             append_text("\n  # Prologo: Salva $ra e $fp, e configura $fp\n");
@@ -559,7 +828,7 @@ void generate_node_code(AST_Node *node) {
             append_text("  sw $ra, 4($sp)\n"); 
             append_text("  sw $fp, 0($sp)\n"); 
             append_text("  move $fp, $sp\n");
-            append_text("  addi $sp, $sp, -4\n");
+            append_text("  addi $sp, $sp, %d\n", -4 - 4 * frame_slots); // Reserva o frame inteiro de uma vez
 
             // --- Mapeamento e Alocação de Parâmetros ---
             symtab_enter_scope(global_symtab);
@@ -592,8 +861,7 @@ void generate_node_code(AST_Node *node) {
                 append_text("\n  # Salvando argumento %d (%s) de %s para %d($fp)\n", 
                             arg_reg_count + 1, param_name, arg_reg, current_var_offset);
                 
-                append_text("  sw %s, 0($sp)\n", arg_reg);             // Salva o $aN
-                append_text("  addi $sp, $sp, -4\n");
+                append_text("  sw %s, %d($fp)\n", arg_reg, current_var_offset); // Salva o $aN
 
                 current_param = current_param->next;
                 arg_reg_count++;
@@ -627,17 +895,26 @@ void generate_node_code(AST_Node *node) {
             within_function -= 1;
             return;
 
+        case AST_COMANDO_SE:
+            {
+                char *label_fim = new_label();
+
+                // Se a condição for FALSA, pula o bloco ENTAO
+                append_text("\n  # Comando: SE\n");
+                generate_condition(node->child1, label_fim, 0);
+                generate_node_code(node->child2);
+                append_text("%s:\n", label_fim);
+                return;
+            }
+
         case AST_COMANDO_SE_SENAO:
             {   
                 char *label_senao = new_label(); 
                 char *label_fim = new_label();   
                 
-                // Gerando a expressão de condição (n==0) em $t0.
-                generate_expression(node->child1); 
-                
-                // Se $t0 for FALSO (0), pula para o SENAO
-                append_text("\n  # Comando: SE (Expressao em $t0)\n");
-                append_text("  beq $t0, $zero, %s\n", label_senao);
+                // Se a condição for FALSA, pula para o SENAO
+                append_text("\n  # Comando: SE\n");
+                generate_condition(node->child1, label_senao, 0);
                 
                 // Bloco ENTAO
                 generate_node_code(node->child2); 
@@ -660,11 +937,8 @@ void generate_node_code(AST_Node *node) {
                 append_text("\n\n  # Comando: ENQUANTO\n");
                 append_text("%s:\n", label_inicio);              // Rótulo do início do laço
                 
-                // Gerando a expressão de condição (n>0) em $t0.
-                generate_expression(node->child1); 
-                
-                // Se $t0 for FALSO (0), pula para o FIM do laço
-                append_text("  beq $t0, $zero, %s\n", label_fim);
+                // Se a condição for FALSA, pula para o FIM do laço
+                generate_condition(node->child1, label_fim, 0);
                 
                 // Bloco EXECUTE
                 generate_node_code(node->child2); 
@@ -688,9 +962,6 @@ void generate_node_code(AST_Node *node) {
                 
                 // --- Epílogo da Função ---
                 append_text("\n  # Epilogo: Restaura $fp e $ra\n");
-                for(int i = 0; i < blocos_func; i++){
-                    append_text("  lw $fp, 0($fp)\n");
-                }
                 append_text("  move $sp, $fp\n");               // $sp aponta para o $fp salvo
                 append_text("  lw $ra, 4($sp)\n");              // $ra estava em $fp + 4
                 append_text("  lw $fp, 0($sp)\n");              // $fp estava em $fp
@@ -710,13 +981,14 @@ void generate_node_code(AST_Node *node) {
                 append_text("  li $v0, 5\n");                // Código 5 para Read Int
                 append_text("  syscall\n");                  // O valor lido está em $v0
                 
-                int offset_read = load_variable_address(node);
+                const char* base_read;
+                int offset_read = load_variable_address(node, &base_read);
                 if (offset_read == -1) {
                     return;
                 }
                 
                 // Salva o valor lido ($v0) na variável
-                append_text("  sw $v0, %d($t1)\n", offset_read);
+                append_text("  sw $v0, %d(%s)\n", offset_read, base_read);
                 
                 return;
             }
@@ -732,38 +1004,72 @@ void generate_node_code(AST_Node *node) {
 }
 
 /*
-    * Função principal que é chamada pela main para gerar o código MIPS a partir da AST.
+    * Função: generate_mips_code_to
+    * -------------------------------
+    * Gera o código MIPS da AST no arquivo já aberto (um arquivo em disco ou o
+    * buffer em memória da biblioteca). A lista text_section continua válida
+    * até a próxima geração, para a tabela de linhas.
+    * Retorna: 1 em caso de sucesso, 0 se a AST não foi construída.
 */
-void generate_mips_code(const char *output_filename) {
+int generate_mips_code_to(FILE* mips_file) {
     if (root_ast == NULL) {
-        fprintf(stderr, "Erro: AST nao construida. Nao e possivel gerar codigo.\n");
-        return;
+        fprintf(COMPILE_ERR, "Erro: AST nao construida. Nao e possivel gerar codigo.\n");
+        return 0;
     }
     
     // Inicializando buffers e contadores
     data_section_buffer[0] = '\0';
-    text_section_buffer[0] = '\0';
+    string_pool_clear();
+    pending_text_line[0] = '\0';
+    mips_list_clear(&text_section);
     label_count = 0;
-
-    // Abrindo o arquivo
-    FILE *mips_file = fopen(output_filename, "w");
-    if (!mips_file) {
-        perror("Erro ao abrir arquivo de saida MIPS");
-        return;
-    }
+    global_var_offset = 0;
+    mips_source_line = 0;
+    is_global_scope_flag = 1;
+    current_var_offset = 0;
+    within_function = 0;
 
     // Gerando o código
     generate_node_code(root_ast);
 
+    // Otimizações sobre a lista de instruções
+    if (peephole_enabled) {
+        time_report_begin(PHASE_PEEPHOLE);
+        peephole_optimize(&text_section);
+        time_report_end(PHASE_PEEPHOLE);
+    }
+    if (schedule_enabled || delay_slots_enabled) {
+        time_report_begin(PHASE_ESCALONADOR);
+        mips_schedule(&text_section);
+        time_report_end(PHASE_ESCALONADOR);
+    }
+
     // Seção de Dados (.data) - Deve vir primeiro
     fprintf(mips_file, ".data\n");
+    write_global_vars(mips_file);                       // Palavras alinhadas vêm antes das strings
     fprintf(mips_file, "__newline: .asciiz \"\\n\"\n"); 
     fprintf(mips_file, "%s", data_section_buffer); 
 
     // Seção de Código (.text)
     fprintf(mips_file, ".text\n");
-    fprintf(mips_file, "%s", text_section_buffer);
-    
+    mips_list_write(&text_section, mips_file);
+    return 1;
+}
+
+/*
+    * Função principal que é chamada pela main para gerar o código MIPS a partir da AST.
+*/
+void generate_mips_code(const char *output_filename) {
+    // Abrindo o arquivo
+    FILE *mips_file = fopen(output_filename, "w");
+    if (!mips_file) {
+        perror("Erro ao abrir arquivo de saida MIPS");
+        return;
+    }
+
+    int ok = generate_mips_code_to(mips_file);
     fclose(mips_file);
-    printf("Codigo MIPS gerado com sucesso no arquivo: %s\n\n", output_filename);
+    if (!ok) return;
+    mips_write_line_table(&text_section, output_filename);
+    fprintf(COMPILE_OUT, "Codigo MIPS gerado com sucesso no arquivo: %s\n\n", output_filename);
 }
\ No newline at end of file
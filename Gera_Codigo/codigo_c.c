@@ -0,0 +1,473 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "./../AST/ast.h"
+#include "./../Tabela_Simbulos/symbolTable.h"
+
+// Gerador de C (--target=c): traduz a AST já verificada para uma unidade de
+// tradução C independente, para ser compilada com gcc/clang -O2.
+// int vira int32_t e car vira char; os blocos do Goianinha viram blocos C, o
+// que preserva o escopo aninhado, e as funções viram funções C (recursão e
+// variáveis locais por ativação vêm de graça). Nomes ganham prefixo (v_ para
+// variáveis, f_ para funções) para não colidir com palavras reservadas do C.
+
+// Constantes de tipo (mesmas de semantic.c e codigo.c)
+#define INT_T 1
+#define CHAR_T 2
+#define VOID_T 4
+
+// Funções da análise semântica reaproveitadas
+int ast_type_to_data_type(AST_Node* type_node);
+
+// Texto C em construção (o corpo de cada função é montado antes das declarações dos temporários)
+typedef struct {
+    char* text;
+    size_t length;
+    size_t capacity;
+} CBuffer;
+
+static CBuffer body;                        // Corpo da função atual
+static SymbolTableRef c_symtab = NULL;      // Escopos, para saber o tipo de cada variável
+static int temp_count = 0;                  // Temporários da função atual (t_0, t_1, ...)
+static int indent = 0;
+static int in_main = 0;
+
+/*
+    * Prelúdio de cada arquivo gerado. A aritmética passa por unsigned para
+    * dar a volta em 32 bits como no MIPS (overflow de int é indefinido em C,
+    * e o gcc -O2 se aproveita disso). A divisão segue a máquina virtual:
+    * divisor zero é erro de execução e dividir por -1 é negar (INT_MIN / -1
+    * também é indefinido em C). leia segue a syscall 5: um inteiro.
+*/
+static const char* c_prelude =
+    "#include <stdio.h>\n"
+    "#include <stdint.h>\n"
+    "#include <stdlib.h>\n"
+    "\n"
+    "static inline int32_t gn_add(int32_t a, int32_t b) { return (int32_t)((uint32_t)a + (uint32_t)b); }\n"
+    "static inline int32_t gn_sub(int32_t a, int32_t b) { return (int32_t)((uint32_t)a - (uint32_t)b); }\n"
+    "static inline int32_t gn_mul(int32_t a, int32_t b) { return (int32_t)((uint32_t)a * (uint32_t)b); }\n"
+    "static inline int32_t gn_div(int32_t a, int32_t b) {\n"
+    "    if (b == 0) {\n"
+    "        fflush(stdout);\n"
+    "        fputs(\"Erro de execucao: divisao por zero.\\n\", stderr);\n"
+    "        exit(1);\n"
+    "    }\n"
+    "    return b == -1 ? (int32_t)(0u - (uint32_t)a) : a / b;\n"
+    "}\n"
+    "static inline int32_t gn_neg(int32_t a) { return (int32_t)(0u - (uint32_t)a); }\n"
+    "static inline int32_t gn_leia(void) {\n"
+    "    int valor = 0;\n"
+    "    if (scanf(\"%d\", &valor) != 1) valor = 0;\n"
+    "    return valor;\n"
+    "}\n";
+
+
+// --- Saída ---
+
+static void buffer_append(CBuffer* buffer, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int needed = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (buffer->length + needed + 1 > buffer->capacity) {
+        buffer->capacity = (buffer->length + needed + 1) * 2;
+        buffer->text = (char*)realloc(buffer->text, buffer->capacity);
+    }
+    va_start(args, format);
+    vsnprintf(buffer->text + buffer->length, needed + 1, format, args);
+    va_end(args);
+    buffer->length += needed;
+}
+
+static void emit_indent(void) {
+    buffer_append(&body, "%*s", 4 * indent, "");
+}
+
+static const char* c_type(int data_type) {
+    return data_type == CHAR_T ? "char" : "int32_t";
+}
+
+static int var_type(const char* name) {
+    SymbolRef symbol = symtab_lookup(c_symtab, name);
+    if (symbol == NULL) {
+        fprintf(COMPILE_ERR, "Erro interno: variavel '%s' nao encontrada na geracao de C.\n", name);
+        compile_abort(EXIT_FAILURE);
+    }
+    int data_type = sym_get_data_type(symbol);
+    sym_free_ref(symbol);
+    return data_type;
+}
+
+
+// --- Expressões ---
+
+static void gen_expr(AST_Node* node);
+
+// A expressão chama uma função ou faz uma atribuição?
+static int has_side_effects(AST_Node* node) {
+    if (node == NULL) return 0;
+    if (node->kind == AST_EXPR_CHAMADA_FUNC || node->kind == AST_COMANDO_ATRIB) return 1;
+    return has_side_effects(node->child1) || has_side_effects(node->child2);
+}
+
+static int is_logical(AST_Node* node) {
+    return strcmp(node->value, "E") == 0 || strcmp(node->value, "OU") == 0;
+}
+
+/*
+    * Função: gen_operands
+    * -------------------------------
+    * Em C a ordem de avaliação dos operandos e dos argumentos não é definida;
+    * no Goianinha é da esquerda para a direita. Quando algum operando tem
+    * efeito colateral, cada um é guardado em um temporário com o operador
+    * vírgula, que garante a ordem: "(t_0 = a, t_1 = b, <uso>)". Retorna o
+    * número do primeiro temporário, ou -1 se os operandos são usados direto.
+*/
+static int gen_operands(AST_Node** operands, int count) {
+    int needs_order = 0;
+    for (int i = 0; i < count && count > 1; i++) {
+        if (has_side_effects(operands[i])) needs_order = 1;
+    }
+    if (!needs_order) return -1;
+
+    int first = temp_count;
+    temp_count += count;
+    buffer_append(&body, "(");
+    for (int i = 0; i < count; i++) {
+        buffer_append(&body, "t_%d = ", first + i);
+        gen_expr(operands[i]);
+        buffer_append(&body, ", ");
+    }
+    return first;
+}
+
+static void gen_operand(AST_Node** operands, int first, int i) {
+    if (first >= 0) buffer_append(&body, "t_%d", first + i);
+    else gen_expr(operands[i]);
+}
+
+static void gen_expr(AST_Node* node) {
+    switch (node->kind) {
+        case AST_CONST_INT:
+            buffer_append(&body, "%s", node->value);
+            return;
+
+        case AST_CONST_CAR:
+            buffer_append(&body, "%d", node->value[1]);     // Mesmo valor que a IR usa
+            return;
+
+        case AST_EXPR_ID:
+            buffer_append(&body, "v_%s", node->value);
+            return;
+
+        case AST_EXPR_BINARIA: {
+            if (is_logical(node)) {
+                // && e || já avaliam da esquerda para a direita com curto-circuito
+                buffer_append(&body, "(");
+                gen_expr(node->child1);
+                buffer_append(&body, strcmp(node->value, "E") == 0 ? " && " : " || ");
+                gen_expr(node->child2);
+                buffer_append(&body, ")");
+                return;
+            }
+
+            AST_Node* operands[2] = { node->child1, node->child2 };
+            int first = gen_operands(operands, 2);
+            const char* helper = strcmp(node->value, "+") == 0 ? "gn_add" :
+                                 strcmp(node->value, "-") == 0 ? "gn_sub" :
+                                 strcmp(node->value, "*") == 0 ? "gn_mul" :
+                                 strcmp(node->value, "/") == 0 ? "gn_div" : NULL;
+            if (helper != NULL) {
+                buffer_append(&body, "%s(", helper);
+                gen_operand(operands, first, 0);
+                buffer_append(&body, ", ");
+                gen_operand(operands, first, 1);
+                buffer_append(&body, ")");
+            } else {
+                buffer_append(&body, "(");
+                gen_operand(operands, first, 0);
+                buffer_append(&body, " %s ", node->value);
+                gen_operand(operands, first, 1);
+                buffer_append(&body, ")");
+            }
+            if (first >= 0) buffer_append(&body, ")");
+            return;
+        }
+
+        case AST_EXPR_UNARIA:
+            buffer_append(&body, strcmp(node->value, "-") == 0 ? "gn_neg(" : "(!");
+            gen_expr(node->child1);
+            buffer_append(&body, ")");
+            return;
+
+        case AST_COMANDO_ATRIB:
+            buffer_append(&body, "(v_%s = ", node->child1->value);
+            gen_expr(node->child2);
+            buffer_append(&body, ")");
+            return;
+
+        case AST_EXPR_CHAMADA_FUNC: {
+            int nargs = 0;
+            for (AST_Node* arg = node->child2; arg != NULL; arg = arg->next) nargs++;
+            AST_Node** args = (AST_Node**)malloc(sizeof(AST_Node*) * (nargs + 1));
+            int i = 0;
+            for (AST_Node* arg = node->child2; arg != NULL; arg = arg->next) args[i++] = arg;
+
+            int first = gen_operands(args, nargs);
+            buffer_append(&body, "f_%s(", node->child1->value);
+            for (i = 0; i < nargs; i++) {
+                if (i > 0) buffer_append(&body, ", ");
+                gen_operand(args, first, i);
+            }
+            buffer_append(&body, ")");
+            if (first >= 0) buffer_append(&body, ")");
+            free(args);
+            return;
+        }
+
+        default:
+            fprintf(COMPILE_ERR, "Erro interno: expressao inesperada (%d) na linha %d.\n", node->kind, node->lineno);
+            compile_abort(EXIT_FAILURE);
+    }
+}
+
+
+// --- Comandos ---
+
+static void gen_stmt(AST_Node* node);
+
+// Corpo de se/senao/enquanto: sempre entre chaves
+static void gen_body(AST_Node* node) {
+    if (node != NULL && node->kind == AST_BLOCO) {
+        gen_stmt(node);
+        return;
+    }
+    buffer_append(&body, "{\n");
+    indent++;
+    gen_stmt(node);
+    indent--;
+    emit_indent();
+    buffer_append(&body, "}\n");
+}
+
+static void gen_stmt(AST_Node* node) {
+    if (node == NULL) return;
+
+    switch (node->kind) {
+        case AST_BLOCO:
+            buffer_append(&body, "{\n");
+            indent++;
+            symtab_enter_scope(c_symtab);
+            for (AST_Node* decl = node->child1; decl != NULL; decl = decl->next) {
+                int data_type = ast_type_to_data_type(decl->child1);
+                for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+                    symtab_insert_var(c_symtab, id->value, data_type, 0);
+                    emit_indent();
+                    buffer_append(&body, "%s v_%s = 0;\n", c_type(data_type), id->value);
+                }
+            }
+            for (AST_Node* stmt = node->child2; stmt != NULL; stmt = stmt->next) {
+                gen_stmt(stmt);
+            }
+            symtab_exit_scope(c_symtab);
+            indent--;
+            emit_indent();
+            buffer_append(&body, "}\n");
+            return;
+
+        case AST_COMANDO_ATRIB:
+            emit_indent();
+            buffer_append(&body, "v_%s = ", node->child1->value);
+            gen_expr(node->child2);
+            buffer_append(&body, ";\n");
+            return;
+
+        case AST_EXPR_CHAMADA_FUNC:
+            emit_indent();
+            gen_expr(node);
+            buffer_append(&body, ";\n");
+            return;
+
+        case AST_COMANDO_SE:
+        case AST_COMANDO_SE_SENAO:
+            emit_indent();
+            buffer_append(&body, "if (");
+            gen_expr(node->child1);
+            buffer_append(&body, ") ");
+            gen_body(node->child2);
+            if (node->kind == AST_COMANDO_SE_SENAO) {
+                emit_indent();
+                buffer_append(&body, "else ");
+                gen_body(node->child3);
+            }
+            return;
+
+        case AST_COMANDO_ENQUANTO:
+            emit_indent();
+            buffer_append(&body, "while (");
+            gen_expr(node->child1);
+            buffer_append(&body, ") ");
+            gen_body(node->child2);
+            return;
+
+        case AST_COMANDO_RETORNE:
+            emit_indent();
+            if (in_main) {
+                // retorne no programa termina a execução
+                buffer_append(&body, "(void)");
+                gen_expr(node->child1);
+                buffer_append(&body, ";\n");
+                emit_indent();
+                buffer_append(&body, "return 0;\n");
+            } else {
+                buffer_append(&body, "return ");
+                gen_expr(node->child1);
+                buffer_append(&body, ";\n");
+            }
+            return;
+
+        case AST_COMANDO_LEIA:
+            emit_indent();
+            buffer_append(&body, "v_%s = gn_leia();\n", node->child1->value);
+            return;
+
+        case AST_COMANDO_ESCREVA: {
+            AST_Node* expr = node->child1;
+            emit_indent();
+            if (expr->kind == AST_CONST_CADEIA) {
+                buffer_append(&body, "fputs(%s, stdout);\n", expr->value);
+            } else if (expr->kind == AST_EXPR_ID && var_type(expr->value) == CHAR_T) {
+                // Como em codigo.c, apenas variáveis do tipo car são escritas como caractere
+                buffer_append(&body, "putchar(v_%s);\n", expr->value);
+            } else {
+                buffer_append(&body, "printf(\"%%d\", (int)");
+                gen_expr(expr);
+                buffer_append(&body, ");\n");
+            }
+            return;
+        }
+
+        case AST_COMANDO_NOVALINHA:
+            emit_indent();
+            buffer_append(&body, "putchar('\\n');\n");
+            return;
+
+        default:
+            return;
+    }
+}
+
+
+// --- Funções e programa ---
+
+static void gen_signature(FILE* out, AST_Node* decl) {
+    fprintf(out, "static %s f_%s(", c_type(ast_type_to_data_type(decl->child1)), decl->child2->value);
+    if (decl->child3 == NULL) fprintf(out, "void");
+    for (AST_Node* param = decl->child3; param != NULL; param = param->next) {
+        fprintf(out, "%s%s v_%s", param == decl->child3 ? "" : ", ",
+                c_type(ast_type_to_data_type(param->child1)), param->child2->value);
+    }
+    fprintf(out, ")");
+}
+
+/*
+    * Função: gen_function
+    * -------------------------------
+    * Escreve uma função (ou main quando 'decl' é NULL). O bloco do corpo fica
+    * dentro de outro bloco, porque no Goianinha ele é um escopo próprio e
+    * pode redeclarar nomes de parâmetros; os temporários vêm antes dele.
+*/
+static void gen_function(FILE* out, AST_Node* decl, AST_Node* block) {
+    in_main = decl == NULL;
+    temp_count = 0;
+    body.length = 0;
+    indent = 1;
+
+    symtab_enter_scope(c_symtab);
+    if (!in_main) {
+        for (AST_Node* param = decl->child3; param != NULL; param = param->next) {
+            symtab_insert_var(c_symtab, param->child2->value, ast_type_to_data_type(param->child1), 0);
+        }
+    }
+    emit_indent();
+    gen_stmt(block);
+    symtab_exit_scope(c_symtab);
+
+    if (in_main) {
+        fprintf(out, "\nint main(void) {\n");
+    } else {
+        fprintf(out, "\n");
+        gen_signature(out, decl);
+        fprintf(out, " {\n");
+    }
+    for (int i = 0; i < temp_count; i++) {
+        fprintf(out, "    int32_t t_%d;\n", i);
+    }
+    fwrite(body.text, 1, body.length, out);
+    fprintf(out, "    return 0;\n}\n");        // Função que termina sem retorne
+}
+
+/*
+    * Função: generate_c_code_to
+    * -------------------------------
+    * Escreve o programa inteiro como C no arquivo já aberto. Os protótipos vêm
+    * primeiro, então uma função pode chamar outra definida depois dela.
+*/
+void generate_c_code_to(AST_Node* root, FILE* out) {
+    c_symtab = symtab_create();
+    symtab_enter_scope(c_symtab);       // Escopo das globais
+
+    fprintf(out, "/* Gerado pelo compilador Goianinha (--target=c) */\n");
+    fprintf(out, "%s\n", c_prelude);
+
+    for (AST_Node* decl = root->child1; decl != NULL; decl = decl->next) {
+        if (decl->kind == AST_DECL_VAR) {
+            int data_type = ast_type_to_data_type(decl->child1);
+            for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+                fprintf(out, "static %s v_%s;\n", c_type(data_type), id->value);
+            }
+        } else if (decl->kind == AST_DECL_FUNC) {
+            gen_signature(out, decl);
+            fprintf(out, ";\n");
+        }
+    }
+
+    // As globais entram na tabela na ordem do fonte, intercaladas com as funções
+    for (AST_Node* decl = root->child1; decl != NULL; decl = decl->next) {
+        if (decl->kind == AST_DECL_VAR) {
+            int data_type = ast_type_to_data_type(decl->child1);
+            for (AST_Node* id = decl->child2; id != NULL; id = id->next) {
+                symtab_insert_var(c_symtab, id->value, data_type, 0);
+            }
+        } else if (decl->kind == AST_DECL_FUNC) {
+            gen_function(out, decl, decl->child4);
+        }
+    }
+    gen_function(out, NULL, root->child2);
+
+    symtab_exit_scope(c_symtab);
+    symtab_destroy(c_symtab);
+    c_symtab = NULL;
+    free(body.text);
+    body.text = NULL;
+    body.length = body.capacity = 0;
+}
+
+/*
+    * Função: generate_c_code
+    * -------------------------------
+    * Ponto de entrada da linha de comando: gera o arquivo C (--target=c).
+*/
+void generate_c_code(AST_Node* root, const char* output_filename) {
+    FILE* out = fopen(output_filename, "w");
+    if (!out) {
+        perror("Erro ao abrir arquivo de saida C");
+        return;
+    }
+    generate_c_code_to(root, out);
+    fclose(out);
+    fprintf(COMPILE_OUT, "Codigo C gerado com sucesso no arquivo: %s\n\n", output_filename);
+}
@@ -0,0 +1,923 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mips.h"
+#include "./../Codigo_Intermediario/ir.h"
+#include "./../Relatorio/time_report.h"
+
+// Buffers e funções de saída compartilhados com codigo.c
+extern char data_section_buffer[];
+extern char pending_text_line[];
+extern int label_count;
+void append_text(const char* format, ...);
+void append_data(const char* format, ...);
+char* new_label();
+const char* string_pool_label(const char* literal);
+void string_pool_clear(void);
+
+// Tamanho máximo de uma cadeia formada por escritas juntadas
+#define OUTPUT_RUN_MAX 400
+
+// Registradores livres para os registradores virtuais ($t0 e $t1 ficam de rascunho)
+static const char* alloc_regs[] = { "$t2", "$t3", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9" };
+#define NUM_ALLOC_REGS (int)(sizeof(alloc_regs) / sizeof(alloc_regs[0]))
+
+// Localização de cada registrador virtual da função atual
+static int* vreg_reg = NULL;       // Índice em alloc_regs, ou -1
+static int* vreg_slot = NULL;      // Offset no frame ($sp) quando não cabe em registrador
+static int* vreg_uses = NULL;      // Quantas vezes o valor é lido
+static int* var_offset = NULL;     // Offset de cada variável da função
+static const char** var_home = NULL;  // Registrador que guarda a variável em funções folha, ou NULL
+static char* vreg_fused = NULL;    // Comparação lida só pelo desvio seguinte: vira um compara-e-desvia
+static char* vreg_zero = NULL;     // Constante 0 lida só por uma comparação fundida: vira $zero
+static int frame_slots = 0;        // Palavras do frame, abaixo do $sp de entrada
+static int ra_offset = 0;          // Onde $ra é guardado, ou 0 se a função não faz chamadas
+static char* frame_region = NULL;  // Blocos (por id) executados depois de $ra ser guardado
+static char* saves_ra = NULL;      // Blocos que guardam $ra ao começar (entradas da região)
+static IrFunction* cur_func = NULL;
+
+
+// --- Escritas com texto conhecido ---
+
+/*
+    * Função: output_text
+    * -------------------------------
+    * Acrescenta a 'buffer' o texto (conteúdo de cadeia, sem aspas) que a
+    * escrita produz, quando ele é conhecido em tempo de compilação: cadeias,
+    * novalinha e escritas de registradores definidos por constantes.
+    *
+    * Retorna: 1 se o texto é conhecido e coube no buffer.
+*/
+static int output_text(IrInstr* instr, IrInstr** defs, char* buffer, size_t size) {
+    char piece[OUTPUT_RUN_MAX];
+    IrInstr* def = instr->src1 >= 0 ? defs[instr->src1] : NULL;
+
+    if (instr->op == IR_NEWLINE) {
+        snprintf(piece, sizeof(piece), "\\n");
+    } else if (instr->op == IR_WRITE_STR) {
+        size_t len = strlen(instr->name);
+        if (len < 2 || len - 2 >= sizeof(piece)) return 0;
+        snprintf(piece, sizeof(piece), "%.*s", (int)(len - 2), instr->name + 1);
+    } else if (instr->op == IR_WRITE_INT && def != NULL && def->op == IR_CONST) {
+        snprintf(piece, sizeof(piece), "%d", def->imm);
+    } else if (instr->op == IR_WRITE_CHAR && def != NULL && def->op == IR_CONST) {
+        int c = def->imm;
+        if (c == '"' || c == '\\') snprintf(piece, sizeof(piece), "\\%c", c);
+        else if (c == '\n') snprintf(piece, sizeof(piece), "\\n");
+        else if (c >= 32 && c < 127) snprintf(piece, sizeof(piece), "%c", c);
+        else return 0;
+    } else {
+        return 0;
+    }
+
+    if (strlen(buffer) + strlen(piece) >= size) return 0;
+    strcat(buffer, piece);
+    return 1;
+}
+
+/*
+    * Função: merge_output_runs
+    * -------------------------------
+    * Junta escritas seguidas de um bloco cujo texto é conhecido (constantes
+    * podem aparecer entre elas) em um único escreva.str, ou seja, em uma
+    * única cadeia e uma única syscall. Ex: "Conceito: ", 'D' e novalinha.
+    * As constantes que só serviam às escritas juntadas são removidas.
+*/
+static void merge_output_runs(IrFunction* func) {
+    int nregs = func->nregs > 0 ? func->nregs : 1;
+    IrInstr** defs = (IrInstr**)calloc(nregs, sizeof(IrInstr*));
+    int merged = 0;
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->dst >= 0) defs[instr->dst] = instr;
+        }
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* first = block->first; first != NULL; first = first->next) {
+            char text[OUTPUT_RUN_MAX] = "";
+            if (!output_text(first, defs, text, sizeof(text))) continue;
+
+            int count = 1;
+            IrInstr* instr = first->next;
+            while (instr != NULL) {
+                IrInstr* next = instr->next;
+                if (instr->op != IR_CONST) {
+                    if (!output_text(instr, defs, text, sizeof(text))) break;
+                    ir_remove(block, instr);
+                    count++;
+                }
+                instr = next;
+            }
+            if (count < 2) continue;
+
+            char literal[OUTPUT_RUN_MAX + 2];
+            snprintf(literal, sizeof(literal), "\"%s\"", text);
+            free(first->name);
+            first->name = strdup(literal);
+            first->op = IR_WRITE_STR;
+            first->src1 = -1;
+            merged = 1;
+        }
+    }
+
+    // Constantes que ficaram sem leitores
+    if (merged) {
+        int* uses = (int*)calloc(nregs, sizeof(int));
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+                if (instr->src1 >= 0) uses[instr->src1]++;
+                if (instr->src2 >= 0) uses[instr->src2]++;
+                for (int i = 0; i < instr->nargs; i++) uses[instr->args[i]]++;
+            }
+        }
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            IrInstr* instr = block->first;
+            while (instr != NULL) {
+                IrInstr* next = instr->next;
+                if (instr->op == IR_CONST && uses[instr->dst] == 0) ir_remove(block, instr);
+                instr = next;
+            }
+        }
+        free(uses);
+    }
+    free(defs);
+}
+
+
+// --- Alocação de registradores ---
+
+/*
+    * Função: allocate_block
+    * -------------------------------
+    * Varredura linear dentro de um bloco: cada valor usado apenas no bloco e
+    * que não atravessa uma chamada recebe um dos registradores $t2-$t9, liberado
+    * no último uso. Os demais ficam marcados em 'spilled' e vão para o frame.
+*/
+static void allocate_block(IrBlock* block, int* last_use, int* spilled) {
+    int free_regs[NUM_ALLOC_REGS];
+    for (int i = 0; i < NUM_ALLOC_REGS; i++) free_regs[i] = 1;
+
+    // Posição do último uso de cada valor dentro do bloco
+    int pos = 0;
+    for (IrInstr* instr = block->first; instr != NULL; instr = instr->next, pos++) {
+        if (instr->src1 >= 0) last_use[instr->src1] = pos;
+        if (instr->src2 >= 0) last_use[instr->src2] = pos;
+        for (int i = 0; i < instr->nargs; i++) last_use[instr->args[i]] = pos;
+    }
+
+    pos = 0;
+    for (IrInstr* instr = block->first; instr != NULL; instr = instr->next, pos++) {
+        // Libera os registradores dos valores lidos pela última vez aqui
+        for (int v = 0; v < cur_func->nregs; v++) {
+            if (vreg_reg[v] >= 0 && last_use[v] == pos && ir_instr_uses(instr, v)) {
+                free_regs[vreg_reg[v]] = 1;
+            }
+        }
+
+        int v = instr->dst;
+        if (v < 0 || spilled[v]) continue;
+
+        // Os registradores $t não sobrevivem a uma chamada
+        int crosses_call = 0;
+        int p = pos + 1;
+        for (IrInstr* next = instr->next; next != NULL && p < last_use[v]; next = next->next, p++) {
+            if (next->op == IR_CALL) crosses_call = 1;
+        }
+        if (crosses_call) {
+            spilled[v] = 1;
+            continue;
+        }
+
+        for (int r = 0; r < NUM_ALLOC_REGS && vreg_reg[v] < 0; r++) {
+            if (free_regs[r]) {
+                free_regs[r] = 0;
+                vreg_reg[v] = r;
+            }
+        }
+        if (vreg_reg[v] < 0) {
+            spilled[v] = 1;
+        } else if (vreg_uses[v] == 0) {
+            free_regs[vreg_reg[v]] = 1;     // Valor nunca lido
+        }
+    }
+}
+
+static int is_compare(IrOperator oper) {
+    return oper == IR_EQ || oper == IR_NE || oper == IR_LT || oper == IR_GT || oper == IR_LE || oper == IR_GE;
+}
+
+// Instrução que define 'v' no bloco, ou NULL
+static IrInstr* find_def(IrBlock* block, int v) {
+    for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+        if (instr->dst == v) return instr;
+    }
+    return NULL;
+}
+
+/*
+    * Função: mark_fused_compares
+    * -------------------------------
+    * Uma comparação logo antes do desvio que é o seu único leitor não precisa
+    * do valor 0/1: o desvio compara os operandos direto (blt, bge, ...). Uma
+    * constante 0 lida só por essa comparação vira $zero (bgtz, bltz, ...).
+*/
+static void mark_fused_compares(IrFunction* func) {
+    int nregs = func->nregs > 0 ? func->nregs : 1;
+    vreg_fused = (char*)calloc(nregs, 1);
+    vreg_zero = (char*)calloc(nregs, 1);
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr* branch = block->last;
+        if (branch == NULL || branch->op != IR_BRANCH) continue;
+
+        IrInstr* cmp = branch->prev;
+        if (cmp == NULL || cmp->op != IR_BINOP || !is_compare(cmp->oper)) continue;
+        if (cmp->dst != branch->src1 || vreg_uses[cmp->dst] != 1) continue;
+        vreg_fused[cmp->dst] = 1;
+
+        int operands[2] = { cmp->src1, cmp->src2 };
+        for (int i = 0; i < 2; i++) {
+            IrInstr* def = find_def(block, operands[i]);
+            if (def != NULL && def->op == IR_CONST && def->imm == 0 && vreg_uses[operands[i]] == 1 &&
+                cmp->src1 != cmp->src2) {
+                vreg_zero[operands[i]] = 1;
+                vreg_uses[operands[i]] = 0;     // Não precisa de registrador
+                break;
+            }
+        }
+    }
+}
+
+/*
+    * Função: var_order
+    * -------------------------------
+    * Ordem em que as variáveis disputam os registradores: a do fonte, ou, com
+    * perfil, a das que têm mais loads e stores executados primeiro.
+*/
+static int* var_order(IrFunction* func) {
+    int* order = (int*)malloc(sizeof(int) * (func->nvars + 1));
+    for (int i = 0; i < func->nvars; i++) order[i] = i;
+    if (!func->profiled) return order;
+
+    long long* weight = (long long*)calloc(func->nvars + 1, sizeof(long long));
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if ((instr->op == IR_LOAD || instr->op == IR_STORE) && instr->var->kind != IR_VAR_GLOBAL) {
+                weight[instr->var->index] += block->count;
+            }
+        }
+    }
+    // Inserção estável: empates mantêm a ordem do fonte
+    for (int i = 1; i < func->nvars; i++) {
+        int var = order[i], j = i;
+        while (j > 0 && weight[order[j - 1]] < weight[var]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = var;
+    }
+    free(weight);
+    return order;
+}
+
+/*
+    * Função: assign_var_homes
+    * -------------------------------
+    * Em uma função folha (sem chamadas) $a0-$a3 e $v1 não são destruídos por
+    * ninguém: os parâmetros continuam nos registradores em que chegaram e as
+    * locais ocupam os que sobram, sem passar pelo frame. $a0 só é usado se a
+    * função não escreve nada (a syscall recebe o valor em $a0).
+*/
+static void assign_var_homes(IrFunction* func, int leaf, int writes_a0) {
+    static const char* arg_regs[] = { "$a0", "$a1", "$a2", "$a3" };
+    const char* spare[5];
+    int nspare = 0;
+
+    for (int i = 0; i < func->nvars; i++) var_home[i] = NULL;
+    if (!leaf) return;
+
+    for (int i = func->nparams; i < 4; i++) {
+        if (i > 0 || !writes_a0) spare[nspare++] = arg_regs[i];
+    }
+    spare[nspare++] = "$v1";
+
+    int* order = var_order(func);
+    int next_spare = 0;
+    for (int k = 0; k < func->nvars; k++) {
+        int i = order[k];
+        if (func->vars[i]->kind == IR_VAR_PARAM) {
+            if (i < 4 && (i > 0 || !writes_a0)) var_home[i] = arg_regs[i];
+        } else if (next_spare < nspare) {
+            var_home[i] = spare[next_spare++];
+        }
+    }
+    free(order);
+}
+
+/*
+    * Função: mark_frame_region
+    * -------------------------------
+    * Shrink-wrapping de $ra: só os caminhos que chegam a uma chamada precisam
+    * guardá-lo. A região começa nos blocos com chamada e segue por todos os
+    * sucessores até os retornos. Um bloco da região com predecessores de
+    * dentro e de fora puxa os de fora para a região, de modo que cada entrada
+    * da região (onde $ra é guardado) só é alcançada por blocos de fora.
+*/
+static void mark_frame_region(IrFunction* func) {
+    int nblocks = func->nblocks + 1;
+    frame_region = (char*)calloc(nblocks, 1);
+    saves_ra = (char*)calloc(nblocks, 1);
+    if (ra_offset == 0) return;
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->op == IR_CALL) frame_region[block->id] = 1;
+        }
+    }
+
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+            if (block->rpo_index < 0 || !frame_region[block->id]) continue;
+
+            for (int s = 0; s < block->nsuccs; s++) {
+                if (!frame_region[block->succs[s]->id]) frame_region[block->succs[s]->id] = changed = 1;
+            }
+
+            int inside = 0, outside = 0;
+            for (int p = 0; p < block->npreds; p++) {
+                if (block->preds[p]->rpo_index < 0) continue;
+                if (frame_region[block->preds[p]->id]) inside = 1;
+                else outside = 1;
+            }
+            // A entrada da função só guarda $ra no prólogo, antes de qualquer salto para ela
+            if ((inside && outside) || (block == func->entry && block->npreds > 0)) {
+                for (int p = 0; p < block->npreds; p++) {
+                    if (!frame_region[block->preds[p]->id]) frame_region[block->preds[p]->id] = changed = 1;
+                }
+            }
+        }
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->rpo_index < 0 || !frame_region[block->id]) continue;
+        int outside = block == func->entry;
+        for (int p = 0; p < block->npreds; p++) {
+            if (block->preds[p]->rpo_index >= 0 && !frame_region[block->preds[p]->id]) outside = 1;
+        }
+        saves_ra[block->id] = outside;
+    }
+}
+
+/*
+    * Função: allocate_function
+    * -------------------------------
+    * Define o lugar de cada variável e de cada registrador virtual. O frame é
+    * reservado de uma vez na entrada e endereçado por $sp (não há $fp):
+    *   4($sp) ...             argumentos 5+ das chamadas feitas pela função
+    *   ...                    variáveis, valores no frame e $ra
+    *   4*frame_slots($sp)     última palavra, a que o chamador deixou livre
+    * Parâmetros 5+ estão logo acima, onde o chamador os guardou.
+*/
+static void allocate_function(IrFunction* func) {
+    int nregs = func->nregs > 0 ? func->nregs : 1;
+    vreg_reg = (int*)malloc(sizeof(int) * nregs);
+    vreg_slot = (int*)calloc(nregs, sizeof(int));
+    vreg_uses = (int*)calloc(nregs, sizeof(int));
+    var_offset = (int*)malloc(sizeof(int) * (func->nvars + 1));
+    var_home = (const char**)malloc(sizeof(const char*) * (func->nvars + 1));
+
+    int* def_block = (int*)malloc(sizeof(int) * nregs);
+    int* last_use = (int*)malloc(sizeof(int) * nregs);
+    int* spilled = (int*)calloc(nregs, sizeof(int));
+    for (int v = 0; v < nregs; v++) {
+        vreg_reg[v] = -1;
+        def_block[v] = -1;
+        last_use[v] = -1;
+    }
+
+    int leaf = 1, writes_a0 = 0, max_outgoing = 0;
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->op == IR_CALL) {
+                leaf = 0;
+                if (instr->nargs - 4 > max_outgoing) max_outgoing = instr->nargs - 4;
+            } else if (instr->op == IR_WRITE_INT || instr->op == IR_WRITE_CHAR ||
+                       instr->op == IR_WRITE_STR || instr->op == IR_NEWLINE) {
+                writes_a0 = 1;
+            }
+        }
+    }
+    assign_var_homes(func, leaf, writes_a0);
+
+    frame_slots = max_outgoing;
+    for (int i = 0; i < func->nvars; i++) {
+        if (var_home[i] == NULL && !(func->vars[i]->kind == IR_VAR_PARAM && i >= 4)) {
+            var_offset[i] = 4 * ++frame_slots;
+        }
+    }
+
+    // Valores lidos fora do bloco que os define vão direto para o frame
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->dst >= 0) def_block[instr->dst] = block->id;
+        }
+    }
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            for (int v = 0; v < func->nregs; v++) {
+                if (!ir_instr_uses(instr, v)) continue;
+                vreg_uses[v]++;
+                if (def_block[v] != block->id) spilled[v] = 1;
+            }
+        }
+    }
+
+    mark_fused_compares(func);
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        allocate_block(block, last_use, spilled);
+    }
+
+    for (int v = 0; v < func->nregs; v++) {
+        if (spilled[v] && vreg_uses[v] > 0) vreg_slot[v] = 4 * ++frame_slots;
+    }
+    ra_offset = leaf || func->is_main ? 0 : 4 * ++frame_slots;
+
+    // Parâmetros 5+ ficam acima do frame, a partir da palavra seguinte à livre
+    for (int i = 4; i < func->nvars; i++) {
+        if (func->vars[i]->kind == IR_VAR_PARAM) var_offset[i] = 4 * frame_slots + 4 + 4 * (i - 4);
+    }
+    mark_frame_region(func);
+
+    free(def_block);
+    free(last_use);
+    free(spilled);
+}
+
+static void free_allocation(void) {
+    free(vreg_reg);
+    free(vreg_slot);
+    free(vreg_uses);
+    free(var_offset);
+    free(var_home);
+    free(vreg_fused);
+    free(vreg_zero);
+    free(frame_region);
+    free(saves_ra);
+    vreg_reg = vreg_slot = vreg_uses = var_offset = NULL;
+    vreg_fused = vreg_zero = frame_region = saves_ra = NULL;
+    var_home = NULL;
+}
+
+
+// --- Emissão ---
+
+// Registrador com o valor de 'v' (carregado em 'scratch' se estiver no frame)
+static const char* use_reg(int v, const char* scratch) {
+    if (vreg_reg[v] >= 0) return alloc_regs[vreg_reg[v]];
+    append_text("  lw %s, %d($sp)\n", scratch, vreg_slot[v]);
+    return scratch;
+}
+
+// Registrador onde 'v' deve ser calculado ($t0 se estiver no frame)
+static const char* def_reg(int v) {
+    if (vreg_reg[v] >= 0) return alloc_regs[vreg_reg[v]];
+    return "$t0";
+}
+
+// Guarda 'v' no frame depois de calculado em def_reg, se for o caso
+static void finish_def(int v) {
+    if (vreg_reg[v] < 0 && vreg_slot[v] != 0) {
+        append_text("  sw $t0, %d($sp)\n", vreg_slot[v]);
+    }
+}
+
+// Endereço de uma variável: offset($gp) para globais, offset($sp) para as demais
+static void var_address(IrVar* var, char* buffer, size_t size) {
+    if (var->kind == IR_VAR_GLOBAL) {
+        snprintf(buffer, size, "%d($gp)", 4 * var->index);
+    } else {
+        snprintf(buffer, size, "%d($sp)", var_offset[var->index]);
+    }
+}
+
+// Próximo bloco alcançável no layout (o que recebe a execução por queda)
+static IrBlock* next_emitted(IrBlock* block) {
+    IrBlock* next = block->next;
+    while (next != NULL && next->rpo_index < 0) next = next->next;
+    return next;
+}
+
+static void block_label(IrBlock* block, char* buffer, size_t size) {
+    snprintf(buffer, size, "__%s_bb%d", cur_func->name, block->id);
+}
+
+// Indica se algum predecessor salta explicitamente para o bloco
+static int needs_label(IrBlock* block) {
+    for (int i = 0; i < block->npreds; i++) {
+        IrBlock* pred = block->preds[i];
+        if (pred->rpo_index < 0) continue;
+        if (next_emitted(pred) != block) return 1;
+        if (pred->last->op == IR_BRANCH && pred->last->target1 == pred->last->target2) return 1;
+    }
+    return 0;
+}
+
+static void emit_epilogue(IrBlock* block) {
+    append_text("\n  # Epilogo\n");
+    if (frame_region[block->id]) {
+        append_text("  lw $ra, %d($sp)\n", ra_offset);
+    }
+    if (frame_slots > 0) {
+        append_text("  addi $sp, $sp, %d\n", 4 * frame_slots);
+    }
+}
+
+/*
+    * Função: emit_binop
+    * -------------------------------
+    * Traduz uma operação binária da IR. Comparações deixam 0 ou 1 no destino.
+*/
+static void emit_binop(IrInstr* instr) {
+    const char* a = use_reg(instr->src1, "$t0");
+    const char* b = use_reg(instr->src2, "$t1");
+    const char* d = def_reg(instr->dst);
+
+    switch (instr->oper) {
+        case IR_ADD: append_text("  add %s, %s, %s\n", d, a, b); break;
+        case IR_SUB: append_text("  sub %s, %s, %s\n", d, a, b); break;
+        case IR_MUL:
+            append_text("  mult %s, %s\n", a, b);
+            append_text("  mflo %s\n", d);
+            break;
+        case IR_DIV:
+            append_text("  div %s, %s\n", a, b);
+            append_text("  mflo %s\n", d);
+            break;
+        case IR_EQ:
+            append_text("  sub %s, %s, %s\n", d, a, b);
+            append_text("  sltiu %s, %s, 1\n", d, d);
+            break;
+        case IR_NE:
+            append_text("  sub %s, %s, %s\n", d, a, b);
+            append_text("  sltu %s, $zero, %s\n", d, d);
+            break;
+        case IR_LT: append_text("  slt %s, %s, %s\n", d, a, b); break;
+        case IR_GT: append_text("  slt %s, %s, %s\n", d, b, a); break;
+        case IR_LE:
+            append_text("  slt %s, %s, %s\n", d, b, a);     // a <= b  ==  !(b < a)
+            append_text("  xori %s, %s, 1\n", d, d);
+            break;
+        case IR_GE:
+            append_text("  slt %s, %s, %s\n", d, a, b);     // a >= b  ==  !(a < b)
+            append_text("  xori %s, %s, 1\n", d, d);
+            break;
+        default:
+            break;
+    }
+    finish_def(instr->dst);
+}
+
+/*
+    * Função: emit_compare_branch
+    * -------------------------------
+    * Desvio sobre uma comparação fundida: um único compara-e-desvia para o
+    * braço que não vem em seguida no layout. Comparações com zero usam as
+    * formas de um registrador (bltz, bgez, ...).
+*/
+static void emit_compare_branch(IrBlock* block, IrInstr* cmp, IrInstr* branch) {
+    // Mnemônicos de cada comparação e da sua negação
+    static const struct { IrOperator oper; const char* op; const char* negated; } branches[] = {
+        { IR_EQ, "beq", "bne" }, { IR_NE, "bne", "beq" },
+        { IR_LT, "blt", "bge" }, { IR_GE, "bge", "blt" },
+        { IR_GT, "bgt", "ble" }, { IR_LE, "ble", "bgt" },
+    };
+    char label[128];
+    IrOperator oper = cmp->oper;
+    int a = cmp->src1, b = cmp->src2;
+
+    // Zero sempre à direita: 0 < x  ==  x > 0
+    if (vreg_zero[a]) {
+        int t = a; a = b; b = t;
+        if (oper == IR_LT) oper = IR_GT;
+        else if (oper == IR_GT) oper = IR_LT;
+        else if (oper == IR_LE) oper = IR_GE;
+        else if (oper == IR_GE) oper = IR_LE;
+    }
+
+    IrBlock* next = next_emitted(block);
+    int negate = next == branch->target1 && branch->target1 != branch->target2;
+    IrBlock* target = negate ? branch->target2 : branch->target1;
+
+    const char* op = NULL;
+    for (size_t i = 0; i < sizeof(branches) / sizeof(branches[0]); i++) {
+        if (branches[i].oper == oper) op = negate ? branches[i].negated : branches[i].op;
+    }
+
+    const char* left = use_reg(a, "$t0");
+    block_label(target, label, sizeof(label));
+    if (vreg_zero[b] && strcmp(op, "beq") != 0 && strcmp(op, "bne") != 0) {
+        append_text("  %sz %s, %s\n", op, left, label);
+    } else {
+        const char* right = vreg_zero[b] ? "$zero" : use_reg(b, "$t1");
+        append_text("  %s %s, %s, %s\n", op, left, right, label);
+    }
+
+    if (!negate && next != branch->target2) {
+        block_label(branch->target2, label, sizeof(label));
+        append_text("  j %s\n", label);
+    }
+}
+
+/*
+    * Função: emit_call
+    * -------------------------------
+    * Argumentos 1-4 vão em $a0-$a3; os demais vão para a área de saída no
+    * fundo do frame (o quinto em 4($sp)), logo acima do frame da chamada.
+*/
+static void emit_call(IrInstr* instr) {
+    append_text("\n  # Chamada de Funcao %s\n", instr->name);
+
+    for (int i = 4; i < instr->nargs; i++) {
+        const char* value = use_reg(instr->args[i], "$t0");
+        append_text("  sw %s, %d($sp)\n", value, 4 + 4 * (i - 4));
+    }
+    for (int i = 0; i < instr->nargs && i < 4; i++) {
+        if (vreg_reg[instr->args[i]] >= 0) {
+            append_text("  move $a%d, %s\n", i, alloc_regs[vreg_reg[instr->args[i]]]);
+        } else {
+            append_text("  lw $a%d, %d($sp)\n", i, vreg_slot[instr->args[i]]);
+        }
+    }
+
+    append_text("  jal %s\n", instr->name);
+
+    if (vreg_uses[instr->dst] > 0) {
+        append_text("  move %s, $v0\n", def_reg(instr->dst));
+        finish_def(instr->dst);
+    }
+}
+
+/*
+    * Função: emit_instr
+    * -------------------------------
+    * Traduz uma instrução da IR para MIPS. 'block' é usado pelos terminadores
+    * para omitir saltos para o bloco seguinte.
+*/
+static void emit_instr(IrBlock* block, IrInstr* instr) {
+    char address[32];
+    char label[128];
+
+    switch (instr->op) {
+        case IR_CONST:
+            if (vreg_zero[instr->dst]) break;       // Lida como $zero pelo desvio
+            append_text("  li %s, %d\n", def_reg(instr->dst), instr->imm);
+            finish_def(instr->dst);
+            break;
+
+        case IR_COPY: {
+            const char* src = use_reg(instr->src1, "$t1");
+            append_text("  move %s, %s\n", def_reg(instr->dst), src);
+            finish_def(instr->dst);
+            break;
+        }
+
+        case IR_BINOP:
+            if (vreg_fused[instr->dst]) break;      // Gerada junto com o desvio
+            emit_binop(instr);
+            break;
+
+        case IR_UNOP: {
+            const char* src = use_reg(instr->src1, "$t1");
+            const char* d = def_reg(instr->dst);
+            if (instr->oper == IR_NEG) {
+                append_text("  neg %s, %s\n", d, src);
+            } else {
+                append_text("  sltiu %s, %s, 1\n", d, src);
+            }
+            finish_def(instr->dst);
+            break;
+        }
+
+        case IR_LOAD:
+            if (instr->var->kind != IR_VAR_GLOBAL && var_home[instr->var->index] != NULL) {
+                append_text("  move %s, %s\n", def_reg(instr->dst), var_home[instr->var->index]);
+                finish_def(instr->dst);
+                break;
+            }
+            var_address(instr->var, address, sizeof(address));
+            append_text("  lw %s, %s\n", def_reg(instr->dst), address);
+            finish_def(instr->dst);
+            break;
+
+        case IR_STORE: {
+            const char* src = use_reg(instr->src1, "$t0");
+            if (instr->var->kind != IR_VAR_GLOBAL && var_home[instr->var->index] != NULL) {
+                append_text("  move %s, %s\n", var_home[instr->var->index], src);
+                break;
+            }
+            var_address(instr->var, address, sizeof(address));
+            append_text("  sw %s, %s\n", src, address);
+            break;
+        }
+
+        case IR_CALL:
+            emit_call(instr);
+            break;
+
+        case IR_READ:
+            append_text("\n  # Leia\n");
+            append_text("  li $v0, 5\n");
+            append_text("  syscall\n");
+            append_text("  move %s, $v0\n", def_reg(instr->dst));
+            finish_def(instr->dst);
+            break;
+
+        case IR_WRITE_INT:
+        case IR_WRITE_CHAR: {
+            append_text("\n  # Escreva\n");
+            const char* src = use_reg(instr->src1, "$t0");
+            append_text("  li $v0, %d\n", instr->op == IR_WRITE_INT ? 1 : 11);
+            append_text("  move $a0, %s\n", src);
+            append_text("  syscall\n");
+            break;
+        }
+
+        case IR_WRITE_STR:
+            append_text("\n  # Escreva String\n");
+            append_text("  li $v0, 4\n");
+            append_text("  la $a0, %s\n", string_pool_label(instr->name));
+            append_text("  syscall\n");
+            break;
+
+        case IR_NEWLINE:
+            append_text("\n  # Novalinha\n");
+            append_text("  li $v0, 4\n");
+            append_text("  la $a0, __newline\n");
+            append_text("  syscall\n");
+            break;
+
+        case IR_JUMP:
+            if (next_emitted(block) != instr->target1) {
+                block_label(instr->target1, label, sizeof(label));
+                append_text("  j %s\n", label);
+            }
+            break;
+
+        case IR_BRANCH: {
+            if (instr->prev != NULL && instr->prev->op == IR_BINOP && vreg_fused[instr->prev->dst]) {
+                emit_compare_branch(block, instr->prev, instr);
+                break;
+            }
+            const char* cond = use_reg(instr->src1, "$t0");
+            IrBlock* next = next_emitted(block);
+
+            if (next == instr->target1 && instr->target1 != instr->target2) {
+                block_label(instr->target2, label, sizeof(label));
+                append_text("  beq %s, $zero, %s\n", cond, label);
+            } else {
+                block_label(instr->target1, label, sizeof(label));
+                append_text("  bne %s, $zero, %s\n", cond, label);
+                if (next != instr->target2) {
+                    block_label(instr->target2, label, sizeof(label));
+                    append_text("  j %s\n", label);
+                }
+            }
+            break;
+        }
+
+        case IR_RET:
+            if (cur_func->is_main) {
+                append_text("\n  # Fim da execucao\n");
+                append_text("  li $v0, 10\n");
+                append_text("  syscall\n");
+            } else {
+                if (instr->src1 >= 0) {
+                    append_text("  move $v0, %s\n", use_reg(instr->src1, "$t0"));
+                }
+                emit_epilogue(block);
+                append_text("  jr $ra\n");
+            }
+            break;
+    }
+}
+
+/*
+    * Função: emit_function
+    * -------------------------------
+    * Gera o prólogo (reserva do frame e parâmetros que vivem nele) e traduz
+    * os blocos alcançáveis na ordem de layout. $ra é guardado no início de
+    * cada entrada da região de frame, e não no prólogo.
+*/
+static void emit_function(IrFunction* func) {
+    cur_func = func;
+    merge_output_runs(func);
+    ir_compute_dominators(func);
+    allocate_function(func);
+
+    // Prólogo na linha da primeira instrução da função
+    IrInstr* first = func->entry->first;
+    mips_source_line = first ? first->lineno : 0;
+
+    append_text("\n.globl %s\n", func->name);
+    append_text("%s:\n", func->name);
+
+    append_text("\n  # Prologo\n");
+    if (frame_slots > 0) {
+        append_text("  addi $sp, $sp, %d\n", -4 * frame_slots);
+    }
+    if (func->is_main) {
+        append_text("  la $gp, __globais\n");
+    }
+
+    for (int i = 0; i < func->nparams && i < 4; i++) {
+        if (var_home[i] == NULL) append_text("  sw $a%d, %d($sp)\n", i, var_offset[i]);
+    }
+    if (saves_ra[func->entry->id]) {
+        append_text("  sw $ra, %d($sp)\n", ra_offset);     // Antes do rótulo: saltos para a entrada não guardam de novo
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->rpo_index < 0) continue;     // Bloco inalcançável
+
+        if (needs_label(block)) {
+            char label[128];
+            block_label(block, label, sizeof(label));
+            append_text("%s:\n", label);
+        }
+        if (saves_ra[block->id] && block != func->entry) {
+            append_text("  sw $ra, %d($sp)\n", ra_offset);
+        }
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            mips_source_line = instr->lineno;
+            emit_instr(block, instr);
+        }
+    }
+
+    free_allocation();
+    cur_func = NULL;
+}
+
+/*
+    * Função: ir_generate_mips_to
+    * -------------------------------
+    * Gera o código MIPS da IR no arquivo já aberto. Usa a mesma lista
+    * text_section e o mesmo formato de saída de codigo.c, então o otimizador
+    * peephole também roda sobre o código gerado por aqui.
+*/
+void ir_generate_mips_to(IrProgram* prog, FILE* mips_file) {
+    data_section_buffer[0] = '\0';
+    string_pool_clear();
+    pending_text_line[0] = '\0';
+    mips_list_clear(&text_section);
+    label_count = 0;
+
+    // Funções na ordem do fonte e main por último, como em codigo.c
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        emit_function(func);
+    }
+
+    if (peephole_enabled) {
+        time_report_begin(PHASE_PEEPHOLE);
+        peephole_optimize(&text_section);
+        time_report_end(PHASE_PEEPHOLE);
+    }
+    if (schedule_enabled || delay_slots_enabled) {
+        time_report_begin(PHASE_ESCALONADOR);
+        mips_schedule(&text_section);
+        time_report_end(PHASE_ESCALONADOR);
+    }
+
+    fprintf(mips_file, ".data\n");
+    fprintf(mips_file, "__globais:\n");
+    for (int i = 0; i < prog->nglobals; i++) {
+        fprintf(mips_file, "__g_%s: .word 0\n", prog->globals[i]->name);
+    }
+    fprintf(mips_file, "__newline: .asciiz \"\\n\"\n");
+    fprintf(mips_file, "%s", data_section_buffer);
+
+    fprintf(mips_file, ".text\n");
+    mips_list_write(&text_section, mips_file);
+}
+
+/*
+    * Função: ir_generate_mips
+    * -------------------------------
+    * Gera o arquivo MIPS a partir da IR e a tabela de linhas ao lado dele.
+*/
+void ir_generate_mips(IrProgram* prog, const char* output_filename) {
+    FILE* mips_file = fopen(output_filename, "w");
+    if (!mips_file) {
+        perror("Erro ao abrir arquivo de saida MIPS");
+        return;
+    }
+
+    ir_generate_mips_to(prog, mips_file);
+    fclose(mips_file);
+    mips_write_line_table(&text_section, output_filename);
+    fprintf(COMPILE_OUT, "Codigo MIPS gerado com sucesso no arquivo: %s\n\n", output_filename);
+}
@@ -0,0 +1,604 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "./../Codigo_Intermediario/ir.h"
+#include "./../Relatorio/time_report.h"
+
+// Gerador de assembly x86-64 (System V, sintaxe AT&T do GNU as) a partir da IR.
+// Inteiros são de 32 bits, como no MIPS. Cada variável e cada registrador
+// virtual tem uma palavra de 8 bytes no frame (%rbp); os argumentos seguem a
+// convenção System V (%edi, %esi, %edx, %ecx, %r8d, %r9d e o resto na pilha).
+
+// Registradores dos 6 primeiros argumentos
+static const char* arg_regs[] = { "%edi", "%esi", "%edx", "%ecx", "%r8d", "%r9d" };
+#define NUM_ARG_REGS 6
+
+static FILE* x86_file = NULL;
+static IrFunction* cur_func = NULL;
+static int* vreg_uses = NULL;      // Quantas vezes cada registrador virtual é lido
+static char* vreg_fused = NULL;    // Comparação lida só pelo desvio seguinte: vira cmp + jcc
+
+// Cadeias do programa (.rodata), cada texto uma única vez
+static char** string_pool = NULL;
+static int num_strings = 0;
+
+/*
+    * Runtime de entrada e saída, escrito no fim do arquivo gerado: só usa
+    * chamadas de sistema do Linux, então o programa é montado e ligado sem a
+    * libc (as + ld). A saída passa por um buffer de 4 KB, esvaziado quando
+    * enche, antes de cada leia, no fim do programa e antes do erro de divisão
+    * por zero.
+*/
+static const char* x86_runtime =
+    "\n# --- Runtime ---\n"
+    "  .globl _start\n"
+    "_start:\n"
+    "  andq $-16, %rsp\n"
+    "  call gn_main\n"
+    "  call __gn_flush\n"
+    "  movl $60, %eax\n"                // exit(0)
+    "  xorl %edi, %edi\n"
+    "  syscall\n"
+    "\n"
+    "# Escreve o byte %dil no buffer de saída\n"
+    "__gn_putc:\n"
+    "  movq __gn_outlen(%rip), %rax\n"
+    "  leaq __gn_outbuf(%rip), %rcx\n"
+    "  movb %dil, (%rcx,%rax)\n"
+    "  incq %rax\n"
+    "  movq %rax, __gn_outlen(%rip)\n"
+    "  cmpq $4096, %rax\n"
+    "  jae __gn_flush\n"
+    "  ret\n"
+    "\n"
+    "# Esvazia o buffer de saída (write no descritor 1)\n"
+    "__gn_flush:\n"
+    "  leaq __gn_outbuf(%rip), %rsi\n"
+    "  movq __gn_outlen(%rip), %rdx\n"
+    "1:\n"
+    "  testq %rdx, %rdx\n"
+    "  jle 2f\n"
+    "  movl $1, %eax\n"
+    "  movl $1, %edi\n"
+    "  pushq %rsi\n"
+    "  pushq %rdx\n"
+    "  syscall\n"
+    "  popq %rdx\n"
+    "  popq %rsi\n"
+    "  testq %rax, %rax\n"
+    "  jle 2f\n"
+    "  addq %rax, %rsi\n"
+    "  subq %rax, %rdx\n"
+    "  jmp 1b\n"
+    "2:\n"
+    "  movq $0, __gn_outlen(%rip)\n"
+    "  ret\n"
+    "\n"
+    "# Escreve a cadeia terminada em zero apontada por %rdi\n"
+    "__gn_write_str:\n"
+    "  pushq %rbx\n"
+    "  movq %rdi, %rbx\n"
+    "1:\n"
+    "  movzbl (%rbx), %edi\n"
+    "  testl %edi, %edi\n"
+    "  je 2f\n"
+    "  call __gn_putc\n"
+    "  incq %rbx\n"
+    "  jmp 1b\n"
+    "2:\n"
+    "  popq %rbx\n"
+    "  ret\n"
+    "\n"
+    "# Escreve o inteiro %edi em decimal\n"
+    "__gn_write_int:\n"
+    "  subq $40, %rsp\n"
+    "  movslq %edi, %rax\n"
+    "  movq %rax, %r9\n"
+    "  leaq 31(%rsp), %rsi\n"
+    "  movb $0, (%rsi)\n"
+    "  testq %rax, %rax\n"
+    "  jns 1f\n"
+    "  negq %rax\n"
+    "1:\n"
+    "  movl $10, %r8d\n"
+    "2:\n"
+    "  xorl %edx, %edx\n"
+    "  divq %r8\n"
+    "  addb $48, %dl\n"
+    "  decq %rsi\n"
+    "  movb %dl, (%rsi)\n"
+    "  testq %rax, %rax\n"
+    "  jne 2b\n"
+    "  testq %r9, %r9\n"
+    "  jns 3f\n"
+    "  decq %rsi\n"
+    "  movb $45, (%rsi)\n"
+    "3:\n"
+    "  movq %rsi, %rdi\n"
+    "  call __gn_write_str\n"
+    "  addq $40, %rsp\n"
+    "  ret\n"
+    "\n"
+    "# Lê um byte da entrada (read no descritor 0); -1 no fim da entrada\n"
+    "__gn_getc:\n"
+    "  movq __gn_inpos(%rip), %rax\n"
+    "  cmpq __gn_inlen(%rip), %rax\n"
+    "  jb 1f\n"
+    "  xorl %eax, %eax\n"
+    "  xorl %edi, %edi\n"
+    "  leaq __gn_inbuf(%rip), %rsi\n"
+    "  movl $4096, %edx\n"
+    "  syscall\n"
+    "  testq %rax, %rax\n"
+    "  jle 2f\n"
+    "  movq %rax, __gn_inlen(%rip)\n"
+    "  xorl %eax, %eax\n"
+    "1:\n"
+    "  leaq __gn_inbuf(%rip), %rcx\n"
+    "  movzbl (%rcx,%rax), %edx\n"
+    "  incq %rax\n"
+    "  movq %rax, __gn_inpos(%rip)\n"
+    "  movl %edx, %eax\n"
+    "  ret\n"
+    "2:\n"
+    "  movl $-1, %eax\n"
+    "  ret\n"
+    "\n"
+    "# Lê um inteiro em decimal (como a syscall 5 do MIPS) e o devolve em %eax\n"
+    "__gn_read_int:\n"
+    "  pushq %rbx\n"
+    "  pushq %r12\n"
+    "  subq $8, %rsp\n"
+    "  call __gn_flush\n"
+    "1:\n"
+    "  call __gn_getc\n"
+    "  cmpl $-1, %eax\n"
+    "  je 5f\n"
+    "  cmpl $32, %eax\n"
+    "  jle 1b\n"
+    "  xorl %r12d, %r12d\n"
+    "  cmpl $45, %eax\n"
+    "  jne 2f\n"
+    "  movl $1, %r12d\n"
+    "  call __gn_getc\n"
+    "2:\n"
+    "  xorl %ebx, %ebx\n"
+    "3:\n"
+    "  subl $48, %eax\n"
+    "  cmpl $9, %eax\n"
+    "  ja 4f\n"
+    "  imull $10, %ebx, %ebx\n"
+    "  addl %eax, %ebx\n"
+    "  call __gn_getc\n"
+    "  jmp 3b\n"
+    "4:\n"
+    "  movl %ebx, %eax\n"
+    "  testl %r12d, %r12d\n"
+    "  je 6f\n"
+    "  negl %eax\n"
+    "  jmp 6f\n"
+    "5:\n"
+    "  xorl %eax, %eax\n"
+    "6:\n"
+    "  addq $8, %rsp\n"
+    "  popq %r12\n"
+    "  popq %rbx\n"
+    "  ret\n"
+    "\n"
+    "# Divisão por zero: esvazia a saída, escreve o erro em stderr e termina com 1\n"
+    "__gn_div_zero:\n"
+    "  call __gn_flush\n"
+    "  movl $1, %eax\n"                 // write(2, msg, len)
+    "  movl $2, %edi\n"
+    "  leaq __gn_div_msg(%rip), %rsi\n"
+    "  movl $__gn_div_msg_len, %edx\n"
+    "  syscall\n"
+    "  movl $60, %eax\n"                // exit(1)
+    "  movl $1, %edi\n"
+    "  syscall\n"
+    "\n"
+    "  .section .rodata\n"
+    "__gn_div_msg: .ascii \"Erro de execucao: divisao por zero.\\n\"\n"
+    "  .set __gn_div_msg_len, . - __gn_div_msg\n"
+    "\n"
+    "  .bss\n"
+    "  .align 16\n"
+    "__gn_outbuf: .zero 4096\n"
+    "__gn_inbuf: .zero 4096\n"
+    "__gn_outlen: .zero 8\n"
+    "__gn_inpos: .zero 8\n"
+    "__gn_inlen: .zero 8\n";
+
+
+static void emit(const char* format, ...) {
+    if (format[0] == ' ' && format[1] == ' ' && format[2] != '.') {
+        time_counters.instrs_emitted++;     // "  op ...": instrução (as diretivas começam com '.')
+    }
+    va_list args;
+    va_start(args, format);
+    vfprintf(x86_file, format, args);
+    va_end(args);
+}
+
+// Índice da cadeia no pool (o literal já vem entre aspas, com os escapes aceitos pelo as)
+static int string_index(const char* literal) {
+    for (int i = 0; i < num_strings; i++) {
+        if (strcmp(string_pool[i], literal) == 0) return i;
+    }
+    string_pool = (char**)realloc(string_pool, sizeof(char*) * (num_strings + 1));
+    string_pool[num_strings] = strdup(literal);
+    return num_strings++;
+}
+
+
+// --- Endereços ---
+
+// Posição no frame do registrador virtual 'reg'
+static void vreg_address(int reg, char* buffer, size_t size) {
+    snprintf(buffer, size, "%d(%%rbp)", -8 * (cur_func->nvars + reg + 1));
+}
+
+// Globais ficam no .bss; parâmetros passados na pilha ficam acima do %rbp; o resto no frame
+static void var_address(IrVar* var, char* buffer, size_t size) {
+    if (var->kind == IR_VAR_GLOBAL) {
+        snprintf(buffer, size, "gn_g_%s(%%rip)", var->name);
+    } else if (var->kind == IR_VAR_PARAM && var->index >= NUM_ARG_REGS) {
+        snprintf(buffer, size, "%d(%%rbp)", 16 + 8 * (var->index - NUM_ARG_REGS));
+    } else {
+        snprintf(buffer, size, "%d(%%rbp)", -8 * (var->index + 1));
+    }
+}
+
+static void load_vreg(int reg, const char* x86_reg) {
+    char address[64];
+    vreg_address(reg, address, sizeof(address));
+    emit("  movl %s, %s\n", address, x86_reg);
+}
+
+static void store_vreg(int reg, const char* x86_reg) {
+    char address[64];
+    vreg_address(reg, address, sizeof(address));
+    emit("  movl %s, %s\n", x86_reg, address);
+}
+
+static void block_label(IrBlock* block, char* buffer, size_t size) {
+    snprintf(buffer, size, ".L%s_bb%d", cur_func->name, block->id);
+}
+
+// Próximo bloco alcançável no layout (o que vem logo depois no código)
+static IrBlock* next_emitted(IrBlock* block) {
+    IrBlock* next = block->next;
+    while (next != NULL && next->rpo_index < 0) next = next->next;
+    return next;
+}
+
+
+// --- Comparações ---
+
+static int is_compare(IrOperator oper) {
+    return oper == IR_EQ || oper == IR_NE || oper == IR_LT || oper == IR_GT || oper == IR_LE || oper == IR_GE;
+}
+
+// Sufixo de condição (setcc/jcc) de cada comparação e da sua negação
+static const char* condition_code(IrOperator oper, int negated) {
+    switch (oper) {
+        case IR_EQ: return negated ? "ne" : "e";
+        case IR_NE: return negated ? "e" : "ne";
+        case IR_LT: return negated ? "ge" : "l";
+        case IR_GT: return negated ? "le" : "g";
+        case IR_LE: return negated ? "g" : "le";
+        case IR_GE: return negated ? "l" : "ge";
+        default: return "ne";
+    }
+}
+
+/*
+    * Função: mark_fused_compares
+    * -------------------------------
+    * Uma comparação logo antes do desvio do bloco e lida só por ele não
+    * precisa materializar 0/1: o desvio usa as flags do cmp diretamente.
+*/
+static void mark_fused_compares(IrFunction* func) {
+    vreg_uses = (int*)calloc(func->nregs + 1, sizeof(int));
+    vreg_fused = (char*)calloc(func->nregs + 1, sizeof(char));
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->src1 >= 0) vreg_uses[instr->src1]++;
+            if (instr->src2 >= 0) vreg_uses[instr->src2]++;
+            for (int i = 0; i < instr->nargs; i++) vreg_uses[instr->args[i]]++;
+        }
+    }
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr* branch = block->last;
+        if (branch == NULL || branch->op != IR_BRANCH) continue;
+        IrInstr* cmp = branch->prev;
+        if (cmp != NULL && cmp->op == IR_BINOP && is_compare(cmp->oper) &&
+            cmp->dst == branch->src1 && vreg_uses[cmp->dst] == 1) {
+            vreg_fused[cmp->dst] = 1;
+        }
+    }
+}
+
+
+// --- Instruções ---
+
+static void emit_binop(IrInstr* instr) {
+    char b[64];
+    vreg_address(instr->src2, b, sizeof(b));
+    load_vreg(instr->src1, "%eax");
+
+    switch (instr->oper) {
+        case IR_ADD: emit("  addl %s, %%eax\n", b); break;
+        case IR_SUB: emit("  subl %s, %%eax\n", b); break;
+        case IR_MUL: emit("  imull %s, %%eax\n", b); break;
+        case IR_DIV:
+            // Divisor zero é erro de execução; -1 nega (INT_MIN / -1 geraria #DE no idivl)
+            emit("  movl %s, %%ecx\n", b);
+            emit("  testl %%ecx, %%ecx\n");
+            emit("  je __gn_div_zero\n");
+            emit("  cmpl $-1, %%ecx\n");
+            emit("  jne 1f\n");
+            emit("  negl %%eax\n");
+            emit("  jmp 2f\n");
+            emit("1:\n");
+            emit("  cltd\n");
+            emit("  idivl %%ecx\n");
+            emit("2:\n");
+            break;
+        default:
+            emit("  cmpl %s, %%eax\n", b);
+            emit("  set%s %%al\n", condition_code(instr->oper, 0));
+            emit("  movzbl %%al, %%eax\n");
+            break;
+    }
+    store_vreg(instr->dst, "%eax");
+}
+
+/*
+    * Função: emit_call
+    * -------------------------------
+    * Os 6 primeiros argumentos vão em registradores e o resto é empilhado do
+    * último para o primeiro. A pilha fica alinhada em 16 bytes na chamada.
+*/
+static void emit_call(IrInstr* instr) {
+    char address[64];
+    int stack_args = instr->nargs > NUM_ARG_REGS ? instr->nargs - NUM_ARG_REGS : 0;
+
+    if (stack_args % 2 != 0) emit("  subq $8, %%rsp\n");
+    for (int i = instr->nargs - 1; i >= NUM_ARG_REGS; i--) {
+        vreg_address(instr->args[i], address, sizeof(address));
+        emit("  pushq %s\n", address);      // Só os 32 bits de baixo são lidos
+    }
+    for (int i = 0; i < instr->nargs && i < NUM_ARG_REGS; i++) {
+        load_vreg(instr->args[i], arg_regs[i]);
+    }
+    emit("  call gn_%s\n", instr->name);
+    if (stack_args > 0) emit("  addq $%d, %%rsp\n", 8 * (stack_args + stack_args % 2));
+    if (instr->dst >= 0) store_vreg(instr->dst, "%eax");
+}
+
+static void emit_branch(IrBlock* block, IrInstr* instr) {
+    char label[128];
+    IrBlock* next = next_emitted(block);
+    IrInstr* cmp = instr->prev;
+    IrOperator oper = IR_NE;        // Desvio comum: cond != 0
+
+    if (cmp != NULL && cmp->op == IR_BINOP && vreg_fused[cmp->dst]) {
+        char b[64];
+        vreg_address(cmp->src2, b, sizeof(b));
+        load_vreg(cmp->src1, "%eax");
+        emit("  cmpl %s, %%eax\n", b);
+        oper = cmp->oper;
+    } else {
+        char cond[64];
+        vreg_address(instr->src1, cond, sizeof(cond));
+        emit("  cmpl $0, %s\n", cond);
+    }
+
+    if (next == instr->target1) {
+        // Cai no braço verdadeiro: salta para o falso com a condição negada
+        block_label(instr->target2, label, sizeof(label));
+        emit("  j%s %s\n", condition_code(oper, 1), label);
+    } else {
+        block_label(instr->target1, label, sizeof(label));
+        emit("  j%s %s\n", condition_code(oper, 0), label);
+        if (next != instr->target2) {
+            block_label(instr->target2, label, sizeof(label));
+            emit("  jmp %s\n", label);
+        }
+    }
+}
+
+static void emit_instr(IrBlock* block, IrInstr* instr) {
+    char address[64];
+    char label[128];
+
+    switch (instr->op) {
+        case IR_CONST: {
+            vreg_address(instr->dst, address, sizeof(address));
+            emit("  movl $%d, %s\n", instr->imm, address);
+            break;
+        }
+
+        case IR_COPY:
+            load_vreg(instr->src1, "%eax");
+            store_vreg(instr->dst, "%eax");
+            break;
+
+        case IR_BINOP:
+            if (vreg_fused[instr->dst]) break;      // Gerada junto com o desvio
+            emit_binop(instr);
+            break;
+
+        case IR_UNOP:
+            load_vreg(instr->src1, "%eax");
+            if (instr->oper == IR_NEG) {
+                emit("  negl %%eax\n");
+            } else {
+                emit("  testl %%eax, %%eax\n");
+                emit("  sete %%al\n");
+                emit("  movzbl %%al, %%eax\n");
+            }
+            store_vreg(instr->dst, "%eax");
+            break;
+
+        case IR_LOAD:
+            var_address(instr->var, address, sizeof(address));
+            emit("  movl %s, %%eax\n", address);
+            store_vreg(instr->dst, "%eax");
+            break;
+
+        case IR_STORE:
+            load_vreg(instr->src1, "%eax");
+            var_address(instr->var, address, sizeof(address));
+            emit("  movl %%eax, %s\n", address);
+            break;
+
+        case IR_CALL:
+            emit_call(instr);
+            break;
+
+        case IR_READ:
+            emit("  call __gn_read_int\n");
+            store_vreg(instr->dst, "%eax");
+            break;
+
+        case IR_WRITE_INT:
+            load_vreg(instr->src1, "%edi");
+            emit("  call __gn_write_int\n");
+            break;
+
+        case IR_WRITE_CHAR:
+            load_vreg(instr->src1, "%edi");
+            emit("  call __gn_putc\n");
+            break;
+
+        case IR_WRITE_STR:
+            emit("  leaq .Lstr%d(%%rip), %%rdi\n", string_index(instr->name));
+            emit("  call __gn_write_str\n");
+            break;
+
+        case IR_NEWLINE:
+            emit("  movl $10, %%edi\n");
+            emit("  call __gn_putc\n");
+            break;
+
+        case IR_JUMP:
+            if (next_emitted(block) != instr->target1) {
+                block_label(instr->target1, label, sizeof(label));
+                emit("  jmp %s\n", label);
+            }
+            break;
+
+        case IR_BRANCH:
+            emit_branch(block, instr);
+            break;
+
+        case IR_RET:
+            if (instr->src1 >= 0) load_vreg(instr->src1, "%eax");
+            emit("  leave\n");
+            emit("  ret\n");
+            break;
+    }
+}
+
+/*
+    * Função: emit_function
+    * -------------------------------
+    * Prólogo com frame em %rbp (alinhado em 16 bytes), cópia dos parâmetros
+    * recebidos em registradores para o frame e os blocos alcançáveis na ordem
+    * de layout. O bloco do programa vira gn_main, chamado por _start.
+*/
+static void emit_function(IrFunction* func) {
+    cur_func = func;
+    ir_compute_dominators(func);
+    mark_fused_compares(func);
+
+    int frame_size = 8 * (func->nvars + func->nregs);
+    frame_size = (frame_size + 15) & ~15;
+
+    emit("\n  .globl gn_%s\n", func->name);
+    emit("gn_%s:\n", func->name);
+    emit("  pushq %%rbp\n");
+    emit("  movq %%rsp, %%rbp\n");
+    if (frame_size > 0) emit("  subq $%d, %%rsp\n", frame_size);
+
+    for (int i = 0; i < func->nparams && i < NUM_ARG_REGS; i++) {
+        emit("  movl %s, %d(%%rbp)\n", arg_regs[i], -8 * (i + 1));
+    }
+    // Locais começam em zero, como na pilha nova do simulador MIPS
+    for (int i = func->nparams; i < func->nvars; i++) {
+        emit("  movl $0, %d(%%rbp)\n", -8 * (i + 1));
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->rpo_index < 0) continue;     // Bloco inalcançável
+
+        char label[128];
+        block_label(block, label, sizeof(label));
+        emit("%s:\n", label);
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            emit_instr(block, instr);
+        }
+    }
+
+    free(vreg_uses);
+    free(vreg_fused);
+    vreg_uses = NULL;
+    vreg_fused = NULL;
+    cur_func = NULL;
+}
+
+/*
+    * Função: ir_generate_x86_to
+    * -------------------------------
+    * Escreve o assembly x86-64 da IR no arquivo já aberto.
+*/
+void ir_generate_x86_to(IrProgram* prog, FILE* out) {
+    x86_file = out;
+    num_strings = 0;
+
+    emit("# Gerado pelo compilador Goianinha (x86-64, System V)\n");
+    emit("  .text\n");
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) {
+        emit_function(func);
+    }
+    emit("%s", x86_runtime);
+
+    emit("\n  .bss\n");
+    emit("  .align 4\n");
+    for (int i = 0; i < prog->nglobals; i++) {
+        emit("gn_g_%s: .zero 4\n", prog->globals[i]->name);
+    }
+    emit("\n  .section .rodata\n");
+    for (int i = 0; i < num_strings; i++) {
+        emit(".Lstr%d: .asciz %s\n", i, string_pool[i]);
+        free(string_pool[i]);
+    }
+    free(string_pool);
+    string_pool = NULL;
+    num_strings = 0;
+
+    emit("\n  .section .note.GNU-stack,\"\",@progbits\n");
+    x86_file = NULL;
+}
+
+/*
+    * Função: ir_generate_x86
+    * -------------------------------
+    * Gera o arquivo de assembly x86-64 a partir da IR, com o runtime de
+    * entrada e saída no final. O executável é obtido com:
+    *   as output.s -o output.o && ld output.o -o programa
+*/
+void ir_generate_x86(IrProgram* prog, const char* output_filename) {
+    FILE* out = fopen(output_filename, "w");
+    if (!out) {
+        perror("Erro ao abrir arquivo de saida x86-64");
+        return;
+    }
+    ir_generate_x86_to(prog, out);
+    fclose(out);
+    fprintf(COMPILE_OUT, "Codigo x86-64 gerado com sucesso no arquivo: %s\n\n", output_filename);
+}
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "line_profile.h"
+
+// Flags de linha de comando
+int line_profile_enabled = 0;               // --profile-lines
+const char* line_profile_source = NULL;     // Programa .g (texto das linhas no relatório)
+
+// Linhas mostradas no relatório; as demais são resumidas em uma linha só
+#define LINE_PROFILE_MAX_ROWS 25
+#define LINE_PROFILE_TEXT_LEN 48
+
+typedef struct {
+    char function[64];
+    int line;
+    long long count;
+    long long cycles;
+} LineEntry;
+
+static LineEntry* entries = NULL;
+static int nentries = 0;
+static int capacity = 0;
+static int sort_by_cycles = 0;
+
+// Acha (ou cria) a entrada de (função, linha)
+static LineEntry* find_entry(LineEntry** table, int* size, int* cap, const char* function, int line) {
+    for (int i = 0; i < *size; i++) {
+        if ((*table)[i].line == line && strcmp((*table)[i].function, function) == 0) return &(*table)[i];
+    }
+    if (*size == *cap) {
+        *cap = *cap ? *cap * 2 : 64;
+        *table = (LineEntry*)realloc(*table, sizeof(LineEntry) * *cap);
+        if (*table == NULL) {
+            perror("Erro de alocação de memória para o perfil por linha");
+            exit(EXIT_FAILURE);
+        }
+    }
+    LineEntry* entry = &(*table)[(*size)++];
+    memset(entry, 0, sizeof(LineEntry));
+    snprintf(entry->function, sizeof(entry->function), "%s", function);
+    entry->line = line;
+    return entry;
+}
+
+void line_profile_add(const char* function, int line, long long count, long long cycles) {
+    if (count == 0 && cycles == 0) return;
+    LineEntry* entry = find_entry(&entries, &nentries, &capacity, function, line);
+    entry->count += count;
+    entry->cycles += cycles;
+}
+
+static int compare_entries(const void* a, const void* b) {
+    const LineEntry* x = (const LineEntry*)a;
+    const LineEntry* y = (const LineEntry*)b;
+    long long kx = sort_by_cycles ? x->cycles : x->count;
+    long long ky = sort_by_cycles ? y->cycles : y->count;
+    if (kx != ky) return kx < ky ? 1 : -1;
+    return x->line - y->line;
+}
+
+/*
+    * Função: source_text
+    * -------------------------------
+    * Copia a linha 'line' do fonte para 'out', sem a indentação e cortada em
+    * LINE_PROFILE_TEXT_LEN caracteres. As linhas do arquivo são lidas uma vez.
+*/
+static void source_text(char** lines, int nlines, int line, char* out, size_t size) {
+    out[0] = '\0';
+    if (line <= 0 || line > nlines || lines[line - 1] == NULL) return;
+
+    const char* text = lines[line - 1];
+    while (*text == ' ' || *text == '\t') text++;
+    size_t length = strcspn(text, "\r\n");
+    while (length > 0 && (text[length - 1] == ' ' || text[length - 1] == '\t')) length--;
+    if (length > LINE_PROFILE_TEXT_LEN) {
+        snprintf(out, size, "%.*s...", LINE_PROFILE_TEXT_LEN - 3, text);
+    } else {
+        snprintf(out, size, "%.*s", (int)length, text);
+    }
+}
+
+static char** read_source_lines(int* nlines) {
+    *nlines = 0;
+    if (line_profile_source == NULL) return NULL;
+    FILE* in = fopen(line_profile_source, "r");
+    if (in == NULL) return NULL;
+
+    char** lines = NULL;
+    int cap = 0;
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), in) != NULL) {
+        if (*nlines == cap) {
+            cap = cap ? cap * 2 : 128;
+            lines = (char**)realloc(lines, sizeof(char*) * cap);
+        }
+        lines[(*nlines)++] = strdup(buffer);
+    }
+    fclose(in);
+    return lines;
+}
+
+static double percent(long long part, long long total) {
+    return total > 0 ? 100.0 * (double)part / (double)total : 0.0;
+}
+
+void line_profile_report(const char* title, const char* unit, int has_cycles) {
+    long long total = 0, total_cycles = 0;
+    for (int i = 0; i < nentries; i++) {
+        total += entries[i].count;
+        total_cycles += entries[i].cycles;
+    }
+    sort_by_cycles = has_cycles;
+
+    // Por função (a linha das entradas agregadas fica em 0)
+    LineEntry* functions = NULL;
+    int nfunctions = 0, functions_cap = 0;
+    for (int i = 0; i < nentries; i++) {
+        LineEntry* f = find_entry(&functions, &nfunctions, &functions_cap, entries[i].function, 0);
+        f->count += entries[i].count;
+        f->cycles += entries[i].cycles;
+    }
+    if (nfunctions > 0) qsort(functions, nfunctions, sizeof(LineEntry), compare_entries);
+    if (nentries > 0) qsort(entries, nentries, sizeof(LineEntry), compare_entries);
+
+    fprintf(stderr, "\n%s\n", title);
+    fprintf(stderr, "  %-20s %14s %7s", "Funcao", unit, "%");
+    if (has_cycles) fprintf(stderr, " %14s %7s", "Ciclos", "%");
+    fprintf(stderr, "\n");
+    for (int i = 0; i < nfunctions; i++) {
+        fprintf(stderr, "  %-20s %14lld %6.1f%%", functions[i].function, functions[i].count,
+                percent(functions[i].count, total));
+        if (has_cycles) fprintf(stderr, " %14lld %6.1f%%", functions[i].cycles, percent(functions[i].cycles, total_cycles));
+        fprintf(stderr, "\n");
+    }
+
+    int nlines;
+    char** lines = read_source_lines(&nlines);
+    char text[LINE_PROFILE_TEXT_LEN + 8];
+
+    fprintf(stderr, "\n  %6s %14s %7s", "Linha", unit, "%");
+    if (has_cycles) fprintf(stderr, " %14s %7s", "Ciclos", "%");
+    fprintf(stderr, "  %-16s %s\n", "Funcao", "Fonte");
+    for (int i = 0; i < nentries && i < LINE_PROFILE_MAX_ROWS; i++) {
+        LineEntry* e = &entries[i];
+        source_text(lines, nlines, e->line, text, sizeof(text));
+        if (e->line > 0) fprintf(stderr, "  %6d", e->line);
+        else fprintf(stderr, "  %6s", "-");
+        fprintf(stderr, " %14lld %6.1f%%", e->count, percent(e->count, total));
+        if (has_cycles) fprintf(stderr, " %14lld %6.1f%%", e->cycles, percent(e->cycles, total_cycles));
+        fprintf(stderr, "  %-16s %s\n", e->function, e->line > 0 ? text : "(sem linha no fonte)");
+    }
+    if (nentries > LINE_PROFILE_MAX_ROWS) {
+        long long rest = 0;
+        for (int i = LINE_PROFILE_MAX_ROWS; i < nentries; i++) rest += entries[i].count;
+        fprintf(stderr, "  ... mais %d linhas com %lld (%.1f%%)\n", nentries - LINE_PROFILE_MAX_ROWS, rest,
+                percent(rest, total));
+    }
+
+    for (int i = 0; i < nlines; i++) free(lines[i]);
+    free(lines);
+    free(functions);
+    free(entries);
+    entries = NULL;
+    nentries = capacity = 0;
+}
@@ -0,0 +1,25 @@
+#ifndef LINE_PROFILE_H
+#define LINE_PROFILE_H
+
+// Perfil por linha do fonte (--profile-lines): acumula contagens por função e
+// por linha do programa .g e imprime as mais quentes primeiro. As contagens
+// vêm do emulador MIPS (instruções e ciclos, pela tabela de linhas) ou de um
+// perfil -fprofile-use (operações da IR por bloco executado).
+
+// Flag de linha de comando e arquivo fonte usado para mostrar o texto das linhas
+extern int line_profile_enabled;
+extern const char* line_profile_source;
+
+/**
+ * Soma 'count' execuções e 'cycles' ciclos à linha 'line' da função 'function'.
+ * A linha 0 reúne o código sem linha de origem.
+ */
+void line_profile_add(const char* function, int line, long long count, long long cycles);
+
+/**
+ * Imprime em stderr as funções e as linhas ordenadas da mais quente para a
+ * mais fria (por ciclos quando 'has_cycles', senão por contagem) e zera o perfil.
+ */
+void line_profile_report(const char* title, const char* unit, int has_cycles);
+
+#endif // LINE_PROFILE_H
@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "mips.h"
+#include "./../Relatorio/time_report.h"
+
+// Lista da seção .text (preenchida por append_text em codigo.c)
+MipsList text_section = { NULL, NULL, 0 };
+
+// Linha do fonte atribuída às próximas linhas da lista (definida pelos geradores)
+int mips_source_line = 0;
+
+
+// IMPLEMENTAÇÃO DA LISTA DE INSTRUÇÕES
+
+// Aloca um nó zerado da lista
+static MipsInstr* new_mips_instr(MipsKind kind) {
+    MipsInstr* instr = (MipsInstr*)malloc(sizeof(MipsInstr));
+    if (instr == NULL) {
+        perror("Erro de alocação de memória para MipsInstr");
+        exit(EXIT_FAILURE);
+    }
+    memset(instr, 0, sizeof(MipsInstr));
+    instr->kind = kind;
+    return instr;
+}
+
+// Encadeia 'instr' antes de 'pos' (ou no final quando 'pos' é NULL)
+static void link_before(MipsList* list, MipsInstr* pos, MipsInstr* instr) {
+    if (pos == NULL) {
+        instr->prev = list->tail;
+        if (list->tail) list->tail->next = instr;
+        else list->head = instr;
+        list->tail = instr;
+    } else {
+        instr->next = pos;
+        instr->prev = pos->prev;
+        if (pos->prev) pos->prev->next = instr;
+        else list->head = instr;
+        pos->prev = instr;
+    }
+    list->count++;
+}
+
+// Copia 'src' para 'dst' removendo espaços nas pontas
+static void copy_trimmed(char* dst, size_t size, const char* src, size_t len) {
+    while (len > 0 && isspace((unsigned char)*src)) { src++; len--; }
+    while (len > 0 && isspace((unsigned char)src[len - 1])) len--;
+    if (len >= size) len = size - 1;
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+void mips_list_append_line(MipsList* list, const char* line) {
+    const char* p = line;
+    while (*p == ' ' || *p == '\t') p++;
+
+    MipsInstr* instr;
+    size_t len = strlen(p);
+
+    if (*p == '\0' || *p == '#') {
+        // Linha em branco ou comentário
+        instr = new_mips_instr(MIPS_COMMENT);
+        instr->text = strdup(line);
+    } else if (*p == '.') {
+        instr = new_mips_instr(MIPS_DIRECTIVE);
+        instr->text = strdup(line);
+    } else if (p[len - 1] == ':' && strpbrk(p, " \t,") == NULL) {
+        // Rótulo: o nome fica em args[0] para facilitar comparações
+        instr = new_mips_instr(MIPS_LABEL);
+        instr->text = strdup(line);
+        copy_trimmed(instr->args[0], MIPS_ARG_LEN, p, len - 1);
+        instr->nargs = 1;
+    } else {
+        instr = new_mips_instr(MIPS_INSTR);
+
+        // Ignora comentário no final da linha
+        const char* end = strchr(p, '#');
+        if (end == NULL) end = p + len;
+
+        // Mnemônico
+        const char* q = p;
+        while (q < end && !isspace((unsigned char)*q)) q++;
+        copy_trimmed(instr->op, sizeof(instr->op), p, q - p);
+
+        // Operandos separados por vírgula
+        while (q < end && instr->nargs < MIPS_MAX_ARGS) {
+            while (q < end && isspace((unsigned char)*q)) q++;
+            if (q >= end) break;
+            const char* comma = memchr(q, ',', end - q);
+            const char* stop = comma ? comma : end;
+            copy_trimmed(instr->args[instr->nargs++], MIPS_ARG_LEN, q, stop - q);
+            q = comma ? comma + 1 : end;
+        }
+    }
+
+    instr->lineno = mips_source_line;
+    link_before(list, NULL, instr);
+}
+
+MipsInstr* mips_list_insert_before(MipsList* list, MipsInstr* pos, const char* op,
+                                   const char* a0, const char* a1, const char* a2) {
+    MipsInstr* instr = new_mips_instr(MIPS_INSTR);
+    const char* args[MIPS_MAX_ARGS] = { a0, a1, a2 };
+
+    snprintf(instr->op, sizeof(instr->op), "%s", op);
+    for (int i = 0; i < MIPS_MAX_ARGS && args[i] != NULL; i++) {
+        snprintf(instr->args[i], MIPS_ARG_LEN, "%s", args[i]);
+        instr->nargs++;
+    }
+
+    // Instruções inseridas pelos otimizadores ficam com a linha da vizinha
+    MipsInstr* neighbor = pos ? pos : list->tail;
+    instr->lineno = neighbor ? neighbor->lineno : 0;
+
+    link_before(list, pos, instr);
+    return instr;
+}
+
+void mips_list_remove(MipsList* list, MipsInstr* instr) {
+    if (instr->prev) instr->prev->next = instr->next;
+    else list->head = instr->next;
+    if (instr->next) instr->next->prev = instr->prev;
+    else list->tail = instr->prev;
+
+    list->count--;
+    free(instr->text);
+    free(instr);
+}
+
+void mips_list_clear(MipsList* list) {
+    MipsInstr* current = list->head;
+    while (current != NULL) {
+        MipsInstr* temp = current;
+        current = current->next;
+        free(temp->text);
+        free(temp);
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+}
+
+void mips_list_write(MipsList* list, FILE* out) {
+    for (MipsInstr* instr = list->head; instr != NULL; instr = instr->next) {
+        if (instr->kind != MIPS_INSTR) {
+            fprintf(out, "%s\n", instr->text);
+            continue;
+        }
+
+        time_counters.instrs_emitted++;
+        fprintf(out, "  %s", instr->op);
+        for (int i = 0; i < instr->nargs; i++) {
+            fprintf(out, "%s%s", i == 0 ? " " : ", ", instr->args[i]);
+        }
+        fprintf(out, "\n");
+    }
+}
+
+void mips_line_table_name(const char* asm_filename, char* out, size_t size) {
+    const char* dot = strrchr(asm_filename, '.');
+    const char* slash = strrchr(asm_filename, '/');
+    int length = (dot != NULL && (slash == NULL || dot > slash)) ? (int)(dot - asm_filename) : (int)strlen(asm_filename);
+    snprintf(out, size, "%.*s.linhas", length, asm_filename);
+}
+
+/*
+    * Função: mips_write_line_table
+    * -------------------------------
+    * A seção .text é escrita por mips_list_write com uma linha por nó, então
+    * basta achar a linha do ".text" no arquivo e contar a partir dela. A
+    * função corrente é a da última diretiva .globl vista.
+*/
+int mips_write_line_table(MipsList* list, const char* asm_filename) {
+    FILE* in = fopen(asm_filename, "r");
+    if (in == NULL) return 0;
+
+    char buffer[512];
+    int line = 0, text_line = 0;
+    while (text_line == 0 && fgets(buffer, sizeof(buffer), in) != NULL) {
+        line++;
+        if (strncmp(buffer, ".text", 5) == 0) text_line = line;
+    }
+    fclose(in);
+
+    char filename[256];
+    mips_line_table_name(asm_filename, filename, sizeof(filename));
+    FILE* out = fopen(filename, "w");
+    if (out == NULL) return 0;
+
+    fprintf(out, "# Tabela de linhas de %s\n", asm_filename);
+    fprintf(out, "# linha_asm linha_fonte funcao\n");
+
+    char function[MIPS_ARG_LEN] = "-";
+    line = text_line;
+    for (MipsInstr* instr = list->head; instr != NULL; instr = instr->next) {
+        line++;
+        if (instr->kind == MIPS_DIRECTIVE) {
+            sscanf(instr->text, " .globl %63s", function);
+        }
+        if (instr->kind == MIPS_INSTR) {
+            fprintf(out, "%d %d %s\n", line, instr->lineno, function);
+        }
+    }
+    fclose(out);
+    return 1;
+}
+
+MipsInstr* mips_next_code(MipsInstr* instr) {
+    instr = instr ? instr->next : NULL;
+    while (instr != NULL && instr->kind == MIPS_COMMENT) instr = instr->next;
+    return instr;
+}
+
+MipsInstr* mips_prev_code(MipsInstr* instr) {
+    instr = instr ? instr->prev : NULL;
+    while (instr != NULL && instr->kind == MIPS_COMMENT) instr = instr->prev;
+    return instr;
+}
+
+
+// MODELO DE DEFINIÇÃO/USO DE REGISTRADORES
+
+static int op_is(const MipsInstr* instr, const char* op) {
+    return strcmp(instr->op, op) == 0;
+}
+
+// Instruções que não escrevem em args[0] (lojas, desvios, mult/div, etc.)
+static int has_no_dest(const MipsInstr* instr) {
+    static const char* no_dest[] = {
+        "sw", "sb", "sh", "mult", "multu", "div", "divu", "j", "jal", "jr", "jalr",
+        "beq", "bne", "blt", "bgt", "ble", "bge", "beqz", "bnez", "bltz", "bgtz",
+        "blez", "bgez", "syscall", "nop"
+    };
+    for (size_t i = 0; i < sizeof(no_dest) / sizeof(no_dest[0]); i++) {
+        if (op_is(instr, no_dest[i])) return 1;
+    }
+    return 0;
+}
+
+// Operando usa 'reg' diretamente ou como base de endereço (ex: -4($fp))
+static int operand_uses_reg(const char* arg, const char* reg) {
+    if (strcmp(arg, reg) == 0) return 1;
+
+    const char* open = strchr(arg, '(');
+    if (open == NULL) return 0;
+    size_t len = strlen(reg);
+    return strncmp(open + 1, reg, len) == 0 && open[1 + len] == ')';
+}
+
+// Retorna 1 se o registrador é temporário ($t0-$t9), preservado pelo chamador
+static int is_temp_reg(const char* reg) {
+    return reg[0] == '$' && reg[1] == 't' && isdigit((unsigned char)reg[2]);
+}
+
+// Retorna 1 se o registrador é de argumento ($a0-$a3)
+static int is_arg_reg(const char* reg) {
+    return reg[0] == '$' && reg[1] == 'a' && isdigit((unsigned char)reg[2]);
+}
+
+int mips_is_control(const MipsInstr* instr) {
+    if (instr->kind != MIPS_INSTR) return 0;
+    return instr->op[0] == 'b' || op_is(instr, "j") || op_is(instr, "jal") ||
+           op_is(instr, "jr") || op_is(instr, "jalr") || op_is(instr, "syscall");
+}
+
+int mips_reads_reg(const MipsInstr* instr, const char* reg) {
+    if (instr->kind != MIPS_INSTR) return 0;
+
+    if (op_is(instr, "syscall")) {
+        return strcmp(reg, "$v0") == 0 || strcmp(reg, "$a0") == 0 || strcmp(reg, "$a1") == 0;
+    }
+    if (op_is(instr, "jal")) {
+        // O chamado lê os argumentos e os ponteiros de pilha/frame/globais
+        return is_arg_reg(reg) || strcmp(reg, "$sp") == 0 || strcmp(reg, "$fp") == 0 ||
+               strcmp(reg, "$gp") == 0;
+    }
+    if (op_is(instr, "mflo")) return strcmp(reg, "$lo") == 0;
+    if (op_is(instr, "mfhi")) return strcmp(reg, "$hi") == 0;
+    if (op_is(instr, "j")) return 0;
+
+    // Lojas e desvios leem todos os operandos; as demais leem a partir do segundo
+    int first = has_no_dest(instr) ? 0 : 1;
+    for (int i = first; i < instr->nargs; i++) {
+        if (operand_uses_reg(instr->args[i], reg)) return 1;
+    }
+
+    // Loads leem apenas a base do endereço, que já foi tratada acima
+    return 0;
+}
+
+int mips_writes_reg(const MipsInstr* instr, const char* reg) {
+    if (instr->kind != MIPS_INSTR) return 0;
+
+    if (op_is(instr, "syscall")) return strcmp(reg, "$v0") == 0;
+    if (op_is(instr, "jal")) {
+        // Convenção: o chamado pode destruir $ra, $v*, $a*, $t*, $hi e $lo
+        return strcmp(reg, "$ra") == 0 || strncmp(reg, "$v", 2) == 0 || is_arg_reg(reg) ||
+               is_temp_reg(reg) || strcmp(reg, "$hi") == 0 || strcmp(reg, "$lo") == 0;
+    }
+    if (op_is(instr, "mult") || op_is(instr, "multu") || op_is(instr, "div") || op_is(instr, "divu")) {
+        return strcmp(reg, "$hi") == 0 || strcmp(reg, "$lo") == 0;
+    }
+    if (has_no_dest(instr) || instr->nargs == 0) return 0;
+
+    return strcmp(instr->args[0], reg) == 0;
+}
+
+int mips_reg_dead_from(MipsInstr* from, const char* reg) {
+    for (MipsInstr* instr = from; instr != NULL; instr = instr->next) {
+        if (instr->kind == MIPS_COMMENT) continue;
+
+        // Rótulos e diretivas podem ser alcançados por outros caminhos
+        if (instr->kind != MIPS_INSTR) return 0;
+
+        if (mips_reads_reg(instr, reg)) return 0;
+        if (mips_writes_reg(instr, reg)) return 1;
+
+        // No retorno, temporários e argumentos não são mais lidos
+        if (op_is(instr, "jr")) return is_temp_reg(reg) || is_arg_reg(reg);
+
+        // Demais saltos e desvios: assume que o valor continua vivo
+        if (mips_is_control(instr) && !op_is(instr, "syscall")) return 0;
+    }
+    return 1;
+}
+
+int mips_replace_reads(MipsInstr* instr, const char* from, const char* to) {
+    // Chamadas, saltos e syscall leem registradores implicitamente
+    if (instr->kind != MIPS_INSTR || op_is(instr, "jal") || op_is(instr, "j") || op_is(instr, "syscall")) {
+        return 0;
+    }
+
+    int replaced = 0;
+    int first = has_no_dest(instr) ? 0 : 1;
+    for (int i = first; i < instr->nargs; i++) {
+        char* arg = instr->args[i];
+        if (strcmp(arg, from) == 0) {
+            snprintf(arg, MIPS_ARG_LEN, "%s", to);
+            replaced++;
+        } else if (operand_uses_reg(arg, from)) {
+            // Troca apenas a base: off(from) -> off(to)
+            char* base = strchr(arg, '(') + 1;
+            size_t room = MIPS_ARG_LEN - (base - arg);
+            snprintf(base, room, "%s)", to);
+            replaced++;
+        }
+    }
+    return replaced;
+}
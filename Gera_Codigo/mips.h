@@ -0,0 +1,141 @@
+#ifndef MIPS_H
+#define MIPS_H
+
+#include <stdio.h>
+
+// Tipos de linha da listagem MIPS
+typedef enum {
+    MIPS_INSTR,     // Instrução (ex: lw $t0, -4($fp))
+    MIPS_LABEL,     // Rótulo (ex: L3:)
+    MIPS_DIRECTIVE, // Diretiva (ex: .globl main)
+    MIPS_COMMENT,   // Comentário ou linha em branco (mantidos apenas para leitura)
+} MipsKind;
+
+#define MIPS_MAX_ARGS 3
+#define MIPS_ARG_LEN  64
+
+// Uma linha da seção .text, já separada em operação e operandos
+typedef struct MipsInstr {
+    MipsKind kind;
+    char op[16];                            // Mnemônico (somente MIPS_INSTR)
+    char args[MIPS_MAX_ARGS][MIPS_ARG_LEN]; // Operandos (somente MIPS_INSTR)
+    int nargs;
+    char* text;                             // Texto original (rótulo, diretiva ou comentário)
+    int lineno;                             // Linha do programa .g que gerou a instrução (0 se nenhuma)
+
+    struct MipsInstr* prev;
+    struct MipsInstr* next;
+} MipsInstr;
+
+// Lista duplamente encadeada com as linhas da seção .text
+typedef struct {
+    MipsInstr* head;
+    MipsInstr* tail;
+    int count;
+} MipsList;
+
+// Lista da seção .text preenchida por codigo.c
+extern MipsList text_section;
+
+// Linha do programa .g sendo traduzida: cada linha adicionada à lista recebe esse valor
+extern int mips_source_line;
+
+// Flag de linha de comando: 0 desliga o otimizador peephole (-fno-peephole)
+extern int peephole_enabled;
+
+// Flags do escalonador (scheduler.c): -fno-schedule e --delay-slots
+extern int schedule_enabled;
+extern int delay_slots_enabled;
+
+/**
+ * Interpreta uma linha de assembly e a adiciona ao final da lista.
+ * @param list A lista de destino.
+ * @param line A linha (sem o '\n').
+ */
+void mips_list_append_line(MipsList* list, const char* line);
+
+/**
+ * Insere uma instrução já montada antes de 'pos' (ou no final se 'pos' for NULL).
+ * @return A instrução criada.
+ */
+MipsInstr* mips_list_insert_before(MipsList* list, MipsInstr* pos, const char* op,
+                                   const char* a0, const char* a1, const char* a2);
+
+/**
+ * Remove e libera uma linha da lista.
+ */
+void mips_list_remove(MipsList* list, MipsInstr* instr);
+
+/**
+ * Libera todas as linhas da lista.
+ */
+void mips_list_clear(MipsList* list);
+
+/**
+ * Escreve a lista no arquivo, uma linha por nó.
+ */
+void mips_list_write(MipsList* list, FILE* out);
+
+/**
+ * Nome da tabela de linhas que acompanha um arquivo .asm (output.asm -> output.linhas).
+ */
+void mips_line_table_name(const char* asm_filename, char* out, size_t size);
+
+/**
+ * Escreve a tabela de linhas de um arquivo .asm já gravado a partir da lista:
+ * uma linha "linha_asm linha_fonte funcao" por instrução da seção .text.
+ * @return 1 em caso de sucesso, 0 se algum dos arquivos não pôde ser aberto.
+ */
+int mips_write_line_table(MipsList* list, const char* asm_filename);
+
+/**
+ * Próxima (ou anterior) instrução real, pulando comentários e linhas em branco.
+ * Rótulos e diretivas NÃO são pulados, pois delimitam blocos básicos.
+ */
+MipsInstr* mips_next_code(MipsInstr* instr);
+MipsInstr* mips_prev_code(MipsInstr* instr);
+
+// --- Modelo de definição/uso de registradores ---
+
+/** Retorna 1 se a instrução lê o registrador 'reg' (ex: "$t0"). */
+int mips_reads_reg(const MipsInstr* instr, const char* reg);
+
+/** Retorna 1 se a instrução escreve no registrador 'reg'. */
+int mips_writes_reg(const MipsInstr* instr, const char* reg);
+
+/** Retorna 1 para desvios, saltos, chamadas e syscall (fim de bloco básico). */
+int mips_is_control(const MipsInstr* instr);
+
+/** Retorna 1 se o valor de 'reg' não é mais lido a partir de 'from' (inclusive). */
+int mips_reg_dead_from(MipsInstr* from, const char* reg);
+
+/**
+ * Troca as leituras explícitas de 'from' por 'to' (inclusive bases de endereço).
+ * @return Quantos operandos foram trocados.
+ */
+int mips_replace_reads(MipsInstr* instr, const char* from, const char* to);
+
+/**
+ * Executa o otimizador peephole sobre a lista e imprime quantas vezes cada regra foi aplicada.
+ */
+void peephole_optimize(MipsList* list);
+
+/**
+ * Troca o modelo de latência do escalonador a partir de "op:ciclos,op:ciclos".
+ * @return 1 em caso de sucesso, 0 se a lista é inválida.
+ */
+int mips_set_latencies(const char* spec);
+
+/**
+ * Latência de uma operação no modelo atual (1 se ela não aparece na tabela).
+ * Usada também pelo emulador para estimar ciclos.
+ */
+int mips_op_latency(const char* op);
+
+/**
+ * Escalona as instruções de cada bloco básico pelo modelo de latência e, com
+ * --delay-slots, preenche o delay slot de cada desvio e salto.
+ */
+void mips_schedule(MipsList* list);
+
+#endif // MIPS_H
@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mips.h"
+#include "./../AST/ast.h"
+
+// Flag de linha de comando (-fno-peephole desliga o otimizador)
+int peephole_enabled = 1;
+
+// Tamanho máximo das sequências entre o empilhamento e o desempilhamento
+#define PEEPHOLE_STACK_WINDOW 6
+
+// Uma regra recebe a primeira instrução da janela e retorna 1 se alterou a lista
+typedef int (*PeepholeRuleFn)(MipsList* list, MipsInstr* first);
+
+typedef struct {
+    const char* name;
+    PeepholeRuleFn apply;
+    int fired;
+} PeepholeRule;
+
+
+// --- Funções auxiliares ---
+
+static int is_instr(const MipsInstr* instr, const char* op) {
+    return instr != NULL && instr->kind == MIPS_INSTR && strcmp(instr->op, op) == 0;
+}
+
+// Instrução simples que apenas escreve args[0] (sem memória, desvio ou efeito colateral)
+static int is_pure_def(const MipsInstr* instr) {
+    static const char* pure[] = {
+        "li", "la", "lui", "move", "lw", "add", "addu", "addi", "addiu", "sub", "subu",
+        "slt", "slti", "sltu", "sltiu", "and", "andi", "or", "ori", "xor", "xori",
+        "sll", "srl", "sra", "neg", "not", "mflo", "mfhi", "mul"
+    };
+    if (instr == NULL || instr->kind != MIPS_INSTR || instr->nargs == 0) return 0;
+    for (size_t i = 0; i < sizeof(pure) / sizeof(pure[0]); i++) {
+        if (strcmp(instr->op, pure[i]) == 0) return 1;
+    }
+    return 0;
+}
+
+// Instrução "addi R, R, imediato" (ajuste de ponteiro)
+static int is_self_addi(const MipsInstr* instr, const char* reg, int* imm) {
+    if (!is_instr(instr, "addi") || instr->nargs != 3) return 0;
+    if (strcmp(instr->args[0], instr->args[1]) != 0) return 0;
+    if (reg != NULL && strcmp(instr->args[0], reg) != 0) return 0;
+    if (imm) *imm = atoi(instr->args[2]);
+    return 1;
+}
+
+// Instrução que não interfere na pilha nem no registrador 'reg'
+static int is_stack_neutral(const MipsInstr* instr, const char* reg) {
+    if (instr == NULL || instr->kind != MIPS_INSTR || mips_is_control(instr)) return 0;
+    if (mips_reads_reg(instr, "$sp") || mips_writes_reg(instr, "$sp")) return 0;
+    if (reg != NULL && (mips_reads_reg(instr, reg) || mips_writes_reg(instr, reg))) return 0;
+    return 1;
+}
+
+
+// --- Regras ---
+
+// move R, R  ->  (removida)
+static int rule_self_move(MipsList* list, MipsInstr* first) {
+    if (!is_instr(first, "move") || strcmp(first->args[0], first->args[1]) != 0) return 0;
+    mips_list_remove(list, first);
+    return 1;
+}
+
+// move A, B ; op ...A...  ->  op ...B...  (e remove o move se A morreu)
+// Cobre "move $t0, $v0 ; move $a0, $t0" e "move $t1, $fp ; lw $t0, -4($t1)"
+static int rule_copy_propagation(MipsList* list, MipsInstr* first) {
+    if (!is_instr(first, "move")) return 0;
+
+    const char* dst = first->args[0];
+    const char* src = first->args[1];
+    if (strcmp(dst, src) == 0 || strcmp(dst, "$zero") == 0) return 0;
+
+    MipsInstr* use = mips_next_code(first);
+    if (use == NULL || use->kind != MIPS_INSTR || !mips_reads_reg(use, dst)) return 0;
+    if (mips_replace_reads(use, dst, src) == 0) return 0;
+
+    // O move só pode sair se ninguém mais lê o valor copiado
+    if (!mips_reads_reg(use, dst) &&
+        (mips_writes_reg(use, dst) || mips_reg_dead_from(use->next, dst))) {
+        mips_list_remove(list, first);
+    }
+    return 1;
+}
+
+// op A, ... ; move B, A  ->  op B, ...  (se A não é mais lido)
+static int rule_redirect_dest(MipsList* list, MipsInstr* first) {
+    if (!is_pure_def(first)) return 0;
+
+    MipsInstr* copy = mips_next_code(first);
+    if (!is_instr(copy, "move")) return 0;
+
+    const char* reg = first->args[0];
+    if (strcmp(copy->args[1], reg) != 0 || strcmp(copy->args[0], reg) == 0) return 0;
+    if (strcmp(copy->args[0], "$zero") == 0) return 0;
+    if (!mips_reg_dead_from(copy->next, reg)) return 0;
+
+    snprintf(first->args[0], MIPS_ARG_LEN, "%s", copy->args[0]);
+    mips_list_remove(list, copy);
+    return 1;
+}
+
+// sw R, M ; lw R2, M  ->  sw R, M ; move R2, R  (ou nada se R2 == R)
+static int rule_store_load(MipsList* list, MipsInstr* first) {
+    if (!is_instr(first, "sw")) return 0;
+
+    MipsInstr* load = mips_next_code(first);
+    if (!is_instr(load, "lw") || strcmp(load->args[1], first->args[1]) != 0) return 0;
+
+    if (strcmp(load->args[0], first->args[0]) == 0) {
+        mips_list_remove(list, load);
+    } else {
+        snprintf(load->op, sizeof(load->op), "move");
+        snprintf(load->args[1], MIPS_ARG_LEN, "%s", first->args[0]);
+    }
+    return 1;
+}
+
+// sw R, 0($sp) ; addi $sp, $sp, -4 ; X... ; lw R2, 4($sp) ; Y... ; addi $sp, $sp, 4
+//   ->  move R2, R ; X... ; Y...
+// Valor temporário guardado na pilha apenas para sobreviver a uma subexpressão simples.
+static int rule_stack_temp(MipsList* list, MipsInstr* first) {
+    int imm;
+    if (!is_instr(first, "sw") || strcmp(first->args[1], "0($sp)") != 0) return 0;
+
+    MipsInstr* push = mips_next_code(first);
+    if (!is_self_addi(push, "$sp", &imm) || imm != -4) return 0;
+
+    // X: instruções entre o empilhamento e o desempilhamento
+    MipsInstr* load = mips_next_code(push);
+    int steps = 0;
+    while (load != NULL && !(is_instr(load, "lw") && strcmp(load->args[1], "4($sp)") == 0)) {
+        if (++steps > PEEPHOLE_STACK_WINDOW) return 0;
+        load = mips_next_code(load);
+    }
+    if (load == NULL) return 0;
+
+    const char* saved = first->args[0];
+    const char* reloaded = load->args[0];
+    if (strcmp(saved, reloaded) == 0) return 0;
+
+    for (MipsInstr* x = mips_next_code(push); x != load; x = mips_next_code(x)) {
+        if (!is_stack_neutral(x, reloaded)) return 0;
+    }
+
+    // Y: instruções entre o desempilhamento e a liberação do espaço
+    MipsInstr* pop = mips_next_code(load);
+    steps = 0;
+    while (pop != NULL && !is_self_addi(pop, "$sp", NULL)) {
+        if (++steps > PEEPHOLE_STACK_WINDOW || !is_stack_neutral(pop, NULL)) return 0;
+        pop = mips_next_code(pop);
+    }
+    if (pop == NULL || !is_self_addi(pop, "$sp", &imm) || imm != 4) return 0;
+
+    // Copia para o registrador de destino antes de X
+    char saved_reg[MIPS_ARG_LEN];
+    snprintf(saved_reg, sizeof(saved_reg), "%s", saved);
+    snprintf(first->op, sizeof(first->op), "move");
+    snprintf(first->args[0], MIPS_ARG_LEN, "%s", reloaded);
+    snprintf(first->args[1], MIPS_ARG_LEN, "%s", saved_reg);
+    mips_list_remove(list, push);
+    mips_list_remove(list, load);
+    mips_list_remove(list, pop);
+    return 1;
+}
+
+// addi R, R, a ; addi R, R, b  ->  addi R, R, a+b  (ou nada se a+b == 0)
+static int rule_merge_addi(MipsList* list, MipsInstr* first) {
+    int a, b;
+    if (!is_self_addi(first, NULL, &a)) return 0;
+
+    MipsInstr* second = mips_next_code(first);
+    if (!is_self_addi(second, first->args[0], &b)) return 0;
+
+    mips_list_remove(list, second);
+    if (a + b == 0) {
+        mips_list_remove(list, first);
+    } else {
+        snprintf(first->args[2], MIPS_ARG_LEN, "%d", a + b);
+    }
+    return 1;
+}
+
+// j L ; L:  ->  L:
+static int rule_jump_to_next(MipsList* list, MipsInstr* first) {
+    if (!is_instr(first, "j")) return 0;
+
+    for (MipsInstr* next = mips_next_code(first); next != NULL && next->kind == MIPS_LABEL;
+         next = mips_next_code(next)) {
+        if (strcmp(next->args[0], first->args[0]) == 0) {
+            mips_list_remove(list, first);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// op $tN, ...  ->  (removida) quando $tN nunca é lido
+static int rule_dead_temp(MipsList* list, MipsInstr* first) {
+    if (!is_pure_def(first) || first->args[0][1] != 't') return 0;
+    if (!mips_reg_dead_from(first->next, first->args[0])) return 0;
+
+    mips_list_remove(list, first);
+    return 1;
+}
+
+// Tabela de regras, aplicadas na ordem em cada posição
+static PeepholeRule peephole_rules[] = {
+    { "move-redundante",       rule_self_move,        0 },
+    { "empilha-desempilha",    rule_stack_temp,       0 },
+    { "load-apos-store",       rule_store_load,       0 },
+    { "propagacao-de-copia",   rule_copy_propagation, 0 },
+    { "destino-redirecionado", rule_redirect_dest,    0 },
+    { "ajuste-sp-consecutivo", rule_merge_addi,       0 },
+    { "salto-para-proximo",    rule_jump_to_next,     0 },
+    { "temporario-morto",      rule_dead_temp,        0 },
+};
+
+#define NUM_PEEPHOLE_RULES (int)(sizeof(peephole_rules) / sizeof(peephole_rules[0]))
+
+/*
+    * Função: count_instructions
+    * -------------------------------
+    * Conta apenas as instruções reais da lista (sem rótulos e comentários).
+*/
+static int count_instructions(MipsList* list) {
+    int count = 0;
+    for (MipsInstr* instr = list->head; instr != NULL; instr = instr->next) {
+        if (instr->kind == MIPS_INSTR) count++;
+    }
+    return count;
+}
+
+/*
+    * Função: peephole_optimize
+    * -------------------------------
+    * Percorre a lista aplicando a tabela de regras em cada instrução até que
+    * nenhuma regra dispare mais (ponto fixo). Depois imprime quantas vezes cada
+    * regra foi aplicada.
+*/
+void peephole_optimize(MipsList* list) {
+    int before = count_instructions(list);
+    int changed = 1;
+
+    for (int i = 0; i < NUM_PEEPHOLE_RULES; i++) {
+        peephole_rules[i].fired = 0;
+    }
+
+    while (changed) {
+        changed = 0;
+        MipsInstr* current = list->head;
+
+        while (current != NULL) {
+            if (current->kind != MIPS_INSTR) {
+                current = current->next;
+                continue;
+            }
+
+            // As regras só removem nós da janela que começa em 'current',
+            // então o nó anterior continua válido para recomeçar dali.
+            MipsInstr* anchor = current->prev;
+            int applied = 0;
+
+            for (int i = 0; i < NUM_PEEPHOLE_RULES; i++) {
+                if (peephole_rules[i].apply(list, current)) {
+                    peephole_rules[i].fired++;
+                    applied = 1;
+                    break;
+                }
+            }
+
+            if (applied) {
+                changed = 1;
+                current = anchor ? anchor->next : list->head;
+            } else {
+                current = current->next;
+            }
+        }
+    }
+
+    int after = count_instructions(list);
+
+    fprintf(COMPILE_OUT, "Otimizador peephole: %d -> %d instrucoes\n", before, after);
+    for (int i = 0; i < NUM_PEEPHOLE_RULES; i++) {
+        fprintf(COMPILE_OUT, "  %-24s %d\n", peephole_rules[i].name, peephole_rules[i].fired);
+    }
+}
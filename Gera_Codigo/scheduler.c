@@ -0,0 +1,461 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mips.h"
+#include "./../AST/ast.h"
+
+// Flags de linha de comando
+int schedule_enabled = 1;           // -fno-schedule desliga o escalonador
+int delay_slots_enabled = 0;        // --delay-slots preenche os delay slots de desvios e saltos
+
+// Máximo de instruções escalonadas juntas (blocos maiores são divididos)
+#define SCHED_MAX_REGION 256
+
+// Modelo de latência: ciclos entre a emissão de uma instrução e a de outra
+// que lê o seu resultado. Operações que não aparecem na tabela levam 1 ciclo.
+typedef struct {
+    char op[16];
+    int latency;
+} MipsLatency;
+
+#define SCHED_MAX_LATENCIES 32
+
+// Padrão: pipeline clássico de 5 estágios (R3000), com load delay de 1 ciclo
+static MipsLatency latency_model[SCHED_MAX_LATENCIES] = {
+    { "lw", 2 }, { "mult", 12 }, { "multu", 12 }, { "div", 35 }, { "divu", 35 },
+};
+static int num_latencies = 5;
+
+// Registradores acompanhados pelo grafo de dependências ($hi e $lo incluídos)
+static const char* sched_regs[] = {
+    "$zero", "$at", "$v0", "$v1", "$a0", "$a1", "$a2", "$a3",
+    "$t0", "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9",
+    "$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7",
+    "$gp", "$sp", "$fp", "$ra", "$hi", "$lo",
+};
+#define SCHED_NUM_REGS (int)(sizeof(sched_regs) / sizeof(sched_regs[0]))
+
+// Uma instrução da região sendo escalonada
+typedef struct {
+    MipsInstr* instr;
+    MipsInstr* comments;        // Primeiro comentário logo antes da instrução (vai junto com ela)
+    uint64_t reads, writes;
+    int is_load, is_store;
+    int latency;
+    int priority;               // Maior caminho (em ciclos) até o fim da região
+    int npreds;                 // Predecessores ainda não escalonados
+    int issue;                  // Ciclo em que foi emitida
+    int done;
+} SchedNode;
+
+// Totais impressos no final
+static int stalls_before = 0;
+static int stalls_after = 0;
+static int slots_filled = 0;
+static int slots_nop = 0;
+
+
+// --- Modelo de latência ---
+
+int mips_op_latency(const char* op) {
+    for (int i = 0; i < num_latencies; i++) {
+        if (strcmp(latency_model[i].op, op) == 0) return latency_model[i].latency;
+    }
+    return 1;
+}
+
+static int instruction_latency(const MipsInstr* instr) {
+    return mips_op_latency(instr->op);
+}
+
+/*
+    * Função: mips_set_latencies
+    * -------------------------------
+    * Lê uma lista "op:ciclos,op:ciclos" (ex: "lw:3,mult:6") e altera o modelo
+    * de latência do escalonador.
+    *
+    * Retorna: 1 em caso de sucesso, 0 se a lista é inválida.
+*/
+int mips_set_latencies(const char* spec) {
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "%s", spec);
+
+    for (char* item = strtok(buffer, ","); item != NULL; item = strtok(NULL, ",")) {
+        char* colon = strchr(item, ':');
+        if (colon == NULL || colon == item || atoi(colon + 1) < 1) return 0;
+        *colon = '\0';
+
+        int found = 0;
+        for (int i = 0; i < num_latencies && !found; i++) {
+            if (strcmp(latency_model[i].op, item) == 0) {
+                latency_model[i].latency = atoi(colon + 1);
+                found = 1;
+            }
+        }
+        if (!found) {
+            if (num_latencies == SCHED_MAX_LATENCIES) return 0;
+            snprintf(latency_model[num_latencies].op, sizeof(latency_model[num_latencies].op), "%s", item);
+            latency_model[num_latencies++].latency = atoi(colon + 1);
+        }
+    }
+    return 1;
+}
+
+
+// --- Grafo de dependências ---
+
+static int is_load(const MipsInstr* instr) {
+    return strcmp(instr->op, "lw") == 0 || strcmp(instr->op, "lb") == 0 || strcmp(instr->op, "lbu") == 0;
+}
+
+static int is_store(const MipsInstr* instr) {
+    return strcmp(instr->op, "sw") == 0 || strcmp(instr->op, "sb") == 0;
+}
+
+// Separa "off(base)" em deslocamento e registrador base
+static int split_address(const char* arg, int* offset, char* base, size_t size) {
+    const char* open = strchr(arg, '(');
+    const char* close = open ? strchr(open, ')') : NULL;
+    if (open == NULL || close == NULL || (size_t)(close - open - 1) >= size) return 0;
+    *offset = atoi(arg);
+    memcpy(base, open + 1, close - open - 1);
+    base[close - open - 1] = '\0';
+    return 1;
+}
+
+/*
+    * Função: may_alias
+    * -------------------------------
+    * Dois acessos à memória podem tocar a mesma palavra? Mesma base com
+    * deslocamentos diferentes não colide (uma escrita na base entre os dois
+    * já cria dependência pelos registradores), e globais ($gp) não colidem
+    * com a pilha ($sp/$fp). Qualquer outro caso é tratado como colisão.
+*/
+static int may_alias(const MipsInstr* a, const MipsInstr* b) {
+    int offset_a, offset_b;
+    char base_a[16], base_b[16];
+    if (!split_address(a->args[1], &offset_a, base_a, sizeof(base_a)) ||
+        !split_address(b->args[1], &offset_b, base_b, sizeof(base_b))) {
+        return 1;
+    }
+    if (strcmp(base_a, base_b) == 0) return offset_a == offset_b;
+
+    int stack_a = strcmp(base_a, "$sp") == 0 || strcmp(base_a, "$fp") == 0;
+    int stack_b = strcmp(base_b, "$sp") == 0 || strcmp(base_b, "$fp") == 0;
+    if ((stack_a && strcmp(base_b, "$gp") == 0) || (stack_b && strcmp(base_a, "$gp") == 0)) return 0;
+    return 1;
+}
+
+static void register_masks(const MipsInstr* instr, uint64_t* reads, uint64_t* writes) {
+    *reads = *writes = 0;
+    for (int r = 0; r < SCHED_NUM_REGS; r++) {
+        if (mips_reads_reg(instr, sched_regs[r])) *reads |= (uint64_t)1 << r;
+        if (mips_writes_reg(instr, sched_regs[r])) *writes |= (uint64_t)1 << r;
+    }
+    *writes &= ~(uint64_t)1;        // Escrever em $zero não cria dependência
+}
+
+/*
+    * Função: edge_latency
+    * -------------------------------
+    * Latência da dependência de 'a' para 'b' (a vem antes no código original):
+    * a latência de 'a' se 'b' lê o seu resultado, 1 se só a ordem importa
+    * (antidependência, saída ou memória) e 0 se as duas são independentes.
+*/
+static int edge_latency(const SchedNode* a, const SchedNode* b) {
+    if (a->writes & b->reads) return a->latency;
+    if ((a->reads & b->writes) || (a->writes & b->writes)) return 1;
+    if ((a->is_store && (b->is_load || b->is_store)) || (a->is_load && b->is_store)) {
+        if (may_alias(a->instr, b->instr)) return 1;
+    }
+    return 0;
+}
+
+// Ciclos que a sequência leva com emissão em ordem: cada instrução espera os seus operandos
+static int sequence_stalls(SchedNode* nodes, int* order, int n) {
+    int* issue = (int*)malloc(sizeof(int) * n);
+    int cycle = -1, stalls = 0;
+
+    for (int k = 0; k < n; k++) {
+        int i = order[k];
+        int ready = cycle + 1;
+        for (int m = 0; m < k; m++) {
+            int p = order[m];
+            int lat = p < i ? edge_latency(&nodes[p], &nodes[i]) : edge_latency(&nodes[i], &nodes[p]);
+            if (lat > 0 && issue[m] + lat > ready) ready = issue[m] + lat;
+        }
+        stalls += ready - (cycle + 1);
+        issue[k] = cycle = ready;
+    }
+    free(issue);
+    return stalls;
+}
+
+
+// --- Escalonamento por lista ---
+
+/*
+    * Função: schedule_region
+    * -------------------------------
+    * Escalonamento por lista de uma sequência de instruções sem rótulos nem
+    * desvios: a cada ciclo emite, entre as instruções cujos operandos já
+    * estão prontos, a de maior caminho crítico (empate: ordem original).
+    * Se nenhuma está pronta, o ciclo é de espera. A nova ordem só é aplicada
+    * se tiver menos esperas que a original.
+*/
+static void schedule_region(MipsList* list, SchedNode* nodes, int n) {
+    if (n < 2) return;
+
+    int* lat = (int*)calloc((size_t)n * n, sizeof(int));
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            lat[i * n + j] = edge_latency(&nodes[i], &nodes[j]);
+            if (lat[i * n + j] > 0) nodes[j].npreds++;
+        }
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        nodes[i].priority = nodes[i].latency;
+        for (int j = i + 1; j < n; j++) {
+            if (lat[i * n + j] > 0 && lat[i * n + j] + nodes[j].priority > nodes[i].priority) {
+                nodes[i].priority = lat[i * n + j] + nodes[j].priority;
+            }
+        }
+    }
+
+    int* order = (int*)malloc(sizeof(int) * n);
+    int* original = (int*)malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) original[i] = i;
+
+    int cycle = 0;
+    for (int k = 0; k < n; cycle++) {
+        int best = -1;
+        for (int i = 0; i < n; i++) {
+            if (nodes[i].done || nodes[i].npreds > 0) continue;
+
+            int ready = 0;
+            for (int p = 0; p < i; p++) {
+                if (lat[p * n + i] > 0 && nodes[p].issue + lat[p * n + i] > ready) ready = nodes[p].issue + lat[p * n + i];
+            }
+            if (ready > cycle) continue;
+            if (best < 0 || nodes[i].priority > nodes[best].priority) best = i;
+        }
+        if (best < 0) continue;         // Ciclo de espera
+
+        nodes[best].done = 1;
+        nodes[best].issue = cycle;
+        order[k++] = best;
+        for (int j = best + 1; j < n; j++) {
+            if (lat[best * n + j] > 0) nodes[j].npreds--;
+        }
+    }
+
+    int before = sequence_stalls(nodes, original, n);
+    int after = sequence_stalls(nodes, order, n);
+    stalls_before += before;
+
+    if (after < before) {
+        stalls_after += after;
+
+        // Reencadeia as instruções (com seus comentários) na nova ordem, antes de 'anchor'
+        MipsInstr* anchor = nodes[n - 1].instr->next;
+        for (int k = 0; k < n; k++) {
+            SchedNode* node = &nodes[order[k]];
+            MipsInstr* first = node->comments ? node->comments : node->instr;
+            MipsInstr* last = node->instr;
+
+            // Tira o trecho [first, last] da lista...
+            if (first->prev) first->prev->next = last->next;
+            else list->head = last->next;
+            if (last->next) last->next->prev = first->prev;
+            else list->tail = first->prev;
+
+            // ...e o coloca antes de 'anchor'
+            first->prev = anchor ? anchor->prev : list->tail;
+            last->next = anchor;
+            if (first->prev) first->prev->next = first;
+            else list->head = first;
+            if (anchor) anchor->prev = last;
+            else list->tail = last;
+        }
+    } else {
+        stalls_after += before;
+    }
+
+    free(lat);
+    free(order);
+    free(original);
+}
+
+// Fim de região: rótulos, diretivas, desvios, saltos, chamadas e syscall
+static int ends_region(const MipsInstr* instr) {
+    return instr->kind == MIPS_LABEL || instr->kind == MIPS_DIRECTIVE ||
+           (instr->kind == MIPS_INSTR && mips_is_control(instr));
+}
+
+static void schedule_list(MipsList* list) {
+    SchedNode* nodes = (SchedNode*)malloc(sizeof(SchedNode) * SCHED_MAX_REGION);
+    int n = 0;
+    MipsInstr* comments = NULL;
+
+    MipsInstr* instr = list->head;
+    while (instr != NULL) {
+        MipsInstr* next = instr->next;
+
+        if (instr->kind == MIPS_COMMENT) {
+            if (comments == NULL) comments = instr;
+        } else if (ends_region(instr) || n == SCHED_MAX_REGION) {
+            schedule_region(list, nodes, n);
+            n = 0;
+            comments = NULL;
+            if (!ends_region(instr)) continue;      // Região cheia: a instrução abre a próxima
+        } else {
+            SchedNode* node = &nodes[n++];
+            memset(node, 0, sizeof(SchedNode));
+            node->instr = instr;
+            node->comments = comments;
+            node->is_load = is_load(instr);
+            node->is_store = is_store(instr);
+            node->latency = instruction_latency(instr);
+            register_masks(instr, &node->reads, &node->writes);
+            comments = NULL;
+        }
+        instr = next;
+    }
+    schedule_region(list, nodes, n);
+    free(nodes);
+}
+
+
+// --- Delay slots ---
+
+// Imediato que cabe nos 16 bits da instrução (pseudo-instruções expandiriam em duas)
+static int fits_immediate(const char* arg, int is_unsigned) {
+    long value = strtol(arg, NULL, 0);
+    return is_unsigned ? (value >= 0 && value <= 65535) : (value >= -32768 && value <= 32767);
+}
+
+/*
+    * Função: is_single_machine_instr
+    * -------------------------------
+    * Só instruções que o montador não expande podem ir para um delay slot: a
+    * segunda metade de uma pseudo-instrução ficaria fora dele.
+*/
+static int is_single_machine_instr(const MipsInstr* instr) {
+    static const char* reg_ops[] = {
+        "move", "add", "addu", "sub", "subu", "and", "or", "xor", "nor",
+        "slt", "sltu", "mflo", "mfhi", "mult", "multu", "sll", "srl", "sra",
+    };
+    static const char* signed_ops[] = { "addi", "addiu", "slti", "sltiu", "li" };
+    static const char* unsigned_ops[] = { "andi", "ori", "xori" };
+
+    if (instr->kind != MIPS_INSTR || mips_is_control(instr)) return 0;
+
+    for (size_t i = 0; i < sizeof(reg_ops) / sizeof(reg_ops[0]); i++) {
+        if (strcmp(instr->op, reg_ops[i]) == 0) {
+            // add/sub com imediato no lugar do registrador são pseudo-instruções
+            return instr->nargs < 3 || instr->args[2][0] == '$' || strcmp(instr->op, "sll") == 0 ||
+                   strcmp(instr->op, "srl") == 0 || strcmp(instr->op, "sra") == 0;
+        }
+    }
+    for (size_t i = 0; i < sizeof(signed_ops) / sizeof(signed_ops[0]); i++) {
+        if (strcmp(instr->op, signed_ops[i]) == 0) return fits_immediate(instr->args[instr->nargs - 1], 0);
+    }
+    for (size_t i = 0; i < sizeof(unsigned_ops) / sizeof(unsigned_ops[0]); i++) {
+        if (strcmp(instr->op, unsigned_ops[i]) == 0) return fits_immediate(instr->args[2], 1);
+    }
+    if (is_load(instr) || is_store(instr)) {
+        int offset;
+        char base[16];
+        return split_address(instr->args[1], &offset, base, sizeof(base)) && offset >= -32768 && offset <= 32767;
+    }
+    return 0;
+}
+
+/*
+    * Função: can_fill_slot
+    * -------------------------------
+    * 'candidate' (logo antes de 'control') pode ser executada no delay slot
+    * depois dele? O desvio não pode ler o que ela escreve, e ela não pode
+    * tocar em $ra quando o salto é uma chamada.
+*/
+static int can_fill_slot(const MipsInstr* candidate, const MipsInstr* control) {
+    if (!is_single_machine_instr(candidate)) return 0;
+
+    // Não pode já estar no delay slot de outro desvio
+    MipsInstr* before = mips_prev_code((MipsInstr*)candidate);
+    if (before != NULL && before->kind == MIPS_INSTR && mips_is_control(before) && strcmp(before->op, "syscall") != 0) {
+        return 0;
+    }
+
+    if (strcmp(control->op, "jal") == 0) {
+        // O chamado só começa depois do delay slot: ele vê os argumentos escritos ali
+        return !mips_reads_reg(candidate, "$ra") && !mips_writes_reg(candidate, "$ra");
+    }
+    if (strcmp(control->op, "j") == 0) return 1;
+
+    for (int r = 0; r < SCHED_NUM_REGS; r++) {
+        if (mips_writes_reg(candidate, sched_regs[r]) && mips_reads_reg(control, sched_regs[r])) return 0;
+        if (mips_writes_reg(control, sched_regs[r]) &&
+            (mips_reads_reg(candidate, sched_regs[r]) || mips_writes_reg(candidate, sched_regs[r]))) {
+            return 0;
+        }
+    }
+    // Desvios que o montador expande usam $at
+    return !mips_reads_reg(candidate, "$at") && !mips_writes_reg(candidate, "$at");
+}
+
+/*
+    * Função: fill_delay_slots
+    * -------------------------------
+    * Para processadores com delay slot (--delay-slots): a instrução depois de
+    * cada desvio ou salto sempre executa. Move para lá a instrução anterior
+    * do bloco quando ela não interfere no desvio; caso contrário, usa nop.
+*/
+static void fill_delay_slots(MipsList* list) {
+    for (MipsInstr* instr = list->head; instr != NULL; instr = instr->next) {
+        if (instr->kind != MIPS_INSTR || !mips_is_control(instr) || strcmp(instr->op, "syscall") == 0) continue;
+
+        MipsInstr* candidate = mips_prev_code(instr);
+        if (candidate != NULL && candidate->kind == MIPS_INSTR && can_fill_slot(candidate, instr)) {
+            // Tira a candidata de antes do desvio e a coloca logo depois
+            if (candidate->prev) candidate->prev->next = candidate->next;
+            else list->head = candidate->next;
+            candidate->next->prev = candidate->prev;
+
+            candidate->prev = instr;
+            candidate->next = instr->next;
+            if (instr->next) instr->next->prev = candidate;
+            else list->tail = candidate;
+            instr->next = candidate;
+            slots_filled++;
+        } else {
+            mips_list_insert_before(list, instr->next, "nop", NULL, NULL, NULL);
+            slots_nop++;
+        }
+        instr = instr->next;        // Pula o delay slot
+    }
+}
+
+/*
+    * Função: mips_schedule
+    * -------------------------------
+    * Roda o escalonador (se habilitado) e o preenchimento de delay slots (se
+    * --delay-slots) sobre a lista e imprime o resultado.
+*/
+void mips_schedule(MipsList* list) {
+    stalls_before = stalls_after = slots_filled = slots_nop = 0;
+
+    if (schedule_enabled) {
+        schedule_list(list);
+        fprintf(COMPILE_OUT, "Escalonador: %d -> %d ciclos de espera estimados (modelo:", stalls_before, stalls_after);
+        for (int i = 0; i < num_latencies; i++) {
+            fprintf(COMPILE_OUT, " %s=%d", latency_model[i].op, latency_model[i].latency);
+        }
+        fprintf(COMPILE_OUT, ")\n");
+    }
+    if (delay_slots_enabled) {
+        fill_delay_slots(list);
+        fprintf(COMPILE_OUT, "Delay slots: %d preenchidos, %d com nop\n", slots_filled, slots_nop);
+    }
+}
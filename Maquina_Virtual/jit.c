@@ -0,0 +1,525 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <setjmp.h>
+#include <sys/mman.h>
+#include "jit.h"
+#include "vm.h"
+
+// Gera código x86-64 direto em memória, com o mesmo modelo de ir_x86.c: cada
+// variável e registrador virtual tem 8 bytes no frame (%rbp), inteiros de 32
+// bits e argumentos pela convenção System V. Chamadas passam pela tabela de
+// funções: enquanto uma função não foi compilada, a entrada dela aponta para
+// um stub que chama o compilador e depois salta para o código gerado.
+
+#define JIT_CODE_SIZE (64 << 20)        // Memória reservada para código
+#define NUM_ARG_REGS 6
+
+// Registradores x86-64 (número usado na codificação)
+enum { RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4, RBP = 5, RSI = 6, RDI = 7, R8 = 8, R9 = 9 };
+static const int arg_regs[NUM_ARG_REGS] = { RDI, RSI, RDX, RCX, R8, R9 };
+
+// Códigos de condição (jcc = 0F 80+cc, setcc = 0F 90+cc)
+enum { CC_E = 0x4, CC_NE = 0x5, CC_L = 0xC, CC_GE = 0xD, CC_LE = 0xE, CC_G = 0xF };
+
+// Memória de código
+static uint8_t* code_base = NULL;
+static size_t code_used = 0;
+
+// Programa em execução
+static IrFunction** functions = NULL;
+static void** function_table = NULL;      // Código de cada função (ou o stub dela)
+static int nfunctions = 0;
+static int32_t* globals = NULL;
+static char** strings = NULL;
+static int nstrings = 0;
+static int compiled_functions = 0;
+static double compile_seconds = 0;
+static jmp_buf runtime_error_jump;          // Erro de execução: volta para jit_run
+
+// Função sendo compilada
+static IrFunction* cur_func = NULL;
+static char* vreg_fused = NULL;
+static size_t* block_offset = NULL;       // Posição de cada bloco no código
+typedef struct { size_t at; int block; } JitPatch;
+static JitPatch* patches = NULL;          // Desvios cujo destino ainda não foi gerado
+static int npatches = 0;
+
+
+// --- Runtime chamado pelo código gerado ---
+
+static void jit_write_int(int32_t value) { printf("%d", value); }
+static void jit_write_char(int32_t value) { putchar((char)value); }
+static void jit_write_str(const char* text) { fputs(text, stdout); }
+static void jit_newline(void) { putchar('\n'); }
+static int32_t jit_read_int(void) {
+    int value = 0;
+    fflush(stdout);
+    if (scanf("%d", &value) != 1) value = 0;
+    return value;
+}
+
+// Divisão por zero: mesma mensagem da máquina virtual; o longjmp descarta os frames do código gerado
+static void jit_division_by_zero(void) {
+    fflush(stdout);
+    fprintf(stderr, "Erro de execucao: divisao por zero.\n");
+    longjmp(runtime_error_jump, 1);
+}
+
+
+// --- Codificação ---
+
+static void byte(uint8_t value) {
+    code_base[code_used++] = value;
+}
+
+static void u32(uint32_t value) {
+    memcpy(code_base + code_used, &value, 4);
+    code_used += 4;
+}
+
+static void u64(uint64_t value) {
+    memcpy(code_base + code_used, &value, 8);
+    code_used += 8;
+}
+
+// Instrução com operando de memória [rbp + disp32]: opcode, registrador e deslocamento
+static void op_rbp(const uint8_t* opcode, int length, int reg, int32_t disp) {
+    if (reg >= 8) byte(0x44);                       // REX.R para r8d/r9d
+    for (int i = 0; i < length; i++) byte(opcode[i]);
+    byte(0x80 | ((reg & 7) << 3) | RBP);            // mod=10 (disp32), rm=rbp
+    u32((uint32_t)disp);
+}
+
+static void load32(int reg, int32_t disp) { static const uint8_t op[] = { 0x8B }; op_rbp(op, 1, reg, disp); }
+static void store32(int reg, int32_t disp) { static const uint8_t op[] = { 0x89 }; op_rbp(op, 1, reg, disp); }
+
+static void mov_imm64(int reg, uint64_t value) {
+    byte(0x48 | (reg >= 8));
+    byte(0xB8 + (reg & 7));
+    u64(value);
+}
+
+// call para um endereço absoluto (via rax)
+static void call_absolute(const void* target) {
+    mov_imm64(RAX, (uint64_t)(uintptr_t)target);
+    byte(0xFF); byte(0xD0);                         // call rax
+}
+
+// Desvio curto (jcc rel8 ou jmp rel8) para a frente: devolve a posição do deslocamento
+static size_t short_jump(int cc) {
+    if (cc < 0) byte(0xEB);
+    else byte(0x70 + cc);
+    byte(0);
+    return code_used - 1;
+}
+
+static void patch_short_jump(size_t at) {
+    code_base[at] = (uint8_t)(code_used - (at + 1));
+}
+
+static int32_t vreg_disp(int reg) {
+    return -8 * (cur_func->nvars + reg + 1);
+}
+
+static int32_t var_disp(IrVar* var) {
+    if (var->kind == IR_VAR_PARAM && var->index >= NUM_ARG_REGS) return 16 + 8 * (var->index - NUM_ARG_REGS);
+    return -8 * (var->index + 1);
+}
+
+// Salto com destino em um bloco: jmp rel32 ou jcc rel32, corrigido no fim da função
+static void jump_to(int cc, IrBlock* target) {
+    if (cc < 0) {
+        byte(0xE9);
+    } else {
+        byte(0x0F); byte(0x80 + cc);
+    }
+    patches = (JitPatch*)realloc(patches, sizeof(JitPatch) * (npatches + 1));
+    patches[npatches].at = code_used;
+    patches[npatches].block = target->id;
+    npatches++;
+    u32(0);
+}
+
+
+// --- Tradução da IR ---
+
+static int is_compare(IrOperator oper) {
+    return oper >= IR_EQ && oper <= IR_GE;
+}
+
+static int condition_code(IrOperator oper, int negated) {
+    static const int codes[] = { CC_E, CC_NE, CC_L, CC_G, CC_LE, CC_GE };
+    static const int negations[] = { CC_NE, CC_E, CC_GE, CC_LE, CC_G, CC_L };
+    return negated ? negations[oper - IR_EQ] : codes[oper - IR_EQ];
+}
+
+// Comparação lida só pelo desvio seguinte: vira cmp + jcc (como em ir_x86.c)
+static void mark_fused_compares(IrFunction* func) {
+    int* uses = (int*)calloc(func->nregs + 1, sizeof(int));
+    vreg_fused = (char*)calloc(func->nregs + 1, sizeof(char));
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->src1 >= 0) uses[instr->src1]++;
+            if (instr->src2 >= 0) uses[instr->src2]++;
+            for (int i = 0; i < instr->nargs; i++) uses[instr->args[i]]++;
+        }
+    }
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr* branch = block->last;
+        if (branch == NULL || branch->op != IR_BRANCH) continue;
+        IrInstr* cmp = branch->prev;
+        if (cmp != NULL && cmp->op == IR_BINOP && is_compare(cmp->oper) &&
+            cmp->dst == branch->src1 && uses[cmp->dst] == 1) {
+            vreg_fused[cmp->dst] = 1;
+        }
+    }
+    free(uses);
+}
+
+static IrBlock* next_emitted(IrBlock* block) {
+    IrBlock* next = block->next;
+    while (next != NULL && next->rpo_index < 0) next = next->next;
+    return next;
+}
+
+static int function_index(const char* name) {
+    for (int i = 0; i < nfunctions; i++) {
+        if (strcmp(functions[i]->name, name) == 0) return i;
+    }
+    fprintf(stderr, "Erro interno: funcao '%s' nao encontrada no JIT.\n", name);
+    exit(EXIT_FAILURE);
+}
+
+static int string_index(const char* literal) {
+    char* text = vm_decode_string(literal);
+    for (int i = 0; i < nstrings; i++) {
+        if (strcmp(strings[i], text) == 0) {
+            free(text);
+            return i;
+        }
+    }
+    strings = (char**)realloc(strings, sizeof(char*) * (nstrings + 1));
+    strings[nstrings] = text;
+    return nstrings++;
+}
+
+static void compile_binop(IrInstr* instr) {
+    int32_t b = vreg_disp(instr->src2);
+    load32(RAX, vreg_disp(instr->src1));
+
+    switch (instr->oper) {
+        case IR_ADD: { static const uint8_t op[] = { 0x03 }; op_rbp(op, 1, RAX, b); break; }
+        case IR_SUB: { static const uint8_t op[] = { 0x2B }; op_rbp(op, 1, RAX, b); break; }
+        case IR_MUL: { static const uint8_t op[] = { 0x0F, 0xAF }; op_rbp(op, 2, RAX, b); break; }
+        case IR_DIV: {
+            // Como op_div da máquina virtual: divisor zero é erro de execução e
+            // dividir por -1 é negar (idiv de INT_MIN por -1 geraria #DE)
+            load32(RCX, b);
+            byte(0x85); byte(0xC9);                     // test ecx, ecx
+            size_t nonzero = short_jump(CC_NE);
+            call_absolute((const void*)jit_division_by_zero);
+            patch_short_jump(nonzero);
+            byte(0x83); byte(0xF9); byte(0xFF);         // cmp ecx, -1
+            size_t divide = short_jump(CC_NE);
+            byte(0xF7); byte(0xD8);                     // neg eax
+            size_t done = short_jump(-1);
+            patch_short_jump(divide);
+            byte(0x99);                                 // cdq
+            byte(0xF7); byte(0xF9);                     // idiv ecx
+            patch_short_jump(done);
+            break;
+        }
+        default: {
+            static const uint8_t op[] = { 0x3B };
+            op_rbp(op, 1, RAX, b);                      // cmp eax, [rbp+b]
+            byte(0x0F); byte(0x90 + condition_code(instr->oper, 0)); byte(0xC0);   // setcc al
+            byte(0x0F); byte(0xB6); byte(0xC0);         // movzx eax, al
+            break;
+        }
+    }
+    store32(RAX, vreg_disp(instr->dst));
+}
+
+static void compile_call(IrInstr* instr) {
+    static const uint8_t push[] = { 0xFF };
+    int stack_args = instr->nargs > NUM_ARG_REGS ? instr->nargs - NUM_ARG_REGS : 0;
+    int padding = stack_args % 2;
+
+    if (padding) { byte(0x48); byte(0x83); byte(0xEC); byte(0x08); }      // sub rsp, 8
+    for (int i = instr->nargs - 1; i >= NUM_ARG_REGS; i--) {
+        op_rbp(push, 1, 6, vreg_disp(instr->args[i]));                      // push qword [rbp+d]
+    }
+    for (int i = 0; i < instr->nargs && i < NUM_ARG_REGS; i++) {
+        load32(arg_regs[i], vreg_disp(instr->args[i]));
+    }
+
+    // call [tabela + i]: a entrada aponta para o stub até a função ser compilada
+    mov_imm64(RAX, (uint64_t)(uintptr_t)&function_table[function_index(instr->name)]);
+    byte(0xFF); byte(0x10);
+
+    if (stack_args > 0) {
+        byte(0x48); byte(0x81); byte(0xC4); u32(8 * (stack_args + padding));   // add rsp, n
+    }
+    if (instr->dst >= 0) store32(RAX, vreg_disp(instr->dst));
+}
+
+static void compile_instr(IrBlock* block, IrInstr* instr) {
+    switch (instr->op) {
+        case IR_CONST:
+            byte(0xC7); byte(0x85); u32((uint32_t)vreg_disp(instr->dst)); u32((uint32_t)instr->imm);
+            break;
+
+        case IR_COPY:
+            load32(RAX, vreg_disp(instr->src1));
+            store32(RAX, vreg_disp(instr->dst));
+            break;
+
+        case IR_BINOP:
+            if (vreg_fused[instr->dst]) break;      // Gerada junto com o desvio
+            compile_binop(instr);
+            break;
+
+        case IR_UNOP:
+            load32(RAX, vreg_disp(instr->src1));
+            if (instr->oper == IR_NEG) {
+                byte(0xF7); byte(0xD8);                                     // neg eax
+            } else {
+                byte(0x85); byte(0xC0);                                     // test eax, eax
+                byte(0x0F); byte(0x94); byte(0xC0);                         // sete al
+                byte(0x0F); byte(0xB6); byte(0xC0);                         // movzx eax, al
+            }
+            store32(RAX, vreg_disp(instr->dst));
+            break;
+
+        case IR_LOAD:
+            if (instr->var->kind == IR_VAR_GLOBAL) {
+                mov_imm64(RCX, (uint64_t)(uintptr_t)&globals[instr->var->index]);
+                byte(0x8B); byte(0x01);                                     // mov eax, [rcx]
+            } else {
+                load32(RAX, var_disp(instr->var));
+            }
+            store32(RAX, vreg_disp(instr->dst));
+            break;
+
+        case IR_STORE:
+            load32(RAX, vreg_disp(instr->src1));
+            if (instr->var->kind == IR_VAR_GLOBAL) {
+                mov_imm64(RCX, (uint64_t)(uintptr_t)&globals[instr->var->index]);
+                byte(0x89); byte(0x01);                                     // mov [rcx], eax
+            } else {
+                store32(RAX, var_disp(instr->var));
+            }
+            break;
+
+        case IR_CALL:
+            compile_call(instr);
+            break;
+
+        case IR_READ:
+            call_absolute((const void*)jit_read_int);
+            store32(RAX, vreg_disp(instr->dst));
+            break;
+
+        case IR_WRITE_INT:
+        case IR_WRITE_CHAR:
+            load32(RDI, vreg_disp(instr->src1));
+            call_absolute(instr->op == IR_WRITE_INT ? (const void*)jit_write_int : (const void*)jit_write_char);
+            break;
+
+        case IR_WRITE_STR: {
+            // Cada cadeia tem sua própria alocação: o endereço não muda quando o vetor cresce
+            int index = string_index(instr->name);
+            mov_imm64(RDI, (uint64_t)(uintptr_t)strings[index]);
+            call_absolute((const void*)jit_write_str);
+            break;
+        }
+
+        case IR_NEWLINE:
+            call_absolute((const void*)jit_newline);
+            break;
+
+        case IR_JUMP:
+            if (next_emitted(block) != instr->target1) jump_to(-1, instr->target1);
+            break;
+
+        case IR_BRANCH: {
+            IrBlock* next = next_emitted(block);
+            IrInstr* cmp = instr->prev;
+            int fused = cmp != NULL && cmp->op == IR_BINOP && vreg_fused[cmp->dst];
+            IrOperator oper = IR_NE;
+
+            if (fused) {
+                static const uint8_t op[] = { 0x3B };
+                load32(RAX, vreg_disp(cmp->src1));
+                op_rbp(op, 1, RAX, vreg_disp(cmp->src2));                   // cmp eax, [rbp+d]
+                oper = cmp->oper;
+            } else {
+                static const uint8_t op[] = { 0x83 };
+                op_rbp(op, 1, 7, vreg_disp(instr->src1));                   // cmp dword [rbp+d], 0
+                byte(0x00);
+            }
+
+            if (next == instr->target1) {
+                jump_to(condition_code(oper, 1), instr->target2);
+            } else {
+                jump_to(condition_code(oper, 0), instr->target1);
+                if (next != instr->target2) jump_to(-1, instr->target2);
+            }
+            break;
+        }
+
+        case IR_RET:
+            if (instr->src1 >= 0) load32(RAX, vreg_disp(instr->src1));
+            byte(0xC9);                                                     // leave
+            byte(0xC3);                                                     // ret
+            break;
+    }
+}
+
+/*
+    * Função: jit_compile_function
+    * -------------------------------
+    * Chamada pelo stub na primeira chamada da função 'index': gera o código,
+    * troca a entrada da tabela e devolve o endereço para o stub saltar.
+*/
+static void* jit_compile_function(int index) {
+    clock_t start = clock();
+    IrFunction* func = functions[index];
+    cur_func = func;
+
+    mprotect(code_base, JIT_CODE_SIZE, PROT_READ | PROT_WRITE);
+
+    // Cada função cabe folgadamente em 64 bytes por instrução da IR
+    size_t estimate = 256;
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            estimate += 64 + 24 * instr->nargs;
+        }
+    }
+    if (code_used + estimate > JIT_CODE_SIZE) {
+        fprintf(stderr, "Erro de execucao: memoria de codigo do JIT esgotada.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ir_compute_dominators(func);
+    mark_fused_compares(func);
+    block_offset = (size_t*)calloc(func->nblocks + 1, sizeof(size_t));
+    npatches = 0;
+
+    code_used = (code_used + 15) & ~(size_t)15;
+    void* entry = code_base + code_used;
+
+    // Prólogo: frame alinhado em 16 bytes, parâmetros em registradores para o frame, locais zeradas
+    int frame_size = (8 * (func->nvars + func->nregs) + 15) & ~15;
+    byte(0x55);                                                             // push rbp
+    byte(0x48); byte(0x89); byte(0xE5);                                     // mov rbp, rsp
+    if (frame_size > 0) { byte(0x48); byte(0x81); byte(0xEC); u32(frame_size); }   // sub rsp, n
+    for (int i = 0; i < func->nparams && i < NUM_ARG_REGS; i++) {
+        store32(arg_regs[i], -8 * (i + 1));
+    }
+    for (int i = func->nparams; i < func->nvars; i++) {
+        byte(0xC7); byte(0x85); u32((uint32_t)(-8 * (i + 1))); u32(0);
+    }
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->rpo_index < 0) continue;     // Bloco inalcançável
+        block_offset[block->id] = code_used;
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            compile_instr(block, instr);
+        }
+    }
+
+    for (int i = 0; i < npatches; i++) {
+        int32_t rel = (int32_t)(block_offset[patches[i].block] - (patches[i].at + 4));
+        memcpy(code_base + patches[i].at, &rel, 4);
+    }
+
+    mprotect(code_base, JIT_CODE_SIZE, PROT_READ | PROT_EXEC);
+
+    free(block_offset);
+    free(vreg_fused);
+    block_offset = NULL;
+    vreg_fused = NULL;
+    cur_func = NULL;
+
+    function_table[index] = entry;
+    compiled_functions++;
+    compile_seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+    return entry;
+}
+
+/*
+    * Função: emit_stub
+    * -------------------------------
+    * Stub de compilação sob demanda: guarda os registradores de argumento,
+    * chama jit_compile_function(index) e salta para o código gerado. Os
+    * argumentos passados na pilha continuam no lugar, pois o stub sai com jmp.
+*/
+static void* emit_stub(int index) {
+    void* stub = code_base + code_used;
+    byte(0x57); byte(0x56); byte(0x52); byte(0x51);                         // push rdi, rsi, rdx, rcx
+    byte(0x41); byte(0x50); byte(0x41); byte(0x51);                         // push r8, r9
+    byte(0x48); byte(0x83); byte(0xEC); byte(0x08);                         // sub rsp, 8 (alinhamento)
+    byte(0xBF); u32((uint32_t)index);                                       // mov edi, index
+    call_absolute((const void*)jit_compile_function);
+    byte(0x48); byte(0x83); byte(0xC4); byte(0x08);                         // add rsp, 8
+    byte(0x41); byte(0x59); byte(0x41); byte(0x58);                         // pop r9, r8
+    byte(0x59); byte(0x5A); byte(0x5E); byte(0x5F);                         // pop rcx, rdx, rsi, rdi
+    byte(0xFF); byte(0xE0);                                                 // jmp rax
+    return stub;
+}
+
+int jit_run(IrProgram* prog) {
+    code_base = (uint8_t*)mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code_base == MAP_FAILED) {
+        perror("Erro ao reservar memoria executavel para o JIT");
+        code_base = NULL;
+        return 1;
+    }
+    code_used = 0;
+
+    nfunctions = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) nfunctions++;
+    functions = (IrFunction**)malloc(sizeof(IrFunction*) * nfunctions);
+    function_table = (void**)malloc(sizeof(void*) * nfunctions);
+    globals = (int32_t*)calloc(prog->nglobals + 1, sizeof(int32_t));
+
+    int main_index = 0;
+    int index = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next, index++) {
+        functions[index] = func;
+        function_table[index] = emit_stub(index);
+        if (func->is_main) main_index = index;
+    }
+    mprotect(code_base, JIT_CODE_SIZE, PROT_READ | PROT_EXEC);
+
+    clock_t start = clock();
+    int status = 0;
+    if (setjmp(runtime_error_jump) == 0) {
+        ((void (*)(void))function_table[main_index])();
+    } else {
+        status = 1;
+    }
+    fflush(stdout);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    fprintf(stderr, "JIT: %d de %d funcoes compiladas (%zu bytes) em %.3f ms; execucao total %.3f ms\n",
+            compiled_functions, nfunctions, code_used, compile_seconds * 1000, seconds * 1000);
+
+    munmap(code_base, JIT_CODE_SIZE);
+    for (int i = 0; i < nstrings; i++) free(strings[i]);
+    free(strings);
+    free(functions);
+    free(function_table);
+    free(globals);
+    free(patches);
+    code_base = NULL;
+    strings = NULL;
+    nstrings = 0;
+    patches = NULL;
+    return status;
+}
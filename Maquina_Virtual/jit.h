@@ -0,0 +1,19 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include "./../Codigo_Intermediario/ir.h"
+
+// Compilador JIT para x86-64 (--jit): cada função da IR vira código de
+// máquina em memória executável (mmap) na primeira vez que é chamada, e o
+// programa roda no próprio processo do compilador.
+
+/**
+ * Executa o programa a partir do bloco principal. A IR precisa continuar
+ * válida durante a execução (as funções são compiladas sob demanda).
+ * Imprime em stderr quantas funções foram compiladas e o tempo gasto.
+ * @return 0 em caso de sucesso, 1 se a memória executável não pôde ser reservada
+ *         ou houve erro de execução (divisão por zero).
+ */
+int jit_run(IrProgram* prog);
+
+#endif // JIT_H
@@ -0,0 +1,771 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+#include "mips_emu.h"
+#include "vm.h"
+#include "./../Gera_Codigo/mips.h"
+#include "./../Gera_Codigo/line_profile.h"
+
+// Mapa de memória do SPIM: código em 0x00400000, dados em 0x10010000 e pilha
+// crescendo para baixo a partir de 0x7fffeffc.
+#define EMU_TEXT_BASE   0x00400000u
+#define EMU_DATA_BASE   0x10010000u
+#define EMU_GP          0x10008000u
+#define EMU_SP          0x7fffeffcu
+#define EMU_STACK_TOP   0x7ffff000u
+#define EMU_STACK_SIZE  (64u << 20)     // Reservada com calloc: só as páginas usadas ocupam memória
+
+#define EMU_NUM_REGS 33                 // 32 registradores + hi/lo (acompanhados juntos)
+#define EMU_HILO     32
+#define EMU_BRANCH_PENALTY 1            // Bolha de um desvio tomado sem delay slot
+
+// Operações do cache pré-decodificado (pseudo-instruções já expandidas)
+typedef enum {
+    EMU_LI, EMU_MOVE, EMU_LW, EMU_SW, EMU_LA,
+    EMU_ADD, EMU_SUB, EMU_MUL, EMU_AND, EMU_OR, EMU_XOR, EMU_NOR,
+    EMU_SLT, EMU_SLTU, EMU_SEQ, EMU_SNE, EMU_SLL, EMU_SRL, EMU_SRA,
+    EMU_NEG, EMU_NOT, EMU_MULT, EMU_MULTU, EMU_DIV, EMU_DIVU, EMU_MFLO, EMU_MFHI,
+    EMU_BEQ, EMU_BNE, EMU_BLT, EMU_BGE, EMU_BGT, EMU_BLE,
+    EMU_J, EMU_JAL, EMU_JR, EMU_SYSCALL, EMU_NOP,
+} EmuOpcode;
+
+// Formato dos operandos no assembly
+typedef enum {
+    FMT_RRX,        // rd, rs, rt|imediato
+    FMT_RI,         // rd, imediato
+    FMT_RR,         // rd, rs
+    FMT_MEM,        // rt, endereço (deslocamento($base), rótulo ou rótulo+n)
+    FMT_HILO,       // rs, rt (mult/div) ou rd, rs, rt (div com três operandos)
+    FMT_R,          // um registrador (mflo, mfhi, jr)
+    FMT_BRANCH,     // rs, rt|imediato, rótulo
+    FMT_BRANCH_Z,   // rs, rótulo (compara com $zero)
+    FMT_JUMP,       // rótulo
+    FMT_NONE,
+} EmuFormat;
+
+typedef struct {
+    const char* name;
+    EmuOpcode op;
+    EmuFormat format;
+} EmuOpInfo;
+
+static const EmuOpInfo op_table[] = {
+    { "li", EMU_LI, FMT_RI }, { "lui", EMU_LI, FMT_RI }, { "move", EMU_MOVE, FMT_RR },
+    { "lw", EMU_LW, FMT_MEM }, { "sw", EMU_SW, FMT_MEM }, { "la", EMU_LA, FMT_MEM },
+    { "add", EMU_ADD, FMT_RRX }, { "addu", EMU_ADD, FMT_RRX }, { "addi", EMU_ADD, FMT_RRX }, { "addiu", EMU_ADD, FMT_RRX },
+    { "sub", EMU_SUB, FMT_RRX }, { "subu", EMU_SUB, FMT_RRX }, { "mul", EMU_MUL, FMT_RRX },
+    { "and", EMU_AND, FMT_RRX }, { "andi", EMU_AND, FMT_RRX }, { "or", EMU_OR, FMT_RRX }, { "ori", EMU_OR, FMT_RRX },
+    { "xor", EMU_XOR, FMT_RRX }, { "xori", EMU_XOR, FMT_RRX }, { "nor", EMU_NOR, FMT_RRX },
+    { "slt", EMU_SLT, FMT_RRX }, { "slti", EMU_SLT, FMT_RRX }, { "sltu", EMU_SLTU, FMT_RRX }, { "sltiu", EMU_SLTU, FMT_RRX },
+    { "seq", EMU_SEQ, FMT_RRX }, { "sne", EMU_SNE, FMT_RRX },
+    { "sll", EMU_SLL, FMT_RRX }, { "srl", EMU_SRL, FMT_RRX }, { "sra", EMU_SRA, FMT_RRX },
+    { "neg", EMU_NEG, FMT_RR }, { "not", EMU_NOT, FMT_RR },
+    { "mult", EMU_MULT, FMT_HILO }, { "multu", EMU_MULTU, FMT_HILO }, { "div", EMU_DIV, FMT_HILO }, { "divu", EMU_DIVU, FMT_HILO },
+    { "mflo", EMU_MFLO, FMT_R }, { "mfhi", EMU_MFHI, FMT_R },
+    { "beq", EMU_BEQ, FMT_BRANCH }, { "bne", EMU_BNE, FMT_BRANCH }, { "blt", EMU_BLT, FMT_BRANCH },
+    { "bge", EMU_BGE, FMT_BRANCH }, { "bgt", EMU_BGT, FMT_BRANCH }, { "ble", EMU_BLE, FMT_BRANCH },
+    { "beqz", EMU_BEQ, FMT_BRANCH_Z }, { "bnez", EMU_BNE, FMT_BRANCH_Z }, { "bltz", EMU_BLT, FMT_BRANCH_Z },
+    { "bgez", EMU_BGE, FMT_BRANCH_Z }, { "bgtz", EMU_BGT, FMT_BRANCH_Z }, { "blez", EMU_BLE, FMT_BRANCH_Z },
+    { "j", EMU_J, FMT_JUMP }, { "b", EMU_J, FMT_JUMP }, { "jal", EMU_JAL, FMT_JUMP }, { "jr", EMU_JR, FMT_R },
+    { "syscall", EMU_SYSCALL, FMT_NONE }, { "nop", EMU_NOP, FMT_NONE },
+};
+#define EMU_NUM_OPS (int)(sizeof(op_table) / sizeof(op_table[0]))
+
+static const char* reg_names[32] = {
+    "zero", "at", "v0", "v1", "a0", "a1", "a2", "a3",
+    "t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7",
+    "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7",
+    "t8", "t9", "k0", "k1", "gp", "sp", "fp", "ra",
+};
+
+// Instrução pré-decodificada: registradores como índices, rótulos como posições no cache
+typedef struct {
+    EmuOpcode op;
+    int rd, rs, rt;         // rt < 0: o segundo operando é 'imm'
+    int32_t imm;
+    int target;             // Destino de desvios e saltos
+    int use1, use2, def;    // Registradores lidos/escritos (modelo de ciclos), -1 se nenhum
+    int latency;
+    int line;               // Linha no arquivo .asm (mensagens de erro e tabela de linhas)
+    long long executed;     // Vezes executada e ciclos gastos (perfil por linha)
+    long long cycles;
+} EmuInstr;
+
+// Linha de código ainda como texto (primeira passada)
+typedef struct {
+    char op[16];
+    char args[3][MIPS_ARG_LEN];
+    int nargs;
+    int line;
+} EmuSource;
+
+typedef struct {
+    char* name;
+    uint32_t value;         // Endereço (dados) ou posição no cache (código)
+    int is_text;
+    int defined;
+} EmuLabel;
+
+// Programa montado
+static EmuLabel* labels = NULL;
+static int nlabels = 0;
+static EmuSource* sources = NULL;
+static int nsources = 0;
+static uint8_t* data = NULL;
+static uint32_t data_size = 0;
+static uint8_t* stack = NULL;
+static const char* asm_file = NULL;
+
+
+// --- Montagem ---
+
+static int asm_error(int line, const char* message, const char* detail) {
+    fprintf(stderr, "Erro no emulador (%s, linha %d): %s '%s'\n", asm_file, line, message, detail);
+    return 0;
+}
+
+static EmuLabel* find_label(const char* name) {
+    for (int i = 0; i < nlabels; i++) {
+        if (strcmp(labels[i].name, name) == 0) return &labels[i];
+    }
+    return NULL;
+}
+
+static EmuLabel* add_label(const char* name) {
+    EmuLabel* label = find_label(name);
+    if (label != NULL) return label;
+    labels = (EmuLabel*)realloc(labels, sizeof(EmuLabel) * (nlabels + 1));
+    label = &labels[nlabels++];
+    label->name = strdup(name);
+    label->value = 0;
+    label->is_text = 0;
+    label->defined = 0;
+    return label;
+}
+
+static void data_append(const void* bytes, uint32_t size) {
+    data = (uint8_t*)realloc(data, data_size + size);
+    if (bytes != NULL) {
+        memcpy(data + data_size, bytes, size);
+    } else {
+        memset(data + data_size, 0, size);
+    }
+    data_size += size;
+}
+
+// Rótulos de dados sem diretiva na mesma linha recebem o endereço do próximo item (já alinhado)
+static int pending_data[64];                // Índices em 'labels' (o vetor pode ser realocado)
+static int npending_data = 0;
+
+static void bind_pending(uint32_t align) {
+    while (data_size % align != 0) data_append(NULL, 1);
+    for (int i = 0; i < npending_data; i++) labels[pending_data[i]].value = EMU_DATA_BASE + data_size;
+    npending_data = 0;
+}
+
+// Remove o comentário (fora de aspas) e os espaços das pontas
+static char* clean_line(char* line) {
+    int quoted = 0;
+    for (char* c = line; *c != '\0'; c++) {
+        if (*c == '"' && (c == line || c[-1] != '\\')) quoted = !quoted;
+        if (*c == '#' && !quoted) {
+            *c = '\0';
+            break;
+        }
+    }
+    while (isspace((unsigned char)*line)) line++;
+    size_t length = strlen(line);
+    while (length > 0 && isspace((unsigned char)line[length - 1])) line[--length] = '\0';
+    return line;
+}
+
+// Fim de um rótulo no início da linha ("nome:"), ou NULL se a linha não começa com um
+static char* label_end(char* line) {
+    char* c = line;
+    while (isalnum((unsigned char)*c) || *c == '_' || *c == '.' || *c == '$') c++;
+    return c != line && *c == ':' ? c : NULL;
+}
+
+static int parse_directive(char* line, int in_text, int number) {
+    if (strncmp(line, ".data", 5) == 0 || strncmp(line, ".text", 5) == 0 ||
+        strncmp(line, ".globl", 6) == 0 || strncmp(line, ".align", 6) == 0) {
+        return 1;
+    }
+    if (in_text) return asm_error(number, "diretiva fora da secao .data:", line);
+
+    if (strncmp(line, ".asciiz", 7) == 0) {
+        bind_pending(1);
+        char* text = vm_decode_string(clean_line(line + 7));
+        data_append(text, (uint32_t)strlen(text) + 1);
+        free(text);
+    } else if (strncmp(line, ".word", 5) == 0) {
+        bind_pending(4);
+        for (char* item = strtok(line + 5, ","); item != NULL; item = strtok(NULL, ",")) {
+            int32_t value = (int32_t)strtol(item, NULL, 0);
+            data_append(&value, 4);
+        }
+    } else if (strncmp(line, ".space", 6) == 0) {
+        bind_pending(1);
+        data_append(NULL, (uint32_t)strtoul(line + 6, NULL, 0));
+    } else {
+        return asm_error(number, "diretiva nao suportada:", line);
+    }
+    return 1;
+}
+
+static void parse_instruction(char* line, int number) {
+    sources = (EmuSource*)realloc(sources, sizeof(EmuSource) * (nsources + 1));
+    EmuSource* src = &sources[nsources++];
+    memset(src, 0, sizeof(EmuSource));
+    src->line = number;
+
+    size_t op_length = strcspn(line, " \t");
+    snprintf(src->op, sizeof(src->op), "%.*s", (int)op_length, line);
+    for (char* arg = strtok(line + op_length, ","); arg != NULL && src->nargs < 3; arg = strtok(NULL, ",")) {
+        snprintf(src->args[src->nargs++], MIPS_ARG_LEN, "%s", clean_line(arg));
+    }
+}
+
+/*
+    * Função: read_source
+    * -------------------------------
+    * Primeira passada: monta a seção .data em memória, registra os rótulos e
+    * guarda as instruções como texto (os rótulos podem ser usados antes de
+    * serem definidos).
+*/
+static int read_source(FILE* in) {
+    char* buffer = NULL;
+    size_t capacity = 0;
+    int number = 0;
+    int in_text = 1;
+    int ok = 1;
+
+    while (ok && getline(&buffer, &capacity, in) != -1) {
+        number++;
+        char* line = clean_line(buffer);
+
+        if (strncmp(line, ".data", 5) == 0) in_text = 0;
+        if (strncmp(line, ".text", 5) == 0) in_text = 1;
+
+        // Rótulos no início da linha (podem vir seguidos de diretiva ou instrução)
+        char* colon;
+        while ((colon = label_end(line)) != NULL) {
+            *colon = '\0';
+            EmuLabel* label = add_label(line);
+            if (label->defined) {
+                ok = asm_error(number, "rotulo duplicado", label->name);
+                break;
+            }
+            label->defined = 1;
+            label->is_text = in_text;
+            if (in_text) {
+                label->value = (uint32_t)nsources;
+            } else if (npending_data < (int)(sizeof(pending_data) / sizeof(pending_data[0]))) {
+                pending_data[npending_data++] = (int)(label - labels);
+            }
+            line = clean_line(colon + 1);
+        }
+        if (!ok || *line == '\0') continue;
+
+        if (line[0] == '.') {
+            ok = parse_directive(line, in_text, number);
+        } else if (!in_text) {
+            ok = asm_error(number, "instrucao fora da secao .text:", line);
+        } else {
+            parse_instruction(line, number);
+        }
+    }
+    bind_pending(1);
+    free(buffer);
+    return ok;
+}
+
+static int parse_register(const char* arg, int line, int* reg) {
+    if (arg[0] != '$') return asm_error(line, "registrador esperado:", arg);
+    if (isdigit((unsigned char)arg[1])) {
+        *reg = atoi(arg + 1);
+        if (*reg >= 0 && *reg < 32) return 1;
+    }
+    for (int i = 0; i < 32; i++) {
+        if (strcmp(arg + 1, reg_names[i]) == 0) {
+            *reg = i;
+            return 1;
+        }
+    }
+    return asm_error(line, "registrador invalido:", arg);
+}
+
+static int parse_immediate(const char* arg, int line, int32_t* value) {
+    char* end;
+    if (arg[0] == '\'' && arg[1] != '\0') {
+        *value = arg[1] == '\\' ? (arg[2] == 'n' ? '\n' : arg[2] == 't' ? '\t' : arg[2]) : arg[1];
+        return 1;
+    }
+    *value = (int32_t)strtol(arg, &end, 0);
+    if (end == arg || *end != '\0') return asm_error(line, "imediato invalido:", arg);
+    return 1;
+}
+
+// Segundo operando de operações e desvios: registrador ou imediato
+static int parse_reg_or_imm(const char* arg, int line, EmuInstr* out) {
+    if (arg[0] == '$') return parse_register(arg, line, &out->rt);
+    out->rt = -1;
+    return parse_immediate(arg, line, &out->imm);
+}
+
+// Endereço: deslocamento($base), ($base), rótulo ou rótulo+n
+static int parse_address(const char* arg, int line, EmuInstr* out) {
+    const char* paren = strchr(arg, '(');
+    if (paren != NULL) {
+        char base[MIPS_ARG_LEN];
+        snprintf(base, sizeof(base), "%.*s", (int)strcspn(paren + 1, ")"), paren + 1);
+        out->imm = paren == arg ? 0 : (int32_t)strtol(arg, NULL, 0);
+        return parse_register(base, line, &out->rs);
+    }
+
+    char name[MIPS_ARG_LEN];
+    const char* plus = strchr(arg, '+');
+    snprintf(name, sizeof(name), "%.*s", plus ? (int)(plus - arg) : (int)strlen(arg), arg);
+    EmuLabel* label = find_label(name);
+    if (label == NULL || !label->defined) return asm_error(line, "rotulo indefinido", name);
+
+    out->rs = 0;
+    out->imm = (int32_t)(label->is_text ? EMU_TEXT_BASE + 4 * label->value : label->value);
+    if (plus) out->imm += (int32_t)strtol(plus + 1, NULL, 0);
+    return 1;
+}
+
+static int parse_target(const char* arg, int line, EmuInstr* out) {
+    EmuLabel* label = find_label(arg);
+    if (label == NULL || !label->defined || !label->is_text) return asm_error(line, "rotulo de codigo indefinido", arg);
+    out->target = (int)label->value;
+    return 1;
+}
+
+/*
+    * Função: decode
+    * -------------------------------
+    * Segunda passada: traduz cada instrução para o formato pré-decodificado,
+    * com registradores em índices, imediatos já convertidos, rótulos
+    * resolvidos e a latência do modelo do escalonador.
+*/
+static int decode(const EmuSource* src, EmuInstr* out) {
+    const EmuOpInfo* info = NULL;
+    for (int i = 0; i < EMU_NUM_OPS && info == NULL; i++) {
+        if (strcmp(op_table[i].name, src->op) == 0) info = &op_table[i];
+    }
+    if (info == NULL) return asm_error(src->line, "instrucao nao suportada:", src->op);
+
+    static const int expected_args[] = { 3, 2, 2, 2, 2, 1, 3, 2, 1, 0 };
+    int nargs = expected_args[info->format];
+    if (info->format == FMT_HILO && src->nargs == 3) nargs = 3;
+    if (src->nargs != nargs) return asm_error(src->line, "numero de operandos invalido em", src->op);
+
+    memset(out, 0, sizeof(EmuInstr));
+    out->op = info->op;
+    out->rd = out->rs = out->rt = -1;
+    out->use1 = out->use2 = out->def = -1;
+    out->latency = mips_op_latency(src->op);
+    out->line = src->line;
+    const char (*a)[MIPS_ARG_LEN] = src->args;
+    int line = src->line;
+
+    switch (info->format) {
+        case FMT_RRX:
+            if (!parse_register(a[0], line, &out->rd) || !parse_register(a[1], line, &out->rs) ||
+                !parse_reg_or_imm(a[2], line, out)) return 0;
+            out->use1 = out->rs;
+            out->use2 = out->rt;
+            out->def = out->rd;
+            break;
+        case FMT_RI:
+            if (!parse_register(a[0], line, &out->rd) || !parse_immediate(a[1], line, &out->imm)) return 0;
+            if (strcmp(src->op, "lui") == 0) out->imm = (int32_t)((uint32_t)out->imm << 16);
+            out->def = out->rd;
+            break;
+        case FMT_RR:
+            if (!parse_register(a[0], line, &out->rd) || !parse_register(a[1], line, &out->rs)) return 0;
+            out->use1 = out->rs;
+            out->def = out->rd;
+            break;
+        case FMT_MEM:
+            if (!parse_register(a[0], line, &out->rd) || !parse_address(a[1], line, out)) return 0;
+            out->use1 = out->rs;
+            if (out->op == EMU_SW) {
+                out->use2 = out->rd;
+            } else {
+                out->def = out->rd;
+            }
+            break;
+        case FMT_HILO:
+            if (nargs == 3) {
+                if (!parse_register(a[0], line, &out->rd) || !parse_register(a[1], line, &out->rs) ||
+                    !parse_register(a[2], line, &out->rt)) return 0;
+            } else if (!parse_register(a[0], line, &out->rs) || !parse_register(a[1], line, &out->rt)) {
+                return 0;
+            }
+            out->use1 = out->rs;
+            out->use2 = out->rt;
+            out->def = EMU_HILO;
+            break;
+        case FMT_R:
+            if (out->op == EMU_JR) {
+                if (!parse_register(a[0], line, &out->rs)) return 0;
+                out->use1 = out->rs;
+            } else {
+                if (!parse_register(a[0], line, &out->rd)) return 0;
+                out->use1 = EMU_HILO;
+                out->def = out->rd;
+            }
+            break;
+        case FMT_BRANCH:
+            if (!parse_register(a[0], line, &out->rs) || !parse_reg_or_imm(a[1], line, out) ||
+                !parse_target(a[2], line, out)) return 0;
+            out->use1 = out->rs;
+            out->use2 = out->rt;
+            break;
+        case FMT_BRANCH_Z:
+            if (!parse_register(a[0], line, &out->rs) || !parse_target(a[1], line, out)) return 0;
+            out->rt = 0;
+            out->use1 = out->rs;
+            break;
+        case FMT_JUMP:
+            if (!parse_target(a[0], line, out)) return 0;
+            if (out->op == EMU_JAL) out->def = 31;
+            break;
+        case FMT_NONE:
+            if (out->op == EMU_SYSCALL) {
+                out->use1 = 2;      // $v0
+                out->use2 = 4;      // $a0
+                out->def = 2;
+            }
+            break;
+    }
+    if (out->def == 0) out->def = -1;       // Escritas em $zero são descartadas
+    return 1;
+}
+
+
+// --- Execução ---
+
+// Estatísticas
+typedef struct {
+    long long instructions, loads, stores, branches, taken, jumps, syscalls;
+    long long cycles, stall_cycles, branch_cycles;
+} EmuStats;
+
+static uint8_t* memory_at(uint32_t address, uint32_t size) {
+    if (address >= EMU_DATA_BASE && address - EMU_DATA_BASE + size <= data_size) {
+        return data + (address - EMU_DATA_BASE);
+    }
+    if (address >= EMU_STACK_TOP - EMU_STACK_SIZE && address + size <= EMU_STACK_TOP) {
+        return stack + (address - (EMU_STACK_TOP - EMU_STACK_SIZE));
+    }
+    return NULL;
+}
+
+static int runtime_error(const EmuInstr* instr, const char* message, uint32_t value) {
+    fflush(stdout);
+    fprintf(stderr, "Erro de execucao (%s, linha %d): %s 0x%08x\n", asm_file, instr->line, message, value);
+    return 1;
+}
+
+/*
+    * Função: execute
+    * -------------------------------
+    * Laço principal sobre o cache pré-decodificado. O modelo de ciclos emite
+    * uma instrução por ciclo, espera o resultado de quem a antecede quando a
+    * latência ainda não passou e cobra uma bolha por desvio tomado quando não
+    * há delay slot.
+*/
+static int execute(EmuInstr* code, int ncode, int entry, EmuStats* stats) {
+    int32_t r[32] = { 0 };
+    int32_t hi = 0, lo = 0;
+    long long ready[EMU_NUM_REGS] = { 0 };
+    long long cycle = 0;
+    int delay = delay_slots_enabled;
+    int pc = entry;
+    int npc = entry + 1;
+
+    r[28] = (int32_t)EMU_GP;
+    r[29] = (int32_t)EMU_SP;
+    r[31] = 0;                  // jr para o endereço 0 encerra o programa
+
+    for (;;) {
+        if (pc < 0 || pc >= ncode) {
+            fflush(stdout);
+            fprintf(stderr, "Erro de execucao (%s): execucao saiu da secao .text\n", asm_file);
+            return 1;
+        }
+        EmuInstr* in = &code[pc];
+        int this_pc = pc;
+        int target = -1;
+        pc = npc;
+        npc = pc + 1;
+
+        // Modelo de ciclos
+        long long issue = cycle;
+        if (in->use1 >= 0 && ready[in->use1] > issue) issue = ready[in->use1];
+        if (in->use2 >= 0 && ready[in->use2] > issue) issue = ready[in->use2];
+        stats->stall_cycles += issue - cycle;
+        if (in->def >= 0) ready[in->def] = issue + in->latency;
+        in->cycles += issue + 1 - cycle;
+        in->executed++;
+        cycle = issue + 1;
+        stats->instructions++;
+
+        int32_t b = in->rt >= 0 ? r[in->rt] : in->imm;
+        int32_t result = 0;
+        switch (in->op) {
+            case EMU_LI:    result = in->imm; break;
+            case EMU_MOVE:  result = r[in->rs]; break;
+            case EMU_LA:    result = r[in->rs] + in->imm; break;
+            case EMU_ADD:   result = (int32_t)((uint32_t)r[in->rs] + (uint32_t)b); break;
+            case EMU_SUB:   result = (int32_t)((uint32_t)r[in->rs] - (uint32_t)b); break;
+            case EMU_MUL:   result = (int32_t)((uint32_t)r[in->rs] * (uint32_t)b); break;
+            case EMU_AND:   result = r[in->rs] & b; break;
+            case EMU_OR:    result = r[in->rs] | b; break;
+            case EMU_XOR:   result = r[in->rs] ^ b; break;
+            case EMU_NOR:   result = ~(r[in->rs] | b); break;
+            case EMU_SLT:   result = r[in->rs] < b; break;
+            case EMU_SLTU:  result = (uint32_t)r[in->rs] < (uint32_t)b; break;
+            case EMU_SEQ:   result = r[in->rs] == b; break;
+            case EMU_SNE:   result = r[in->rs] != b; break;
+            case EMU_SLL:   result = (int32_t)((uint32_t)r[in->rs] << (b & 31)); break;
+            case EMU_SRL:   result = (int32_t)((uint32_t)r[in->rs] >> (b & 31)); break;
+            case EMU_SRA:   result = r[in->rs] >> (b & 31); break;
+            case EMU_NEG:   result = (int32_t)(0u - (uint32_t)r[in->rs]); break;
+            case EMU_NOT:   result = ~r[in->rs]; break;
+            case EMU_MFLO:  result = lo; break;
+            case EMU_MFHI:  result = hi; break;
+
+            case EMU_LW:
+            case EMU_SW: {
+                uint32_t address = (uint32_t)(r[in->rs] + in->imm);
+                uint8_t* cell = memory_at(address, 4);
+                if (cell == NULL || address % 4 != 0) return runtime_error(in, "acesso invalido ao endereco", address);
+                if (in->op == EMU_LW) {
+                    memcpy(&result, cell, 4);
+                    stats->loads++;
+                } else {
+                    memcpy(cell, &r[in->rd], 4);
+                    stats->stores++;
+                }
+                break;
+            }
+
+            case EMU_MULT:
+            case EMU_MULTU: {
+                int64_t product = in->op == EMU_MULT ? (int64_t)r[in->rs] * r[in->rt]
+                                                     : (int64_t)((uint64_t)(uint32_t)r[in->rs] * (uint32_t)r[in->rt]);
+                lo = (int32_t)(uint32_t)product;
+                hi = (int32_t)(uint32_t)((uint64_t)product >> 32);
+                break;
+            }
+            case EMU_DIV:
+            case EMU_DIVU:
+                if (r[in->rt] == 0) return runtime_error(in, "divisao por zero em", EMU_TEXT_BASE + 4 * this_pc);
+                if (in->op == EMU_DIVU) {
+                    lo = (int32_t)((uint32_t)r[in->rs] / (uint32_t)r[in->rt]);
+                    hi = (int32_t)((uint32_t)r[in->rs] % (uint32_t)r[in->rt]);
+                } else if (r[in->rs] == INT32_MIN && r[in->rt] == -1) {
+                    lo = INT32_MIN;
+                    hi = 0;
+                } else {
+                    lo = r[in->rs] / r[in->rt];
+                    hi = r[in->rs] % r[in->rt];
+                }
+                if (in->rd > 0) r[in->rd] = lo;     // div $rd, $rs, $rt
+                break;
+
+            case EMU_BEQ: stats->branches++; if (r[in->rs] == b) target = in->target; break;
+            case EMU_BNE: stats->branches++; if (r[in->rs] != b) target = in->target; break;
+            case EMU_BLT: stats->branches++; if (r[in->rs] < b) target = in->target; break;
+            case EMU_BGE: stats->branches++; if (r[in->rs] >= b) target = in->target; break;
+            case EMU_BGT: stats->branches++; if (r[in->rs] > b) target = in->target; break;
+            case EMU_BLE: stats->branches++; if (r[in->rs] <= b) target = in->target; break;
+
+            case EMU_J:
+                stats->jumps++;
+                target = in->target;
+                break;
+            case EMU_JAL:
+                stats->jumps++;
+                result = (int32_t)(EMU_TEXT_BASE + 4 * (this_pc + (delay ? 2 : 1)));
+                target = in->target;
+                break;
+            case EMU_JR: {
+                uint32_t address = (uint32_t)r[in->rs];
+                stats->jumps++;
+                if (address == 0) goto finish;
+                if (address < EMU_TEXT_BASE || (address - EMU_TEXT_BASE) % 4 != 0) {
+                    return runtime_error(in, "salto para endereco invalido", address);
+                }
+                target = (int)((address - EMU_TEXT_BASE) / 4);
+                break;
+            }
+
+            case EMU_SYSCALL:
+                stats->syscalls++;
+                switch (r[2]) {
+                    case 1:
+                        printf("%d", r[4]);
+                        break;
+                    case 4: {
+                        uint32_t address = (uint32_t)r[4];
+                        uint8_t* c;
+                        while ((c = memory_at(address, 1)) != NULL && *c != '\0') {
+                            putchar(*c);
+                            address++;
+                        }
+                        if (c == NULL) return runtime_error(in, "cadeia fora da memoria em", address);
+                        break;
+                    }
+                    case 5: {
+                        int value = 0;
+                        fflush(stdout);
+                        if (scanf("%d", &value) != 1) value = 0;
+                        r[2] = value;
+                        break;
+                    }
+                    case 10:
+                        goto finish;
+                    case 11:
+                        putchar((char)r[4]);
+                        break;
+                    default:
+                        return runtime_error(in, "syscall nao suportada:", (uint32_t)r[2]);
+                }
+                continue;
+
+            case EMU_NOP:
+                continue;
+        }
+
+        if (in->def >= 0 && in->def < 32) r[in->def] = result;
+        if (target >= 0) {
+            if (in->op >= EMU_BEQ && in->op <= EMU_BLE) stats->taken++;
+            if (delay) {
+                npc = target;                   // O delay slot (em pc) executa antes
+            } else {
+                pc = target;
+                npc = target + 1;
+                cycle += EMU_BRANCH_PENALTY;
+                in->cycles += EMU_BRANCH_PENALTY;
+                stats->branch_cycles += EMU_BRANCH_PENALTY;
+            }
+        }
+    }
+
+finish:
+    stats->cycles = cycle;
+    return 0;
+}
+
+/*
+    * Função: report_lines
+    * -------------------------------
+    * Leva as contagens de cada instrução para a linha do fonte pela tabela de
+    * linhas gravada junto com o .asm (linha_asm linha_fonte funcao).
+*/
+static void report_lines(const EmuInstr* code, int ncode) {
+    char filename[256];
+    mips_line_table_name(asm_file, filename, sizeof(filename));
+    FILE* in = fopen(filename, "r");
+    if (in == NULL) {
+        fprintf(stderr, "Aviso: tabela de linhas '%s' nao encontrada; sem perfil por linha\n", filename);
+        return;
+    }
+
+    int max_line = ncode > 0 ? code[ncode - 1].line : 0;
+    int* source_line = (int*)calloc(max_line + 1, sizeof(int));
+    char (*function)[MIPS_ARG_LEN] = calloc(max_line + 1, MIPS_ARG_LEN);
+
+    char buffer[512];
+    while (fgets(buffer, sizeof(buffer), in) != NULL) {
+        int asm_line, line;
+        char name[MIPS_ARG_LEN];
+        if (buffer[0] == '#' || sscanf(buffer, "%d %d %63s", &asm_line, &line, name) != 3) continue;
+        if (asm_line < 0 || asm_line > max_line) continue;
+        source_line[asm_line] = line;
+        snprintf(function[asm_line], MIPS_ARG_LEN, "%s", name);
+    }
+    fclose(in);
+
+    for (int i = 0; i < ncode; i++) {
+        int line = code[i].line;
+        const char* name = function[line][0] != '\0' ? function[line] : "?";
+        line_profile_add(name, source_line[line], code[i].executed, code[i].cycles);
+    }
+    line_profile_report("Perfil por linha do fonte (emulador MIPS):", "Instrucoes", 1);
+
+    free(source_line);
+    free(function);
+}
+
+static void free_program(void) {
+    for (int i = 0; i < nlabels; i++) free(labels[i].name);
+    free(labels);
+    free(sources);
+    free(data);
+    free(stack);
+    labels = NULL;
+    sources = NULL;
+    data = NULL;
+    stack = NULL;
+    nlabels = nsources = 0;
+    data_size = 0;
+    npending_data = 0;
+}
+
+int mips_emulate(const char* asm_filename) {
+    asm_file = asm_filename;
+    FILE* in = fopen(asm_filename, "r");
+    if (in == NULL) {
+        perror("Erro ao abrir o arquivo para o emulador");
+        return 1;
+    }
+    int ok = read_source(in);
+    fclose(in);
+
+    EmuInstr* code = NULL;
+    EmuLabel* main_label = find_label("main");
+    if (ok && (main_label == NULL || !main_label->is_text)) {
+        fprintf(stderr, "Erro no emulador (%s): rotulo main nao encontrado\n", asm_filename);
+        ok = 0;
+    }
+    if (ok) {
+        code = (EmuInstr*)malloc(sizeof(EmuInstr) * (nsources + 1));
+        for (int i = 0; i < nsources && ok; i++) ok = decode(&sources[i], &code[i]);
+    }
+    if (!ok) {
+        free(code);
+        free_program();
+        return 1;
+    }
+
+    stack = (uint8_t*)calloc(EMU_STACK_SIZE, 1);
+    EmuStats stats = { 0 };
+    clock_t start = clock();
+    int status = execute(code, nsources, (int)main_label->value, &stats);
+    fflush(stdout);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (status == 0) {
+        fprintf(stderr, "Emulador MIPS: %lld instrucoes (%lld loads, %lld stores, %lld desvios, %lld tomados, "
+                        "%lld saltos, %lld syscalls) em %.3f ms\n",
+                stats.instructions, stats.loads, stats.stores, stats.branches, stats.taken,
+                stats.jumps, stats.syscalls, seconds * 1000);
+        fprintf(stderr, "Ciclos estimados: %lld (%lld de espera por latencia, %lld de desvios tomados), CPI %.2f\n",
+                stats.cycles, stats.stall_cycles, stats.branch_cycles,
+                stats.instructions > 0 ? (double)stats.cycles / stats.instructions : 0.0);
+        if (line_profile_enabled) report_lines(code, nsources);
+    }
+
+    free(code);
+    free_program();
+    return status;
+}
@@ -0,0 +1,17 @@
+#ifndef MIPS_EMU_H
+#define MIPS_EMU_H
+
+// Emulador MIPS embutido (--emulate): executa o output.asm gerado pelo
+// compilador (o subconjunto emitido por codigo.c e ir_mips.c, com as syscalls
+// 1, 4, 5, 10 e 11) e mede o código: instruções executadas, loads, stores,
+// desvios e uma estimativa de ciclos pelo modelo de latência do escalonador.
+
+/**
+ * Monta o arquivo em um cache de instruções pré-decodificadas e executa a
+ * partir do rótulo main. A saída do programa vai para stdout e as estatísticas
+ * para stderr. Com --delay-slots, desvios e saltos executam o delay slot.
+ * @return 0 em caso de sucesso, 1 se o arquivo é inválido ou houve erro de execução.
+ */
+int mips_emulate(const char* asm_filename);
+
+#endif // MIPS_EMU_H
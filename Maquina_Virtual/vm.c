@@ -0,0 +1,466 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "vm.h"
+
+// Tamanho da pilha de registradores e profundidade máxima de chamadas
+#define VM_STACK_WORDS (1 << 22)
+#define VM_MAX_CALLS (1 << 20)
+
+// Estado da tradução da função atual
+static VmProgram* vm_prog = NULL;
+static IrProgram* ir_prog = NULL;
+static IrFunction* cur_func = NULL;
+static VmFunction* cur_vm_func = NULL;
+static int code_capacity = 0;
+static int* vreg_uses = NULL;
+static char* vreg_fused = NULL;       // Comparação lida só pelo desvio seguinte
+
+
+// --- Tradução da IR ---
+
+static VmInstr* emit(int op, int a, int b, int c) {
+    if (cur_vm_func->ncode == code_capacity) {
+        code_capacity = code_capacity ? code_capacity * 2 : 64;
+        cur_vm_func->code = (VmInstr*)realloc(cur_vm_func->code, sizeof(VmInstr) * code_capacity);
+    }
+    VmInstr* instr = &cur_vm_func->code[cur_vm_func->ncode++];
+    memset(instr, 0, sizeof(VmInstr));
+    instr->op = op;
+    instr->a = a;
+    instr->b = b;
+    instr->c = c;
+    return instr;
+}
+
+// Registrador da máquina virtual de um registrador virtual da IR
+static int reg(int vreg) {
+    return cur_func->nvars + vreg;
+}
+
+/*
+    * Função: vm_decode_string
+    * -------------------------------
+    * Tira as aspas do literal e resolve os escapes como o montador MIPS faz
+    * com .asciiz (\n, \t, \\ e \").
+*/
+char* vm_decode_string(const char* literal) {
+    size_t length = strlen(literal);
+    char* text = (char*)malloc(length + 1);
+    size_t out = 0;
+    for (size_t i = 1; i + 1 < length; i++) {
+        if (literal[i] == '\\' && i + 2 < length) {
+            char next = literal[++i];
+            text[out++] = next == 'n' ? '\n' : next == 't' ? '\t' : next == '0' ? '\0' : next;
+        } else {
+            text[out++] = literal[i];
+        }
+    }
+    text[out] = '\0';
+    return text;
+}
+
+static int string_index(const char* literal) {
+    char* text = vm_decode_string(literal);
+    for (int i = 0; i < vm_prog->nstrings; i++) {
+        if (strcmp(vm_prog->strings[i], text) == 0) {
+            free(text);
+            return i;
+        }
+    }
+    vm_prog->strings = (char**)realloc(vm_prog->strings, sizeof(char*) * (vm_prog->nstrings + 1));
+    vm_prog->strings[vm_prog->nstrings] = text;
+    return vm_prog->nstrings++;
+}
+
+static int function_index(const char* name) {
+    int index = 0;
+    for (IrFunction* func = ir_prog->functions; func != NULL; func = func->next, index++) {
+        if (strcmp(func->name, name) == 0) return index;
+    }
+    fprintf(stderr, "Erro interno: funcao '%s' nao encontrada na maquina virtual.\n", name);
+    exit(EXIT_FAILURE);
+}
+
+static int is_compare(IrOperator oper) {
+    return oper >= IR_EQ && oper <= IR_GE;
+}
+
+// Mesma fusão de comparação e desvio que os geradores de MIPS e x86-64 fazem
+static void mark_fused_compares(IrFunction* func) {
+    vreg_uses = (int*)calloc(func->nregs + 1, sizeof(int));
+    vreg_fused = (char*)calloc(func->nregs + 1, sizeof(char));
+
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            if (instr->src1 >= 0) vreg_uses[instr->src1]++;
+            if (instr->src2 >= 0) vreg_uses[instr->src2]++;
+            for (int i = 0; i < instr->nargs; i++) vreg_uses[instr->args[i]]++;
+        }
+    }
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        IrInstr* branch = block->last;
+        if (branch == NULL || branch->op != IR_BRANCH) continue;
+        IrInstr* cmp = branch->prev;
+        if (cmp != NULL && cmp->op == IR_BINOP && is_compare(cmp->oper) &&
+            cmp->dst == branch->src1 && vreg_uses[cmp->dst] == 1) {
+            vreg_fused[cmp->dst] = 1;
+        }
+    }
+}
+
+static IrBlock* next_emitted(IrBlock* block) {
+    IrBlock* next = block->next;
+    while (next != NULL && next->rpo_index < 0) next = next->next;
+    return next;
+}
+
+// Desvio condicional fundido: comparação (ou sua negação) e destino
+static void emit_fused_branch(IrInstr* cmp, int negated, IrBlock* target) {
+    static const int jumps[] = { VM_JEQ, VM_JNE, VM_JLT, VM_JGT, VM_JLE, VM_JGE };
+    static const int negations[] = { VM_JNE, VM_JEQ, VM_JGE, VM_JLE, VM_JGT, VM_JLT };
+    int index = cmp->oper - IR_EQ;
+    emit(negated ? negations[index] : jumps[index], reg(cmp->src1), reg(cmp->src2), target->id);
+}
+
+/*
+    * Função: compile_instr
+    * -------------------------------
+    * Traduz uma instrução da IR. Variáveis locais e parâmetros são
+    * registradores da máquina virtual, então load/store viram move. Os
+    * destinos dos desvios guardam o id do bloco e são corrigidos depois.
+*/
+static void compile_instr(IrBlock* block, IrInstr* instr) {
+    switch (instr->op) {
+        case IR_CONST:
+            emit(VM_CONST, reg(instr->dst), instr->imm, 0);
+            break;
+
+        case IR_COPY:
+            emit(VM_MOVE, reg(instr->dst), reg(instr->src1), 0);
+            break;
+
+        case IR_BINOP:
+            if (vreg_fused[instr->dst]) break;      // Traduzida junto com o desvio
+            emit(VM_ADD + (instr->oper - IR_ADD), reg(instr->dst), reg(instr->src1), reg(instr->src2));
+            break;
+
+        case IR_UNOP:
+            emit(instr->oper == IR_NEG ? VM_NEG : VM_NOT, reg(instr->dst), reg(instr->src1), 0);
+            break;
+
+        case IR_LOAD:
+            if (instr->var->kind == IR_VAR_GLOBAL) emit(VM_LOAD_G, reg(instr->dst), instr->var->index, 0);
+            else emit(VM_MOVE, reg(instr->dst), instr->var->index, 0);
+            break;
+
+        case IR_STORE:
+            if (instr->var->kind == IR_VAR_GLOBAL) emit(VM_STORE_G, instr->var->index, reg(instr->src1), 0);
+            else emit(VM_MOVE, instr->var->index, reg(instr->src1), 0);
+            break;
+
+        case IR_CALL: {
+            int first = vm_prog->nargs;
+            vm_prog->args = (int*)realloc(vm_prog->args, sizeof(int) * (vm_prog->nargs + instr->nargs + 1));
+            for (int i = 0; i < instr->nargs; i++) {
+                vm_prog->args[vm_prog->nargs++] = reg(instr->args[i]);
+            }
+            // Valor descartado vai para o registrador extra no fim do frame
+            int dst = instr->dst >= 0 ? reg(instr->dst) : cur_func->nvars + cur_func->nregs;
+            VmInstr* call = emit(VM_CALL, dst, function_index(instr->name), first);
+            call->d = cur_vm_func->frame_size;
+            break;
+        }
+
+        case IR_READ:
+            emit(VM_READ, reg(instr->dst), 0, 0);
+            break;
+
+        case IR_WRITE_INT:
+            emit(VM_WRITE_INT, reg(instr->src1), 0, 0);
+            break;
+
+        case IR_WRITE_CHAR:
+            emit(VM_WRITE_CHAR, reg(instr->src1), 0, 0);
+            break;
+
+        case IR_WRITE_STR:
+            emit(VM_WRITE_STR, string_index(instr->name), 0, 0);
+            break;
+
+        case IR_NEWLINE:
+            emit(VM_NEWLINE, 0, 0, 0);
+            break;
+
+        case IR_JUMP:
+            if (next_emitted(block) != instr->target1) emit(VM_JUMP, instr->target1->id, 0, 0);
+            break;
+
+        case IR_BRANCH: {
+            IrBlock* next = next_emitted(block);
+            IrInstr* cmp = instr->prev;
+            int fused = cmp != NULL && cmp->op == IR_BINOP && vreg_fused[cmp->dst];
+
+            if (next == instr->target1) {
+                // Cai no braço verdadeiro: desvia para o falso com a condição negada
+                if (fused) emit_fused_branch(cmp, 1, instr->target2);
+                else emit(VM_JZ, reg(instr->src1), instr->target2->id, 0);
+            } else {
+                if (fused) emit_fused_branch(cmp, 0, instr->target1);
+                else emit(VM_JNZ, reg(instr->src1), instr->target1->id, 0);
+                if (next != instr->target2) emit(VM_JUMP, instr->target2->id, 0, 0);
+            }
+            break;
+        }
+
+        case IR_RET:
+            if (cur_func->is_main) emit(VM_HALT, 0, 0, 0);
+            else if (instr->src1 >= 0) emit(VM_RET, reg(instr->src1), 0, 0);
+            else emit(VM_RET_VOID, 0, 0, 0);
+            break;
+    }
+}
+
+static void compile_function(IrFunction* func, VmFunction* vm_func) {
+    cur_func = func;
+    cur_vm_func = vm_func;
+    code_capacity = 0;
+
+    vm_func->name = strdup(func->name);
+    vm_func->nparams = func->nparams;
+    vm_func->nvars = func->nvars;
+    vm_func->frame_size = func->nvars + func->nregs + 1;
+
+    ir_compute_dominators(func);
+    mark_fused_compares(func);
+
+    int* block_start = (int*)malloc(sizeof(int) * (func->nblocks + 1));
+    for (IrBlock* block = func->entry; block != NULL; block = block->next) {
+        if (block->rpo_index < 0) continue;     // Bloco inalcançável
+        block_start[block->id] = vm_func->ncode;
+        for (IrInstr* instr = block->first; instr != NULL; instr = instr->next) {
+            compile_instr(block, instr);
+        }
+    }
+
+    // Troca os ids de bloco dos desvios pelas posições no código
+    for (int i = 0; i < vm_func->ncode; i++) {
+        VmInstr* instr = &vm_func->code[i];
+        if (instr->op == VM_JUMP) instr->a = block_start[instr->a];
+        else if (instr->op == VM_JZ || instr->op == VM_JNZ) instr->b = block_start[instr->b];
+        else if (instr->op >= VM_JEQ && instr->op <= VM_JGE) instr->c = block_start[instr->c];
+    }
+
+    free(block_start);
+    free(vreg_uses);
+    free(vreg_fused);
+    vreg_uses = NULL;
+    vreg_fused = NULL;
+}
+
+VmProgram* vm_compile(IrProgram* prog) {
+    vm_prog = (VmProgram*)calloc(1, sizeof(VmProgram));
+    ir_prog = prog;
+
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next) vm_prog->nfunctions++;
+    vm_prog->functions = (VmFunction*)calloc(vm_prog->nfunctions, sizeof(VmFunction));
+    vm_prog->nglobals = prog->nglobals;
+
+    int index = 0;
+    for (IrFunction* func = prog->functions; func != NULL; func = func->next, index++) {
+        if (func->is_main) vm_prog->main_index = index;
+        compile_function(func, &vm_prog->functions[index]);
+    }
+
+    VmProgram* result = vm_prog;
+    vm_prog = NULL;
+    ir_prog = NULL;
+    cur_func = NULL;
+    cur_vm_func = NULL;
+    return result;
+}
+
+void vm_free(VmProgram* program) {
+    for (int i = 0; i < program->nfunctions; i++) {
+        free(program->functions[i].name);
+        free(program->functions[i].code);
+    }
+    for (int i = 0; i < program->nstrings; i++) free(program->strings[i]);
+    free(program->functions);
+    free(program->strings);
+    free(program->args);
+    free(program);
+}
+
+
+// --- Execução ---
+
+// Entrada salva na pilha de chamadas
+typedef struct {
+    VmInstr* code;          // Código da função de quem chama (base dos destinos de desvio)
+    VmInstr* return_pc;
+    int32_t* base;
+    int dst;
+} VmFrame;
+
+static int32_t vm_read_int(void) {
+    int value = 0;
+    if (scanf("%d", &value) != 1) value = 0;
+    return value;
+}
+
+/*
+    * Função: vm_run
+    * -------------------------------
+    * Interpretador com despacho direto (computed goto do GCC/Clang): cada
+    * instrução guarda o endereço do seu tratador, e o fim de cada tratador
+    * salta direto para o da próxima, sem passar por um switch central. A
+    * aritmética dá a volta em 32 bits, como no MIPS.
+*/
+int vm_run(VmProgram* program) {
+    static const void* handlers[VM_NUM_OPS] = {
+        [VM_CONST] = &&op_const, [VM_MOVE] = &&op_move, [VM_LOAD_G] = &&op_load_g, [VM_STORE_G] = &&op_store_g,
+        [VM_ADD] = &&op_add, [VM_SUB] = &&op_sub, [VM_MUL] = &&op_mul, [VM_DIV] = &&op_div,
+        [VM_EQ] = &&op_eq, [VM_NE] = &&op_ne, [VM_LT] = &&op_lt, [VM_GT] = &&op_gt,
+        [VM_LE] = &&op_le, [VM_GE] = &&op_ge, [VM_NEG] = &&op_neg, [VM_NOT] = &&op_not,
+        [VM_JUMP] = &&op_jump, [VM_JZ] = &&op_jz, [VM_JNZ] = &&op_jnz,
+        [VM_JEQ] = &&op_jeq, [VM_JNE] = &&op_jne, [VM_JLT] = &&op_jlt, [VM_JGT] = &&op_jgt,
+        [VM_JLE] = &&op_jle, [VM_JGE] = &&op_jge,
+        [VM_CALL] = &&op_call, [VM_RET] = &&op_ret, [VM_RET_VOID] = &&op_ret_void,
+        [VM_READ] = &&op_read, [VM_WRITE_INT] = &&op_write_int, [VM_WRITE_CHAR] = &&op_write_char,
+        [VM_WRITE_STR] = &&op_write_str, [VM_NEWLINE] = &&op_newline, [VM_HALT] = &&op_halt,
+    };
+
+    // Despacho direto: o tratador de cada instrução é resolvido uma única vez
+    for (int f = 0; f < program->nfunctions; f++) {
+        for (int i = 0; i < program->functions[f].ncode; i++) {
+            program->functions[f].code[i].handler = handlers[program->functions[f].code[i].op];
+        }
+    }
+
+    int32_t* stack = (int32_t*)calloc(VM_STACK_WORDS, sizeof(int32_t));
+    int32_t* stack_end = stack + VM_STACK_WORDS;
+    int32_t* globals = (int32_t*)calloc(program->nglobals + 1, sizeof(int32_t));
+    VmFrame* calls = (VmFrame*)malloc(sizeof(VmFrame) * VM_MAX_CALLS);
+    VmFrame* call_top = calls;
+    const int* args = program->args;
+    const VmFunction* functions = program->functions;
+
+    VmFunction* main_func = &program->functions[program->main_index];
+    int32_t* r = stack;
+    VmInstr* code = main_func->code;
+    VmInstr* pc = code;
+    uint64_t executed = 0;
+    int status = 0;
+    clock_t start = clock();
+
+    if (main_func->frame_size > VM_STACK_WORDS) goto stack_overflow;
+
+#define DISPATCH() do { executed++; goto *pc->handler; } while (0)
+#define NEXT() do { pc++; DISPATCH(); } while (0)
+#define ARITH(expr) r[pc->a] = (int32_t)(expr); NEXT()
+#define JUMP_IF(cond, target) if (cond) { pc = code + (target); DISPATCH(); } NEXT()
+
+    DISPATCH();
+
+op_const:   ARITH(pc->b);
+op_move:    ARITH(r[pc->b]);
+op_load_g:  ARITH(globals[pc->b]);
+op_store_g: globals[pc->a] = r[pc->b]; NEXT();
+op_add:     ARITH((uint32_t)r[pc->b] + (uint32_t)r[pc->c]);
+op_sub:     ARITH((uint32_t)r[pc->b] - (uint32_t)r[pc->c]);
+op_mul:     ARITH((uint32_t)r[pc->b] * (uint32_t)r[pc->c]);
+op_div:
+    if (r[pc->c] == 0) {
+        fprintf(stderr, "Erro de execucao: divisao por zero.\n");
+        status = 1;
+        goto finish;
+    }
+    ARITH(r[pc->c] == -1 ? 0u - (uint32_t)r[pc->b] : (uint32_t)(r[pc->b] / r[pc->c]));
+op_eq:      ARITH(r[pc->b] == r[pc->c]);
+op_ne:      ARITH(r[pc->b] != r[pc->c]);
+op_lt:      ARITH(r[pc->b] < r[pc->c]);
+op_gt:      ARITH(r[pc->b] > r[pc->c]);
+op_le:      ARITH(r[pc->b] <= r[pc->c]);
+op_ge:      ARITH(r[pc->b] >= r[pc->c]);
+op_neg:     ARITH(0u - (uint32_t)r[pc->b]);
+op_not:     ARITH(r[pc->b] == 0);
+op_jump:    pc = code + pc->a; DISPATCH();
+op_jz:      JUMP_IF(r[pc->a] == 0, pc->b);
+op_jnz:     JUMP_IF(r[pc->a] != 0, pc->b);
+op_jeq:     JUMP_IF(r[pc->a] == r[pc->b], pc->c);
+op_jne:     JUMP_IF(r[pc->a] != r[pc->b], pc->c);
+op_jlt:     JUMP_IF(r[pc->a] < r[pc->b], pc->c);
+op_jgt:     JUMP_IF(r[pc->a] > r[pc->b], pc->c);
+op_jle:     JUMP_IF(r[pc->a] <= r[pc->b], pc->c);
+op_jge:     JUMP_IF(r[pc->a] >= r[pc->b], pc->c);
+
+op_call: {
+    // O frame do chamado começa logo depois do frame de quem chama
+    const VmFunction* callee = &functions[pc->b];
+    int32_t* callee_base = r + pc->d;
+    if (callee_base + callee->frame_size > stack_end || call_top == calls + VM_MAX_CALLS) goto stack_overflow;
+
+    for (int i = 0; i < callee->nparams; i++) callee_base[i] = r[args[pc->c + i]];
+    for (int i = callee->nparams; i < callee->nvars; i++) callee_base[i] = 0;
+
+    call_top->code = code;
+    call_top->return_pc = pc + 1;
+    call_top->base = r;
+    call_top->dst = pc->a;
+    call_top++;
+    r = callee_base;
+    code = callee->code;
+    pc = code;
+    DISPATCH();
+}
+
+op_ret:
+    call_top--;
+    call_top->base[call_top->dst] = r[pc->a];
+    r = call_top->base;
+    code = call_top->code;
+    pc = call_top->return_pc;
+    DISPATCH();
+
+op_ret_void:
+    call_top--;
+    call_top->base[call_top->dst] = 0;
+    r = call_top->base;
+    code = call_top->code;
+    pc = call_top->return_pc;
+    DISPATCH();
+
+op_read:       ARITH(vm_read_int());
+op_write_int:  printf("%d", r[pc->a]); NEXT();
+op_write_char: putchar((char)r[pc->a]); NEXT();
+op_write_str:  fputs(program->strings[pc->a], stdout); NEXT();
+op_newline:    putchar('\n'); NEXT();
+
+stack_overflow:
+    fprintf(stderr, "Erro de execucao: estouro da pilha da maquina virtual.\n");
+    status = 1;
+    goto finish;
+
+op_halt:
+finish:
+    fflush(stdout);
+    {
+        double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        fprintf(stderr, "Maquina virtual: %llu instrucoes em %.3f ms", (unsigned long long)executed, seconds * 1000);
+        if (seconds > 0) fprintf(stderr, " (%.1f milhoes/s)", executed / seconds / 1e6);
+        fprintf(stderr, "\n");
+    }
+
+#undef DISPATCH
+#undef NEXT
+#undef ARITH
+#undef JUMP_IF
+
+    free(stack);
+    free(globals);
+    free(calls);
+    return status;
+}
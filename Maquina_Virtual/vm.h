@@ -0,0 +1,80 @@
+#ifndef VM_H
+#define VM_H
+
+#include "./../Codigo_Intermediario/ir.h"
+
+// Máquina virtual de registradores (--run): a IR otimizada é traduzida para
+// um bytecode compacto e executada na hora, sem gerar output.asm.
+
+// Operações do bytecode
+typedef enum {
+    VM_CONST,      // r[a] = b
+    VM_MOVE,       // r[a] = r[b]
+    VM_LOAD_G,     // r[a] = globais[b]
+    VM_STORE_G,    // globais[a] = r[b]
+    VM_ADD, VM_SUB, VM_MUL, VM_DIV,          // r[a] = r[b] op r[c]
+    VM_EQ, VM_NE, VM_LT, VM_GT, VM_LE, VM_GE,
+    VM_NEG, VM_NOT,                          // r[a] = op r[b]
+    VM_JUMP,       // pc = a
+    VM_JZ,         // se r[a] == 0: pc = b
+    VM_JNZ,        // se r[a] != 0: pc = b
+    VM_JEQ, VM_JNE, VM_JLT, VM_JGT, VM_JLE, VM_JGE,   // se r[a] op r[b]: pc = c
+    VM_CALL,       // r[a] = função b(argumentos em args[c...]); d = tamanho do frame de quem chama
+    VM_RET,        // retorna r[a]
+    VM_RET_VOID,   // retorna sem valor
+    VM_READ,       // r[a] = leia
+    VM_WRITE_INT,  // escreva r[a]
+    VM_WRITE_CHAR, // escreva r[a] como caractere
+    VM_WRITE_STR,  // escreva cadeias[a]
+    VM_NEWLINE,
+    VM_HALT,
+    VM_NUM_OPS
+} VmOpcode;
+
+typedef struct {
+    const void* handler;    // Endereço do tratador (despacho direto, preenchido ao executar)
+    int op;
+    int a, b, c, d;
+} VmInstr;
+
+typedef struct {
+    char* name;
+    VmInstr* code;
+    int ncode;
+    int nparams;
+    int nvars;              // Parâmetros e locais ocupam os registradores 0..nvars-1
+    int frame_size;         // nvars + registradores virtuais + 1 (valor descartado de chamadas)
+} VmFunction;
+
+typedef struct {
+    VmFunction* functions;
+    int nfunctions;
+    int main_index;
+    int nglobals;
+    int* args;              // Registradores dos argumentos de todas as chamadas
+    int nargs;
+    char** strings;         // Cadeias já sem aspas e com os escapes resolvidos
+    int nstrings;
+} VmProgram;
+
+/**
+ * Traduz a IR (já otimizada e verificada) para bytecode.
+ */
+VmProgram* vm_compile(IrProgram* prog);
+
+/**
+ * Executa o programa a partir do bloco principal. Imprime em stderr quantas
+ * instruções foram executadas e quanto tempo levou.
+ * @return 0 em caso de sucesso, 1 se houve erro de execução.
+ */
+int vm_run(VmProgram* program);
+
+void vm_free(VmProgram* program);
+
+/**
+ * Tira as aspas de um literal de cadeia e resolve os escapes (\n, \t, ...).
+ * @return Texto alocado com malloc.
+ */
+char* vm_decode_string(const char* literal);
+
+#endif // VM_H
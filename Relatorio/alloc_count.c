@@ -0,0 +1,30 @@
+#include <stddef.h>
+#include "time_report.h"
+
+// Contador de alocações do relatório de tempo (--time-report). Substitui
+// malloc, calloc e realloc no executável e repassa para o alocador da glibc;
+// o operator new do C++ (tabela de símbolos) também passa por aqui. free não
+// precisa mudar: os blocos continuam sendo da glibc. Fica fora da biblioteca,
+// para não trocar o alocador de quem a usa.
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+    alloc_calls++;
+    alloc_bytes += size;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    alloc_calls++;
+    alloc_bytes += count * size;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    alloc_calls++;
+    alloc_bytes += size;
+    return __libc_realloc(ptr, size);
+}
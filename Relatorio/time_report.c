@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "time_report.h"
+
+// Flags de linha de comando
+int time_report_enabled = 0;                // --time-report
+const char* time_report_json = NULL;        // --time-report=arquivo.json
+
+TimeReportCounters time_counters;
+unsigned long long alloc_calls = 0;
+unsigned long long alloc_bytes = 0;
+
+// Nome no relatório e chave no JSON de cada fase (na ordem de TimePhase)
+static const struct {
+    const char* name;
+    const char* key;
+} phase_names[NUM_PHASES] = {
+    { "analise lexica",     "lexica" },
+    { "analise sintatica",  "sintatica" },
+    { "analise semantica",  "semantica" },
+    { "geracao da IR",      "gera_ir" },
+    { "recursao de cauda",  "cauda" },
+    { "inlining",           "inline" },
+    { "CSE",                "cse" },
+    { "DCE",                "dce" },
+    { "LICM",               "licm" },
+    { "perfil (PGO)",       "perfil" },
+    { "verificacao da IR",  "verifica_ir" },
+    { "geracao de codigo",  "gera_codigo" },
+    { "peephole",           "peephole" },
+    { "escalonador",        "escalonador" },
+};
+
+typedef struct {
+    double wall_ms;
+    double cpu_ms;
+    long rss_kb;                    // Quanto o pico de RSS cresceu dentro da fase
+    unsigned long long allocs;
+    unsigned long long bytes;
+    int entered;
+} PhaseStats;
+
+static PhaseStats stats[NUM_PHASES];
+
+// Fases abertas (a do topo é a que acumula) e as medidas da última troca
+#define TIME_REPORT_MAX_DEPTH 16
+static TimePhase open_phases[TIME_REPORT_MAX_DEPTH];
+static int depth = 0;
+static double mark_wall, mark_cpu;
+static long mark_rss;
+static unsigned long long mark_allocs, mark_bytes;
+
+static double clock_ms(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static long peak_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/*
+    * Função: switch_phase
+    * -------------------------------
+    * Atribui à fase do topo o que foi gasto desde a última troca. O RSS não é
+    * lido nas trocas da análise léxica (uma por token): o crescimento dela
+    * fica com a análise sintática, que a envolve.
+*/
+static void switch_phase(int sample_rss) {
+    double wall = clock_ms(CLOCK_MONOTONIC);
+    double cpu = clock_ms(CLOCK_PROCESS_CPUTIME_ID);
+    long rss = sample_rss ? peak_rss_kb() : mark_rss;
+
+    if (depth > 0) {
+        PhaseStats* current = &stats[open_phases[depth - 1]];
+        current->wall_ms += wall - mark_wall;
+        current->cpu_ms += cpu - mark_cpu;
+        current->rss_kb += rss - mark_rss;
+        current->allocs += alloc_calls - mark_allocs;
+        current->bytes += alloc_bytes - mark_bytes;
+    }
+
+    mark_wall = wall;
+    mark_cpu = cpu;
+    mark_rss = rss;
+    mark_allocs = alloc_calls;
+    mark_bytes = alloc_bytes;
+}
+
+void time_report_begin(TimePhase phase) {
+    if (!time_report_enabled) return;
+    if (depth == 0) mark_rss = peak_rss_kb();
+    switch_phase(phase != PHASE_LEXICA);
+    if (depth < TIME_REPORT_MAX_DEPTH) {
+        open_phases[depth++] = phase;
+        stats[phase].entered = 1;
+    }
+}
+
+void time_report_end(TimePhase phase) {
+    if (!time_report_enabled || depth == 0 || open_phases[depth - 1] != phase) return;
+    switch_phase(phase != PHASE_LEXICA);
+    depth--;
+}
+
+// Soma das fases (o que não está em fase nenhuma, como ler os argumentos, fica de fora)
+static PhaseStats total_stats(void) {
+    PhaseStats total;
+    memset(&total, 0, sizeof(total));
+    for (int i = 0; i < NUM_PHASES; i++) {
+        total.wall_ms += stats[i].wall_ms;
+        total.cpu_ms += stats[i].cpu_ms;
+        total.rss_kb += stats[i].rss_kb;
+        total.allocs += stats[i].allocs;
+        total.bytes += stats[i].bytes;
+    }
+    return total;
+}
+
+static void print_row(FILE* out, const char* name, const PhaseStats* s, int has_rss) {
+    char rss[32];
+    if (has_rss) snprintf(rss, sizeof(rss), "%ld", s->rss_kb);
+    else snprintf(rss, sizeof(rss), "-");
+    fprintf(out, "  %-20s %11.3f %10.3f %9s %11llu %13llu\n",
+            name, s->wall_ms, s->cpu_ms, rss, s->allocs, s->bytes);
+}
+
+/*
+    * Função: time_report_print
+    * -------------------------------
+    * Uma linha por fase executada, o total e os contadores.
+*/
+void time_report_print(const char* source_file, FILE* out) {
+    fprintf(out, "\nRelatorio de tempo: %s\n", source_file);
+    fprintf(out, "  %-20s %11s %10s %9s %11s %13s\n", "Fase", "Parede(ms)", "CPU(ms)", "RSS(KB)", "Alocacoes", "Bytes");
+    for (int i = 0; i < NUM_PHASES; i++) {
+        if (!stats[i].entered) continue;
+        print_row(out, phase_names[i].name, &stats[i], i != PHASE_LEXICA);
+    }
+    PhaseStats total = total_stats();
+    print_row(out, "total", &total, 1);
+    fprintf(out, "  Pico de RSS: %ld KB\n", peak_rss_kb());
+    fprintf(out, "  Tokens: %llu, nos da AST: %llu, buscas de simbolos: %llu, escopos: %llu\n",
+            time_counters.tokens, time_counters.ast_nodes, time_counters.symbol_lookups, time_counters.scopes);
+    fprintf(out, "  Instrucoes da IR: %llu, instrucoes emitidas: %llu\n",
+            time_counters.ir_instrs, time_counters.instrs_emitted);
+}
+
+// Cadeia JSON com aspas e barras escapadas
+static void write_json_string(FILE* out, const char* text) {
+    fputc('"', out);
+    for (const char* c = text; *c; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', out);
+        if ((unsigned char)*c < 0x20) fprintf(out, "\\u%04x", *c);
+        else fputc(*c, out);
+    }
+    fputc('"', out);
+}
+
+static void write_json_stats(FILE* out, const PhaseStats* s, int has_rss) {
+    fprintf(out, "\"parede_ms\": %.3f, \"cpu_ms\": %.3f, ", s->wall_ms, s->cpu_ms);
+    if (has_rss) fprintf(out, "\"rss_kb\": %ld, ", s->rss_kb);
+    else fprintf(out, "\"rss_kb\": null, ");
+    fprintf(out, "\"alocacoes\": %llu, \"bytes_alocados\": %llu", s->allocs, s->bytes);
+}
+
+/*
+    * Função: time_report_write_json
+    * -------------------------------
+    * Mesmo conteúdo de time_report_print, em um objeto JSON.
+*/
+int time_report_write_json(const char* source_file, const char* filename) {
+    FILE* out = fopen(filename, "w");
+    if (!out) {
+        perror("Erro ao abrir o arquivo do relatorio de tempo");
+        return 0;
+    }
+
+    fprintf(out, "{\n  \"arquivo\": ");
+    write_json_string(out, source_file);
+    fprintf(out, ",\n  \"fases\": [\n");
+    int first = 1;
+    for (int i = 0; i < NUM_PHASES; i++) {
+        if (!stats[i].entered) continue;
+        fprintf(out, "%s    {\"fase\": \"%s\", ", first ? "" : ",\n", phase_names[i].key);
+        write_json_stats(out, &stats[i], i != PHASE_LEXICA);
+        fprintf(out, "}");
+        first = 0;
+    }
+    PhaseStats total = total_stats();
+    fprintf(out, "\n  ],\n  \"total\": {");
+    write_json_stats(out, &total, 1);
+    fprintf(out, "},\n  \"pico_rss_kb\": %ld,\n", peak_rss_kb());
+    fprintf(out, "  \"contadores\": {\"tokens\": %llu, \"nos_ast\": %llu, \"buscas_simbolos\": %llu, "
+                 "\"escopos\": %llu, \"instrucoes_ir\": %llu, \"instrucoes_emitidas\": %llu}\n}\n",
+            time_counters.tokens, time_counters.ast_nodes, time_counters.symbol_lookups,
+            time_counters.scopes, time_counters.ir_instrs, time_counters.instrs_emitted);
+
+    fclose(out);
+    return 1;
+}
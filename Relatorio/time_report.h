@@ -0,0 +1,81 @@
+#ifndef TIME_REPORT_H
+#define TIME_REPORT_H
+
+#include <stdio.h>
+
+// Relatório de tempo e memória por fase da compilação (--time-report).
+// Cada fase acumula tempo de parede, tempo de CPU, crescimento do pico de RSS
+// e alocações. As fases se aninham (a análise léxica roda dentro da sintática,
+// o peephole dentro da geração de código) e o tempo é exclusivo: o que a fase
+// interna gasta não entra na externa.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    PHASE_LEXICA,
+    PHASE_SINTATICA,
+    PHASE_SEMANTICA,
+    PHASE_GERA_IR,
+    PHASE_CAUDA,
+    PHASE_INLINE,
+    PHASE_CSE,
+    PHASE_DCE,
+    PHASE_LICM,
+    PHASE_PERFIL,
+    PHASE_VERIFICA_IR,
+    PHASE_GERA_CODIGO,
+    PHASE_PEEPHOLE,
+    PHASE_ESCALONADOR,
+    NUM_PHASES
+} TimePhase;
+
+// Contadores do relatório, somados pelas fases mesmo sem --time-report
+typedef struct {
+    unsigned long long tokens;              // Tokens devolvidos pelo analisador léxico
+    unsigned long long ast_nodes;           // Nós criados por new_ast_node
+    unsigned long long symbol_lookups;      // Buscas na tabela de símbolos
+    unsigned long long scopes;              // Escopos abertos na tabela de símbolos
+    unsigned long long ir_instrs;           // Instruções da IR criadas (inclusive pelas otimizações)
+    unsigned long long instrs_emitted;      // Instruções MIPS ou x86-64 escritas na saída
+} TimeReportCounters;
+
+extern TimeReportCounters time_counters;
+
+// Alocações (malloc, calloc, realloc e operator new), contadas por alloc_count.c.
+// Só o executável liga o contador; na biblioteca ficam em zero.
+extern unsigned long long alloc_calls;
+extern unsigned long long alloc_bytes;
+
+// Flag de linha de comando (--time-report[=arquivo.json]) e o arquivo JSON, se pedido
+extern int time_report_enabled;
+extern const char* time_report_json;
+
+/**
+ * Entra na fase: a fase atual (se houver) para de acumular até time_report_end.
+ * Não faz nada sem --time-report.
+ */
+void time_report_begin(TimePhase phase);
+
+/**
+ * Sai da fase aberta por time_report_begin e volta para a fase externa.
+ */
+void time_report_end(TimePhase phase);
+
+/**
+ * Imprime a tabela das fases e os contadores em 'out'.
+ */
+void time_report_print(const char* source_file, FILE* out);
+
+/**
+ * Escreve o relatório em JSON (um objeto por compilação) no arquivo.
+ * @return 1 em caso de sucesso, 0 se o arquivo não pôde ser escrito.
+ */
+int time_report_write_json(const char* source_file, const char* filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIME_REPORT_H
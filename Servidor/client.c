@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "server.h"
+
+// Cliente do servidor de compilação: envia um arquivo .g para o goianinha
+// --server, mostra as mensagens da compilação e grava o código gerado.
+//
+// Uso: goianinha-cliente [-s socket] [-o saida] [-t] arquivo.g
+//      goianinha-cliente [-s socket] --estado | --parar
+
+static double now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+static int read_full(int fd, char* buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = read(fd, buffer + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        done += (size_t)n;
+    }
+    return 1;
+}
+
+static int write_full(int fd, const char* buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = write(fd, buffer + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        done += (size_t)n;
+    }
+    return 1;
+}
+
+static int connect_server(const char* socket_path) {
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    snprintf(address.sun_path, sizeof(address.sun_path), "%s", socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&address, sizeof(address)) < 0) {
+        fprintf(stderr, "Nao foi possivel conectar ao servidor em %s: %s\n", socket_path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Comandos sem fonte: repassa a resposta inteira para stdout
+static int simple_command(const char* socket_path, const char* command) {
+    int fd = connect_server(socket_path);
+    if (fd < 0) return 1;
+    write_full(fd, command, strlen(command));
+
+    char buffer[1024];
+    ssize_t n;
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0) fwrite(buffer, 1, (size_t)n, stdout);
+    close(fd);
+    return 0;
+}
+
+static char* read_source(const char* path, size_t* length) {
+    FILE* in = fopen(path, "rb");
+    if (in == NULL) {
+        fprintf(stderr, "Erro ao abrir arquivo: %s\n", path);
+        return NULL;
+    }
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    char* buffer = (char*)malloc(size > 0 ? (size_t)size : 1);
+    *length = fread(buffer, 1, size > 0 ? (size_t)size : 0, in);
+    fclose(in);
+    return buffer;
+}
+
+int main(int argc, char** argv) {
+    const char* socket_path = SERVER_DEFAULT_SOCKET;
+    const char* output = "output.asm";
+    const char* source_file = NULL;
+    const char* command = NULL;
+    int show_time = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0) {
+            show_time = 1;
+        } else if (strcmp(argv[i], "--estado") == 0) {
+            command = "ESTADO\n";
+        } else if (strcmp(argv[i], "--parar") == 0) {
+            command = "PARA\n";
+        } else if (argv[i][0] != '-' && source_file == NULL) {
+            source_file = argv[i];
+        } else {
+            source_file = NULL;
+            command = NULL;
+            break;
+        }
+    }
+
+    if (command != NULL) return simple_command(socket_path, command);
+    if (source_file == NULL) {
+        fprintf(stderr, "Uso: %s [-s socket] [-o saida] [-t] <arquivo_fonte>\n"
+                        "     %s [-s socket] --estado | --parar\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    size_t length;
+    char* source = read_source(source_file, &length);
+    if (source == NULL) return 1;
+
+    double start = now_ms();
+    int fd = connect_server(socket_path);
+    if (fd < 0) {
+        free(source);
+        return 1;
+    }
+
+    // O nome identifica o arquivo no cache do servidor
+    char header[4200];
+    char resolved[4096];
+    char* name = realpath(source_file, resolved) ? resolved : (char*)source_file;
+    if (strlen(name) > 255) name += strlen(name) - 255;
+    for (char* c = name; *c != '\0'; c++) {
+        if (*c == ' ' || *c == '\t' || *c == '\n') *c = '_';
+    }
+    int size = snprintf(header, sizeof(header), "COMPILA %s %zu\n", name, length);
+    int ok = write_full(fd, header, (size_t)size) && write_full(fd, source, length);
+    free(source);
+
+    // Cabeçalho da resposta
+    char line[256];
+    size_t used = 0;
+    while (ok && used + 1 < sizeof(line)) {
+        if (!read_full(fd, &line[used], 1)) ok = 0;
+        else if (line[used] == '\n') break;
+        else used++;
+    }
+    line[used] = '\0';
+
+    int status = 1, hit = 0;
+    size_t messages_len = 0, output_len = 0;
+    if (!ok || sscanf(line, "RESULTADO %d %d %zu %zu", &status, &hit, &messages_len, &output_len) != 4) {
+        fprintf(stderr, "Resposta invalida do servidor: %s\n", line);
+        close(fd);
+        return 1;
+    }
+
+    char* messages = (char*)malloc(messages_len + 1);
+    char* code = (char*)malloc(output_len + 1);
+    if (!read_full(fd, messages, messages_len) || !read_full(fd, code, output_len)) {
+        fprintf(stderr, "Conexao com o servidor interrompida\n");
+        close(fd);
+        return 1;
+    }
+    close(fd);
+    double elapsed = now_ms() - start;
+
+    fwrite(messages, 1, messages_len, stdout);
+    if (show_time) {
+        // Ida e volta da requisição, sem a criação deste processo
+        fprintf(stderr, "Tempo de resposta: %.3f ms (%s)\n", elapsed, hit ? "cache" : "compilado");
+    }
+    if (status == 0) {
+        FILE* out = fopen(output, "wb");
+        if (out == NULL) {
+            perror("Erro ao gravar o codigo gerado");
+            status = 1;
+        } else {
+            fwrite(code, 1, output_len, out);
+            fclose(out);
+        }
+    }
+
+    free(messages);
+    free(code);
+    return status;
+}
@@ -0,0 +1,410 @@
+#define _GNU_SOURCE                 // memmem
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "server.h"
+
+// Arquivos cujo último resultado fica guardado
+#define SERVER_CACHE_MAX 1024
+
+// Prazo para o cliente enviar a requisição inteira: um cliente parado não segura os outros
+#define SERVER_REQUEST_TIMEOUT_MS 5000
+
+// Último resultado de um arquivo (identificado pelo nome enviado pelo cliente)
+typedef struct {
+    char name[256];
+    char* source;
+    size_t source_len;
+    int status;
+    char* messages;
+    size_t messages_len;
+    char* output;
+    size_t output_len;
+} CacheEntry;
+
+static CacheEntry cache[SERVER_CACHE_MAX];
+static int ncache = 0;
+static int next_victim = 0;                 // Substituição circular quando o cache enche
+
+// Estatísticas
+static long requests = 0;
+static long hits = 0;
+static double compile_ms = 0;
+static double hit_ms = 0;
+
+static double now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+
+// --- E/S no socket ---
+
+static double request_deadline = 0;         // Fim do prazo da conexão atual (now_ms)
+
+// Espera o socket ter dados para ler, até o prazo da requisição
+static int wait_readable(int fd) {
+    for (;;) {
+        int remaining = (int)(request_deadline - now_ms());
+        if (remaining <= 0) return 0;
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        int ready = poll(&pfd, 1, remaining);
+        if (ready < 0 && errno == EINTR) continue;
+        return ready > 0;
+    }
+}
+
+static int read_full(int fd, char* buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        if (!wait_readable(fd)) return 0;
+        ssize_t n = read(fd, buffer + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        done += (size_t)n;
+    }
+    return 1;
+}
+
+static int write_full(int fd, const char* buffer, size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = write(fd, buffer + done, size - done);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        done += (size_t)n;
+    }
+    return 1;
+}
+
+// Lê o cabeçalho da requisição (até '\n'), byte a byte para não consumir o fonte;
+// o prazo da requisição vale também aqui
+static int read_line(int fd, char* line, size_t size) {
+    size_t length = 0;
+    while (length + 1 < size) {
+        char c;
+        if (!read_full(fd, &c, 1)) return 0;
+        if (c == '\n') break;
+        line[length++] = c;
+    }
+    line[length] = '\0';
+    return 1;
+}
+
+// Lê um arquivo inteiro (vazio se ele não existe)
+static char* read_file(const char* path, size_t* length) {
+    *length = 0;
+    FILE* in = fopen(path, "rb");
+    char* buffer = NULL;
+    size_t capacity = 0;
+    if (in != NULL) {
+        char chunk[8192];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+            if (*length + n > capacity) {
+                capacity = (*length + n) * 2;
+                buffer = (char*)realloc(buffer, capacity);
+            }
+            memcpy(buffer + *length, chunk, n);
+            *length += n;
+        }
+        fclose(in);
+    }
+    return buffer ? buffer : (char*)calloc(1, 1);
+}
+
+
+/*
+    * Função: replace_all
+    * -------------------------------
+    * Troca cada ocorrência de 'from' por 'to' no texto. Libera o texto
+    * antigo e devolve o novo (com o tamanho em 'length').
+*/
+static char* replace_all(char* text, size_t* length, const char* from, const char* to) {
+    size_t from_len = strlen(from), to_len = strlen(to);
+    size_t count = 0;
+    for (char* p = text; (p = memmem(p, *length - (size_t)(p - text), from, from_len)) != NULL; p += from_len) count++;
+    if (count == 0) return text;
+
+    size_t new_length = *length - count * from_len + count * to_len;
+    char* result = (char*)malloc(new_length + 1);
+    char* out = result;
+    char* p = text;
+    for (char* match; (match = memmem(p, *length - (size_t)(p - text), from, from_len)) != NULL; p = match + from_len) {
+        memcpy(out, p, (size_t)(match - p));
+        out += match - p;
+        memcpy(out, to, to_len);
+        out += to_len;
+    }
+    memcpy(out, p, *length - (size_t)(p - text));
+    result[new_length] = '\0';
+    free(text);
+    *length = new_length;
+    return result;
+}
+
+
+// --- Cache ---
+
+static CacheEntry* find_entry(const char* name) {
+    for (int i = 0; i < ncache; i++) {
+        if (strcmp(cache[i].name, name) == 0) return &cache[i];
+    }
+    return NULL;
+}
+
+static void clear_entry(CacheEntry* entry) {
+    free(entry->source);
+    free(entry->messages);
+    free(entry->output);
+    memset(entry, 0, sizeof(CacheEntry));
+}
+
+// Entrada para guardar o resultado de 'name' (a antiga do mesmo nome, uma livre ou a próxima vítima)
+static CacheEntry* entry_for(const char* name) {
+    CacheEntry* entry = find_entry(name);
+    if (entry == NULL) {
+        entry = ncache < SERVER_CACHE_MAX ? &cache[ncache++] : &cache[next_victim++ % SERVER_CACHE_MAX];
+    }
+    clear_entry(entry);
+    snprintf(entry->name, sizeof(entry->name), "%s", name);
+    return entry;
+}
+
+
+// --- Compilação ---
+
+// Nome do arquivo temporário: só letras, dígitos, '_', '-' e '.' do último componente
+static void safe_name(const char* name, char* out, size_t size) {
+    const char* slash = strrchr(name, '/');
+    if (slash != NULL) name = slash + 1;
+
+    size_t length = 0;
+    for (const char* c = name; *c != '\0' && *c != '.' && length + 1 < size; c++) {
+        int ok = (*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') ||
+                 *c == '_' || *c == '-';
+        out[length++] = ok ? *c : '_';
+    }
+    out[length] = '\0';
+    if (length == 0) snprintf(out, size, "fonte");
+}
+
+/*
+    * Função: compile_request
+    * -------------------------------
+    * Grava o fonte no diretório de trabalho e o compila em um processo
+    * filho, com stdout e stderr no .log. O servidor não é afetado pelo
+    * estado global do compilador nem pelos exit() de erros no fonte.
+*/
+static void compile_request(const char* workdir, const char* output_ext, ServerCompileFn compile,
+                            const char* name, CacheEntry* entry) {
+    char stem[128], source_path[512], base[512], log_path[520], output_path[520];
+    safe_name(name, stem, sizeof(stem));
+    snprintf(source_path, sizeof(source_path), "%s/%s.g", workdir, stem);
+    snprintf(base, sizeof(base), "%s/%s", workdir, stem);
+    snprintf(log_path, sizeof(log_path), "%s.log", base);
+    snprintf(output_path, sizeof(output_path), "%s%s", base, output_ext);
+
+    entry->status = 1;
+    FILE* out = fopen(source_path, "wb");
+    if (out == NULL || fwrite(entry->source, 1, entry->source_len, out) != entry->source_len) {
+        if (out) fclose(out);
+        entry->messages = strdup("Erro no servidor: nao foi possivel gravar o fonte\n");
+        entry->messages_len = strlen(entry->messages);
+        entry->output = (char*)calloc(1, 1);
+        return;
+    }
+    fclose(out);
+
+    fflush(NULL);
+    pid_t pid = fork();
+    if (pid == 0) {
+        int fd = open(log_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd >= 0) {
+            dup2(fd, STDOUT_FILENO);
+            dup2(fd, STDERR_FILENO);
+            close(fd);
+        }
+        exit(compile(source_path, base));
+    }
+
+    int status = 1;
+    if (pid > 0) {
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+        entry->status = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+    }
+    // As mensagens citam os arquivos do diretório de trabalho: o cliente vê o nome que enviou
+    char client_base[256];
+    const char* slash = strrchr(name, '/');
+    const char* dot = strrchr(name, '.');
+    int base_len = dot != NULL && dot > (slash ? slash + 1 : name) ? (int)(dot - name) : (int)strlen(name);
+    snprintf(client_base, sizeof(client_base), "%.*s", base_len, name);
+    entry->messages = read_file(log_path, &entry->messages_len);
+    entry->messages = replace_all(entry->messages, &entry->messages_len, source_path, name);
+    entry->messages = replace_all(entry->messages, &entry->messages_len, base, client_base);
+    entry->output = entry->status == 0 ? read_file(output_path, &entry->output_len) : (char*)calloc(1, 1);
+    if (entry->status != 0) entry->output_len = 0;
+
+    // Saídas auxiliares do mesmo nome (tabela de linhas, IR) também são apagadas
+    const char* extensions[] = { ".g", ".log", ".asm", ".s", ".c", ".ir", ".linhas" };
+    for (size_t i = 0; i < sizeof(extensions) / sizeof(extensions[0]); i++) {
+        char path[530];
+        snprintf(path, sizeof(path), "%s%s", base, extensions[i]);
+        unlink(path);
+    }
+}
+
+static void handle_compile(int client, const char* header, const char* workdir, const char* output_ext,
+                           ServerCompileFn compile) {
+    char name[256];
+    long length;
+    if (sscanf(header, "COMPILA %255s %ld", name, &length) != 2 || length < 0 || length > SERVER_MAX_SOURCE) {
+        const char* reply = "ERRO requisicao invalida\n";
+        write_full(client, reply, strlen(reply));
+        return;
+    }
+
+    char* source = (char*)malloc((size_t)length + 1);
+    if (!read_full(client, source, (size_t)length)) {
+        free(source);
+        return;
+    }
+
+    double start = now_ms();
+    requests++;
+
+    // Mesmo arquivo com o mesmo texto: responde com o resultado guardado
+    CacheEntry* entry = find_entry(name);
+    int hit = entry != NULL && entry->source_len == (size_t)length && memcmp(entry->source, source, (size_t)length) == 0;
+    if (hit) {
+        free(source);
+        hits++;
+    } else {
+        entry = entry_for(name);
+        entry->source = source;
+        entry->source_len = (size_t)length;
+        compile_request(workdir, output_ext, compile, name, entry);
+    }
+
+    char reply[128];
+    int size = snprintf(reply, sizeof(reply), "RESULTADO %d %d %zu %zu\n", entry->status, hit,
+                        entry->messages_len, entry->output_len);
+    if (write_full(client, reply, (size_t)size) && write_full(client, entry->messages, entry->messages_len)) {
+        write_full(client, entry->output, entry->output_len);
+    }
+
+    double elapsed = now_ms() - start;
+    if (hit) hit_ms += elapsed;
+    else compile_ms += elapsed;
+}
+
+static void format_stats(char* out, size_t size) {
+    long compiled = requests - hits;
+    snprintf(out, size, "%ld requisicoes, %ld respondidas pelo cache (%.1f%%), %d arquivos guardados; "
+                        "compilacao media %.2f ms, resposta do cache media %.3f ms\n",
+             requests, hits, requests > 0 ? 100.0 * hits / requests : 0.0, ncache,
+             compiled > 0 ? compile_ms / compiled : 0.0, hits > 0 ? hit_ms / hits : 0.0);
+}
+
+int run_server(const char* socket_path, const char* output_ext, ServerCompileFn compile) {
+    signal(SIGPIPE, SIG_IGN);               // Cliente que fecha a conexão antes da resposta
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(address.sun_path)) {
+        fprintf(stderr, "Caminho do socket muito longo: %s\n", socket_path);
+        return 1;
+    }
+    strcpy(address.sun_path, socket_path);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        perror("Erro ao criar o socket do servidor");
+        return 1;
+    }
+    // Um servidor que ainda responde no caminho não é substituído; só o socket
+    // deixado por um servidor que terminou (conexão recusada) é apagado
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe >= 0) {
+        int connected = connect(probe, (struct sockaddr*)&address, sizeof(address)) == 0;
+        int refused = !connected && errno == ECONNREFUSED;
+        close(probe);
+        if (connected) {
+            fprintf(stderr, "Ja existe um servidor de compilacao ouvindo em %s\n", socket_path);
+            close(listener);
+            return 1;
+        }
+        if (refused) unlink(socket_path);
+    }
+    if (bind(listener, (struct sockaddr*)&address, sizeof(address)) < 0 || listen(listener, 64) < 0) {
+        perror("Erro ao abrir o socket do servidor");
+        close(listener);
+        return 1;
+    }
+
+    char workdir[] = "/tmp/goianinha-servidor-XXXXXX";
+    if (mkdtemp(workdir) == NULL) {
+        perror("Erro ao criar o diretorio de trabalho do servidor");
+        close(listener);
+        unlink(socket_path);
+        return 1;
+    }
+
+    printf("Servidor de compilacao ouvindo em %s\n", socket_path);
+    fflush(stdout);
+
+    int running = 1;
+    while (running) {
+        int client = accept(listener, NULL, NULL);
+        if (client < 0) {
+            if (errno == EINTR) continue;
+            perror("Erro ao aceitar conexao");
+            break;
+        }
+
+        // Escritas também têm prazo: um cliente que não lê a resposta não trava o servidor
+        struct timeval timeout = { SERVER_REQUEST_TIMEOUT_MS / 1000, 0 };
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        request_deadline = now_ms() + SERVER_REQUEST_TIMEOUT_MS;
+
+        char header[512];
+        if (read_line(client, header, sizeof(header))) {
+            if (strncmp(header, "COMPILA ", 8) == 0) {
+                handle_compile(client, header, workdir, output_ext, compile);
+            } else if (strcmp(header, "ESTADO") == 0) {
+                char stats[512];
+                format_stats(stats, sizeof(stats));
+                write_full(client, stats, strlen(stats));
+            } else if (strcmp(header, "PARA") == 0) {
+                write_full(client, "OK\n", 3);
+                running = 0;
+            } else {
+                const char* reply = "ERRO comando desconhecido\n";
+                write_full(client, reply, strlen(reply));
+            }
+        }
+        close(client);
+    }
+
+    char stats[512];
+    format_stats(stats, sizeof(stats));
+    printf("Servidor encerrado: %s", stats);
+
+    close(listener);
+    unlink(socket_path);
+    rmdir(workdir);
+    for (int i = 0; i < ncache; i++) clear_entry(&cache[i]);
+    ncache = 0;
+    return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stddef.h>
+
+// Servidor de compilação (--server): um processo que fica carregado e recebe
+// programas por um socket Unix, devolvendo as mensagens da compilação e o
+// código gerado. Usado pelo cliente goianinha-cliente (Servidor/client.c).
+//
+// Protocolo (uma requisição por conexão):
+//   "COMPILA <nome> <bytes>\n" seguido do fonte
+//       -> "RESULTADO <status> <cache> <bytes_mensagens> <bytes_codigo>\n" + mensagens + código
+//   "ESTADO\n" -> uma linha com as estatísticas do servidor
+//   "PARA\n"   -> "OK\n" e o servidor termina
+
+#define SERVER_DEFAULT_SOCKET "/tmp/goianinha.sock"
+#define SERVER_MAX_SOURCE     (16 << 20)     // Maior fonte aceito (16 MB)
+
+/**
+ * Função que compila um arquivo fonte gravando as saídas em 'base' + extensão
+ * (compile_file de main.c). Retorna 0 em caso de sucesso.
+ */
+typedef int (*ServerCompileFn)(const char* source_file, const char* base);
+
+/**
+ * Atende requisições até receber "PARA". Cada compilação roda em um processo
+ * filho do servidor (estado isolado, sem carregar o executável de novo) e o
+ * resultado fica guardado por arquivo: o mesmo nome com o mesmo texto é
+ * respondido sem compilar.
+ * @param socket_path Caminho do socket Unix.
+ * @param output_ext Extensão do código gerado (".asm", ".s" ou ".c").
+ * @return 0 quando o servidor termina normalmente, 1 em caso de erro.
+ */
+int run_server(const char* socket_path, const char* output_ext, ServerCompileFn compile);
+
+#endif // SERVER_H
@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "goianinha.h"
+
+// Teste da libgoianinha (usado por teste_execucao.sh): compila em memória um
+// programa correto e compara com a saída do executável, confere que um
+// programa com erro volta como GN_ERRO_FONTE sem encerrar o processo e
+// compila o programa correto de novo (o estado global precisa ser reiniciado).
+// Uso: teste_biblioteca <correto.g> <saida_do_executavel.asm> <errado.g>
+
+static char* read_file(const char* path, size_t* length) {
+    FILE* in = fopen(path, "rb");
+    if (in == NULL) {
+        perror(path);
+        exit(2);
+    }
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    rewind(in);
+    char* data = (char*)malloc((size_t)size + 1);
+    *length = fread(data, 1, (size_t)size, in);
+    data[*length] = '\0';
+    fclose(in);
+    return data;
+}
+
+// Compila 'source' e confere o resultado com o código esperado (ou com o status de erro)
+static int check(const char* label, const char* source, size_t length, const char* expected, size_t expected_len,
+                 gn_status expected_status) {
+    gn_result result;
+    gn_status status = gn_compile(source, length, NULL, &result);
+    int ok = status == expected_status && result.status == status;
+    if (ok && status == GN_OK) {
+        ok = result.output_len == expected_len && memcmp(result.output, expected, expected_len) == 0;
+    }
+    if (ok && status == GN_ERRO_FONTE) {
+        ok = result.output == NULL && strstr(result.messages, "linha") != NULL;
+    }
+    if (!ok) {
+        printf("%s: status %d\n", label, status);
+        fputs(result.messages ? result.messages : "", stdout);
+    }
+    gn_result_free(&result);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 4) {
+        fprintf(stderr, "Uso: %s <correto.g> <saida_do_executavel.asm> <errado.g>\n", argv[0]);
+        return 2;
+    }
+    size_t source_len, expected_len, wrong_len;
+    char* source = read_file(argv[1], &source_len);
+    char* expected = read_file(argv[2], &expected_len);
+    char* wrong = read_file(argv[3], &wrong_len);
+
+    int ok = check("programa correto igual ao executavel", source, source_len, expected, expected_len, GN_OK);
+    ok &= check("programa com erro devolve GN_ERRO_FONTE", wrong, wrong_len, NULL, 0, GN_ERRO_FONTE);
+    ok &= check("programa correto depois do erro", source, source_len, expected, expected_len, GN_OK);
+
+    free(source);
+    free(expected);
+    free(wrong);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+/* Operadores inteiros, precedência e os casos de borda da divisão:
+   truncamento em direção a zero e INT_MIN / -1 (dá INT_MIN). */
+int a, b;
+programa {
+    int x, y;
+    leia a;
+    leia b;
+    x = a * 3 + b * 2 - 1;
+    escreva x;
+    novalinha;
+    y = -a / 4;
+    escreva y;
+    novalinha;
+    escreva (a - 2 * a) / 4 * 4 + 7 / 2;
+    novalinha;
+    leia x;
+    leia y;
+    escreva (x - 1) / y;
+    novalinha;
+    escreva 100 / y;
+    novalinha;
+    se (x < 0 e y < 0) entao escreva "negativos";
+    novalinha;
+}
@@ -0,0 +1,17 @@
+/* Divisão por zero cujo resultado nunca é lido: a eliminação de código morto
+   não pode removê-la, nem depois de expandir a chamada que descarta o
+   argumento. A execução termina com erro (código 1) depois do que já foi escrito. */
+int primeiro(int a, int b) {
+    retorne a;
+}
+
+programa {
+    int b, x;
+    leia b;
+    escreva primeiro(3, 7 / 2);
+    novalinha;
+    escreva primeiro(1, 7 / b);
+    novalinha;
+    x = 7 / b;
+    escreva "nao deveria chegar aqui";
+}
@@ -0,0 +1,16 @@
+/* Divisão por zero em tempo de execução: o que já foi escrito aparece e a
+   execução termina com erro (código 1), sem derrubar o compilador. */
+int divide(int a, int b) {
+    retorne a / b;
+}
+
+programa {
+    int a, b;
+    a = 7;
+    leia b;
+    escreva divide(a, 2);
+    novalinha;
+    escreva divide(a, b);
+    novalinha;
+    escreva "nao deveria chegar aqui";
+}
@@ -0,0 +1,42 @@
+/* Chamadas recursivas, variáveis globais, laços e escrita de cadeias e caracteres. */
+int soma;
+car letra;
+
+int fatorial(int n) {
+    se (n == 0) entao
+        retorne 1;
+    senao
+        retorne n * fatorial(n - 1);
+}
+
+int fibonacci(int n) {
+    se (n < 2) entao
+        retorne n;
+    senao
+        retorne fibonacci(n - 1) + fibonacci(n - 2);
+}
+
+int muitos(int p1, int p2, int p3, int p4, int p5, int p6, int p7, int p8) {
+    retorne p1 - p2 + p3 - p4 + p5 - p6 + p7 - p8 * 2;
+}
+
+programa {
+    int i;
+    i = 0;
+    soma = 0;
+    enquanto (i <= 10) execute {
+        soma = soma + fatorial(i) / (i + 1);
+        i = i + 1;
+    }
+    escreva "soma: ";
+    escreva soma;
+    novalinha;
+    escreva "fib(20) = ";
+    escreva fibonacci(20);
+    novalinha;
+    escreva muitos(1, 2, 3, 4, 5, 6, 7, 8);
+    novalinha;
+    letra = 'g';
+    escreva letra;
+    novalinha;
+}
@@ -1,4 +1,5 @@
 #include "symbolTable.h"
+#include "./../Relatorio/time_report.h"
 #include <algorithm>
 #include <memory>
 #include <string>
@@ -25,6 +26,7 @@ void symtab_destroy(SymbolTableRef table) {
 void symtab_enter_scope(SymbolTableRef table) {
     SymbolTable* sym_table = GET_SYMTAB(table);
     sym_table->enterScope(); 
+    time_counters.scopes++;
 }
 
 void symtab_exit_scope(SymbolTableRef table) {
@@ -59,6 +61,7 @@ int symtab_insert_func(SymbolTableRef table, const char* name, int num_params, i
 SymbolRef symtab_lookup(SymbolTableRef table, const char* name) {
     SymbolTable* sym_table = GET_SYMTAB(table);
     std::string lookup_name(SAFE_STRING(name));
+    time_counters.symbol_lookups++;
 
     auto symbol_ptr = sym_table->lookup(lookup_name);
 
@@ -99,6 +102,7 @@ int sym_get_data_type(SymbolRef symbol) {
 SymbolRef symtab_lookup_current_scope(SymbolTableRef table, const char* name) {
     SymbolTable* sym_table = GET_SYMTAB(table);
     std::string lookup_name(SAFE_STRING(name));
+    time_counters.symbol_lookups++;
 
     auto symbol_ptr = sym_table->lookupCurrentScope(lookup_name);
 
@@ -0,0 +1,53 @@
+#!/bin/bash
+
+# Compara o tempo de compilar sem cache, com o cache vazio (falha: compila e
+# guarda a entrada) e com o cache já preenchido (acerto: só copia as saídas).
+# Uso: ./bench_cache.sh [-n repeticoes] [arquivos .g]   (sem arquivos, usa TESTES/Corretos)
+
+# Definindo o executável
+EXECUTABLE="./goianinha"
+
+REPEAT=20
+if [ "$1" == "-n" ]; then
+    REPEAT="$2"
+    shift 2
+fi
+FILES=("$@")
+if [ ${#FILES[@]} -eq 0 ]; then
+    FILES=(TESTES/Corretos/*.g)
+fi
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# Média, em milissegundos, do tempo de parede de REPEAT compilações do arquivo
+# (o primeiro argumento é chamado antes de cada compilação)
+average_ms() {
+    local prepare=$1 start end total=0
+    shift
+    for _ in $(seq "$REPEAT"); do
+        $prepare
+        start=$(date +%s%N)
+        $EXECUTABLE -o "$WORK/saida" "$@" > /dev/null 2>&1
+        end=$(date +%s%N)
+        total=$((total + end - start))
+    done
+    awk -v t="$total" -v n="$REPEAT" 'BEGIN { printf "%.2f", t / n / 1000000 }'
+}
+
+clear_cache() { rm -rf "$WORK/vazio"; }
+keep_cache() { :; }
+
+printf "%-42s %14s %14s %14s %8s\n" "Programa" "Sem cache (ms)" "Falha (ms)" "Acerto (ms)" "Ganho"
+for file in "${FILES[@]}"; do
+    name=$(basename "$file" .g)
+    plain_ms=$(average_ms keep_cache "$file")
+    miss_ms=$(average_ms clear_cache --cache-dir="$WORK/vazio" "$file")
+    $EXECUTABLE -o "$WORK/saida" --cache-dir="$WORK/cache" "$file" > /dev/null 2>&1
+    hit_ms=$(average_ms keep_cache --cache-dir="$WORK/cache" "$file")
+    gain=$(awk -v a="$plain_ms" -v b="$hit_ms" 'BEGIN { if (b > 0) printf "%.1fx", a / b; else print "-" }')
+    printf "%-42s %14s %14s %14s %8s\n" "$name" "$plain_ms" "$miss_ms" "$hit_ms" "$gain"
+done
+
+echo
+$EXECUTABLE --cache-dir="$WORK/cache" --cache-stats
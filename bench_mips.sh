@@ -0,0 +1,56 @@
+#!/bin/bash
+
+# Mede o código MIPS gerado para os programas de TESTES/Corretos no emulador embutido (--emulate).
+# Uso: ./bench_mips.sh [-b tabela_anterior] [opcoes do compilador...]
+#   Salve a tabela (./bench_mips.sh > antes.txt), mude o gerador de código e rode
+#   ./bench_mips.sh -b antes.txt para ver a variação de ciclos de cada programa.
+
+# Definindo o executável do compilador
+EXECUTABLE="./goianinha"
+
+# Entrada dada aos programas que usam leia
+declare -A INPUTS=(
+    [FibEfatCorretoVersao2]="5"
+    [NotaEmConceito]="7"
+    [SeqOrdenada]="3 1 2 3 2 5 1 0"
+    [fatorialCorreto]="0"
+)
+
+BASE=""
+if [ "$1" == "-b" ]; then
+    BASE="$2"
+    shift 2
+fi
+FLAGS=("$@")
+
+printf "%-42s %10s %8s %8s %8s %10s %8s\n" "Programa" "Instrucoes" "Loads" "Stores" "Desvios" "Ciclos" "Variacao"
+total_before=0
+total_after=0
+for file in TESTES/Corretos/*.g; do
+    name=$(basename "$file" .g)
+    input="${INPUTS[$name]}"
+
+    # Estatísticas do emulador (duas últimas linhas de stderr)
+    report=$(echo "$input" | $EXECUTABLE "${FLAGS[@]}" --emulate "$file" 2>&1 >/dev/null | tail -2)
+    count=$(echo "$report" | sed -n 's/^Emulador MIPS: \([0-9]*\) instrucoes.*/\1/p')
+    loads=$(echo "$report" | sed -n 's/.*(\([0-9]*\) loads.*/\1/p')
+    stores=$(echo "$report" | sed -n 's/.* \([0-9]*\) stores.*/\1/p')
+    branches=$(echo "$report" | sed -n 's/.* \([0-9]*\) desvios,.*/\1/p')
+    cycles=$(echo "$report" | sed -n 's/^Ciclos estimados: \([0-9]*\).*/\1/p')
+
+    change="-"
+    if [ -n "$BASE" ] && [ -n "$cycles" ]; then
+        before=$(awk -v n="$name" '$1 == n { print $6 }' "$BASE")
+        if [ -n "$before" ] && [ "$before" != "-" ] && [ "$before" -gt 0 ]; then
+            change=$(awk -v a="$before" -v b="$cycles" 'BEGIN { printf "%+.1f%%", (b - a) * 100 / a }')
+            total_before=$((total_before + before))
+            total_after=$((total_after + cycles))
+        fi
+    fi
+
+    printf "%-42s %10s %8s %8s %8s %10s %8s\n" "$name" "${count:--}" "${loads:--}" "${stores:--}" "${branches:--}" "${cycles:--}" "$change"
+done
+
+if [ $total_before -gt 0 ]; then
+    awk -v a="$total_before" -v b="$total_after" 'BEGIN { printf "\nTotal: %d -> %d ciclos (%+.1f%%)\n", a, b, (b - a) * 100 / a }'
+fi
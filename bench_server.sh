@@ -0,0 +1,82 @@
+#!/bin/bash
+
+# Compara a latência de compilar com um processo novo a cada arquivo (frio) e
+# pelo servidor de compilação já carregado (goianinha --server + goianinha-cliente).
+# Uso: ./bench_server.sh [-n repeticoes] [arquivos .g]   (sem arquivos, usa TESTES/Corretos)
+#   "frio" é o tempo de parede de ./goianinha arquivo.g;
+#   "servidor" é o tempo de resposta medido pelo cliente (-t), com o texto mudando
+#   a cada repetição para forçar a compilação; "cache" reenvia o mesmo texto;
+#   "cliente" soma a criação do processo do cliente ao tempo do servidor.
+
+# Definindo os executáveis
+EXECUTABLE="./goianinha"
+CLIENT="./goianinha-cliente"
+
+REPEAT=20
+if [ "$1" == "-n" ]; then
+    REPEAT="$2"
+    shift 2
+fi
+FILES=("$@")
+if [ ${#FILES[@]} -eq 0 ]; then
+    FILES=(TESTES/Corretos/*.g)
+fi
+
+WORK=$(mktemp -d)
+SOCKET="$WORK/servidor.sock"
+$EXECUTABLE --server="$SOCKET" > "$WORK/servidor.log" 2>&1 &
+SERVER_PID=$!
+trap 'kill $SERVER_PID 2>/dev/null; rm -rf "$WORK"' EXIT
+for _ in $(seq 50); do
+    [ -S "$SOCKET" ] && break
+    sleep 0.1
+done
+
+# Média, em milissegundos, do tempo de parede de um comando repetido para cada arquivo da lista
+average_ms() {
+    local start end
+    start=$(date +%s%N)
+    for item in "${@:2}"; do
+        $1 "$item" > /dev/null 2>&1
+    done
+    end=$(date +%s%N)
+    awk -v t=$((end - start)) -v n=$(($# - 1)) 'BEGIN { printf "%.2f", t / n / 1000000 }'
+}
+
+# Média dos tempos de resposta informados pelo cliente
+average_response_ms() {
+    for item in "$@"; do
+        $CLIENT -s "$SOCKET" -t -o "$WORK/saida.asm" "$item" 2>&1 >/dev/null
+    done | awk '/Tempo de resposta/ { t += $4; n++ } END { if (n) printf "%.3f", t / n; else print "-" }'
+}
+
+cold() { $EXECUTABLE -o "$WORK/saida" "$1"; }
+warm() { $CLIENT -s "$SOCKET" -o "$WORK/saida.asm" "$1"; }
+
+printf "%-42s %10s %14s %12s %12s %8s\n" "Programa" "Frio (ms)" "Servidor (ms)" "Cache (ms)" "Cliente (ms)" "Ganho"
+for file in "${FILES[@]}"; do
+    name=$(basename "$file" .g)
+
+    # Variações do fonte (um comentário diferente em cada) para forçar compilações
+    variants=()
+    for i in $(seq "$REPEAT"); do
+        mkdir -p "$WORK/v$i"
+        { cat "$file"; echo "/* variacao $i */"; } > "$WORK/v$i/$name.g"
+        variants+=("$WORK/v$i/$name.g")
+    done
+    same=()
+    for i in $(seq "$REPEAT"); do same+=("$file"); done
+
+    cold_ms=$(average_ms cold "${variants[@]}")
+    warm_ms=$(average_response_ms "${variants[@]}")
+    hit_ms=$(average_response_ms "${same[@]}")
+    for i in $(seq "$REPEAT"); do echo "/* cliente $i */" >> "${variants[$((i - 1))]}"; done
+    client_ms=$(average_ms warm "${variants[@]}")
+    gain=$(awk -v a="$cold_ms" -v b="$warm_ms" 'BEGIN { if (b > 0) printf "%.1fx", a / b; else print "-" }')
+
+    printf "%-42s %10s %14s %12s %12s %8s\n" "$name" "$cold_ms" "$warm_ms" "$hit_ms" "$client_ms" "$gain"
+done
+
+echo
+$CLIENT -s "$SOCKET" --estado
+$CLIENT -s "$SOCKET" --parar > /dev/null
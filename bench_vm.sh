@@ -0,0 +1,56 @@
+#!/bin/bash
+
+# Compara a máquina virtual embutida (--run) com o SPIM nos programas de TESTES/Corretos.
+# Uso: ./bench_vm.sh [arquivos .g]   (sem argumentos, usa TESTES/Corretos)
+
+# Definindo o executável do compilador
+EXECUTABLE="./goianinha"
+
+# Entrada dada aos programas que usam leia
+declare -A INPUTS=(
+    [FibEfatCorretoVersao2]="5"
+    [NotaEmConceito]="7"
+    [SeqOrdenada]="3 1 2 3 2 5 1 0"
+    [fatorialCorreto]="0"
+)
+
+FILES=("$@")
+if [ ${#FILES[@]} -eq 0 ]; then
+    FILES=(TESTES/Corretos/*.g)
+fi
+
+# Tempo de parede de um comando, em milissegundos
+elapsed_ms() {
+    local start end
+    start=$(date +%s%N)
+    "$@" > /dev/null 2>&1
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000000 ))
+}
+
+HAVE_SPIM=0
+command -v spim > /dev/null && HAVE_SPIM=1
+
+printf "%-42s %12s %12s %14s %12s\n" "Programa" "Instrucoes" "VM (ms)" "VM (Minstr/s)" "SPIM (ms)"
+for file in "${FILES[@]}"; do
+    name=$(basename "$file" .g)
+    input="${INPUTS[$name]}"
+
+    # Relatório da máquina virtual (última linha de stderr)
+    report=$(echo "$input" | $EXECUTABLE --run "$file" 2>&1 >/dev/null | tail -1)
+    count=$(echo "$report" | sed -n 's/.*: \([0-9]*\) instrucoes.*/\1/p')
+    vm_ms=$(echo "$report" | sed -n 's/.* em \([0-9.]*\) ms.*/\1/p')
+    rate=$(echo "$report" | sed -n 's/.*(\([0-9.]*\) milhoes\/s).*/\1/p')
+
+    spim_ms="-"
+    if [ $HAVE_SPIM -eq 1 ]; then
+        $EXECUTABLE "$file" > /dev/null 2>&1
+        spim_ms=$(echo "$input" | elapsed_ms spim -file output.asm)
+    fi
+
+    printf "%-42s %12s %12s %14s %12s\n" "$name" "${count:--}" "${vm_ms:--}" "${rate:--}" "$spim_ms"
+done
+
+if [ $HAVE_SPIM -eq 0 ]; then
+    echo -e "\nSPIM nao encontrado no PATH: apenas a maquina virtual foi medida."
+fi
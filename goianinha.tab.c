@@ -0,0 +1,2075 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "./Analise_Sintatica/goianinha.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "./AST/ast.h"
+
+extern int yylex(void);
+
+// Declarações externas do analisador léxico
+extern int yylineno;
+
+// Função para reportar erros
+void yyerror(const char *s);
+
+
+#line 87 "goianinha.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "goianinha.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ID = 3,                         /* ID  */
+  YYSYMBOL_INTCONST = 4,                   /* INTCONST  */
+  YYSYMBOL_CARCONST = 5,                   /* CARCONST  */
+  YYSYMBOL_CADEIA_CARACTERES = 6,          /* CADEIA_CARACTERES  */
+  YYSYMBOL_PROGRAMA = 7,                   /* PROGRAMA  */
+  YYSYMBOL_CAR = 8,                        /* CAR  */
+  YYSYMBOL_INT = 9,                        /* INT  */
+  YYSYMBOL_RETORNE = 10,                   /* RETORNE  */
+  YYSYMBOL_LEIA = 11,                      /* LEIA  */
+  YYSYMBOL_ESCREVA = 12,                   /* ESCREVA  */
+  YYSYMBOL_NOVALINHA = 13,                 /* NOVALINHA  */
+  YYSYMBOL_SE = 14,                        /* SE  */
+  YYSYMBOL_ENTAO = 15,                     /* ENTAO  */
+  YYSYMBOL_SENAO = 16,                     /* SENAO  */
+  YYSYMBOL_ENQUANTO = 17,                  /* ENQUANTO  */
+  YYSYMBOL_EXECUTE = 18,                   /* EXECUTE  */
+  YYSYMBOL_VIRGULA = 19,                   /* VIRGULA  */
+  YYSYMBOL_PONTO_VIRGULA = 20,             /* PONTO_VIRGULA  */
+  YYSYMBOL_ABRE_PAR = 21,                  /* ABRE_PAR  */
+  YYSYMBOL_FECHA_PAR = 22,                 /* FECHA_PAR  */
+  YYSYMBOL_ABRE_CHAVE = 23,                /* ABRE_CHAVE  */
+  YYSYMBOL_FECHA_CHAVE = 24,               /* FECHA_CHAVE  */
+  YYSYMBOL_ATRIBUICAO = 25,                /* ATRIBUICAO  */
+  YYSYMBOL_IGUAL = 26,                     /* IGUAL  */
+  YYSYMBOL_DIFERENTE = 27,                 /* DIFERENTE  */
+  YYSYMBOL_MENOR = 28,                     /* MENOR  */
+  YYSYMBOL_MAIOR = 29,                     /* MAIOR  */
+  YYSYMBOL_MENOR_IGUAL = 30,               /* MENOR_IGUAL  */
+  YYSYMBOL_MAIOR_IGUAL = 31,               /* MAIOR_IGUAL  */
+  YYSYMBOL_MAIS = 32,                      /* MAIS  */
+  YYSYMBOL_MENOS = 33,                     /* MENOS  */
+  YYSYMBOL_MULT = 34,                      /* MULT  */
+  YYSYMBOL_DIV = 35,                       /* DIV  */
+  YYSYMBOL_NOT = 36,                       /* NOT  */
+  YYSYMBOL_OU = 37,                        /* OU  */
+  YYSYMBOL_E = 38,                         /* E  */
+  YYSYMBOL_YYACCEPT = 39,                  /* $accept  */
+  YYSYMBOL_Programa = 40,                  /* Programa  */
+  YYSYMBOL_DeclFuncVar = 41,               /* DeclFuncVar  */
+  YYSYMBOL_DeclProg = 42,                  /* DeclProg  */
+  YYSYMBOL_DeclVar = 43,                   /* DeclVar  */
+  YYSYMBOL_DeclFunc = 44,                  /* DeclFunc  */
+  YYSYMBOL_ListaParametros = 45,           /* ListaParametros  */
+  YYSYMBOL_ListaParametrosCont = 46,       /* ListaParametrosCont  */
+  YYSYMBOL_Bloco = 47,                     /* Bloco  */
+  YYSYMBOL_ListaDeclVar = 48,              /* ListaDeclVar  */
+  YYSYMBOL_Tipo = 49,                      /* Tipo  */
+  YYSYMBOL_ListaComando = 50,              /* ListaComando  */
+  YYSYMBOL_Comando = 51,                   /* Comando  */
+  YYSYMBOL_Expr = 52,                      /* Expr  */
+  YYSYMBOL_OrExpr = 53,                    /* OrExpr  */
+  YYSYMBOL_AndExpr = 54,                   /* AndExpr  */
+  YYSYMBOL_EqExpr = 55,                    /* EqExpr  */
+  YYSYMBOL_DesigExpr = 56,                 /* DesigExpr  */
+  YYSYMBOL_AddExpr = 57,                   /* AddExpr  */
+  YYSYMBOL_MulExpr = 58,                   /* MulExpr  */
+  YYSYMBOL_UnExpr = 59,                    /* UnExpr  */
+  YYSYMBOL_PrimExpr = 60,                  /* PrimExpr  */
+  YYSYMBOL_ListExpr = 61                   /* ListExpr  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  6
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   132
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  39
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  23
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  62
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  122
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   293
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    40,    40,    53,    92,   105,   107,   110,   118,   120,
+     130,   131,   134,   143,   157,   169,   170,   210,   212,   215,
+     217,   223,   225,   227,   232,   237,   242,   247,   249,   256,
+     264,   270,   273,   275,   285,   287,   290,   292,   295,   297,
+     299,   302,   304,   306,   308,   310,   313,   315,   317,   320,
+     322,   324,   327,   329,   331,   335,   342,   349,   351,   353,
+     355,   359,   361
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "ID", "INTCONST",
+  "CARCONST", "CADEIA_CARACTERES", "PROGRAMA", "CAR", "INT", "RETORNE",
+  "LEIA", "ESCREVA", "NOVALINHA", "SE", "ENTAO", "SENAO", "ENQUANTO",
+  "EXECUTE", "VIRGULA", "PONTO_VIRGULA", "ABRE_PAR", "FECHA_PAR",
+  "ABRE_CHAVE", "FECHA_CHAVE", "ATRIBUICAO", "IGUAL", "DIFERENTE", "MENOR",
+  "MAIOR", "MENOR_IGUAL", "MAIOR_IGUAL", "MAIS", "MENOS", "MULT", "DIV",
+  "NOT", "OU", "E", "$accept", "Programa", "DeclFuncVar", "DeclProg",
+  "DeclVar", "DeclFunc", "ListaParametros", "ListaParametrosCont", "Bloco",
+  "ListaDeclVar", "Tipo", "ListaComando", "Comando", "Expr", "OrExpr",
+  "AndExpr", "EqExpr", "DesigExpr", "AddExpr", "MulExpr", "UnExpr",
+  "PrimExpr", "ListExpr", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-97)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
+{
+      57,   -97,   -97,     8,    11,    64,   -97,    39,   -97,    27,
+      57,   -97,    67,    57,    53,    57,     2,    72,    65,    70,
+     -97,    92,    57,   -97,    22,   -97,   -97,    23,   100,    28,
+      84,    86,    87,   -97,    23,    50,    50,   -97,    85,     2,
+      90,    74,    75,    55,    48,    58,    59,   -97,   -97,    65,
+     -97,    39,    93,   -97,    36,    23,    94,    95,    96,    97,
+     -97,    23,    23,    98,   101,   -97,   -97,   -97,   -97,   -97,
+      47,    47,    47,    47,    47,    47,    47,    47,    47,    47,
+      47,    47,    99,   -97,    57,   -97,   -97,    41,   -97,   -97,
+     -97,   -97,   -97,   102,   103,   -97,    75,    55,    48,    48,
+      58,    58,    58,    58,    59,    59,   -97,   -97,    57,   -97,
+      23,   -97,   106,   105,   -97,   -97,     2,     2,   110,   -97,
+       2,   -97
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       5,    18,    17,     0,     0,     0,     1,     0,     2,     8,
+      15,     6,     0,    10,     0,     5,     0,     0,     8,     0,
+      11,     0,     5,     4,    57,    59,    58,     0,     0,     0,
+       0,     0,     0,    21,     0,     0,     0,    31,     0,    19,
+       0,    32,    35,    37,    40,    45,    48,    51,    54,     8,
+       7,     0,    12,     3,     0,     0,     0,     0,     0,     0,
+      27,     0,     0,     0,    57,    52,    53,    14,    20,    22,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     9,     0,    56,    61,     0,    33,    23,
+      24,    26,    25,     0,     0,    60,    34,    36,    38,    39,
+      41,    42,    43,    44,    46,    47,    49,    50,    15,    13,
+       0,    55,     0,     0,    16,    62,     0,     0,    28,    30,
+       0,    29
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -97,   -97,    -5,   -97,    -7,   -97,   -97,    34,    -6,    19,
+     -10,    89,   -96,   -25,   -97,    60,    61,    24,    12,    21,
+      25,    66,   -97
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     3,     4,     8,    14,    15,    19,    20,    37,    16,
+       5,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    87
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      17,    11,    56,    21,    59,    24,    25,    26,     6,    63,
+      23,    50,    27,    28,    29,    30,    31,    53,     7,    32,
+     118,   119,    33,    34,   121,    10,    24,    25,    26,    86,
+      88,    24,    25,    26,    58,    35,    93,    94,    36,    24,
+      25,    26,    82,    54,    34,    83,    12,    55,    13,    34,
+      64,    25,    26,    64,    25,    26,    35,    34,    85,    36,
+     110,    35,    10,   111,    36,     1,     2,     9,    34,    35,
+      18,    34,    36,    22,    21,    49,    74,    75,    76,    77,
+      35,    72,    73,    36,    12,   115,   100,   101,   102,   103,
+      78,    79,    51,    80,    81,    52,    98,    99,    17,   104,
+     105,    65,    66,    57,    60,   106,   107,    61,    62,    67,
+      69,    70,    84,    71,    89,    90,    91,    92,   109,   108,
+      95,   116,    54,   117,   112,   113,   120,   114,    68,     0,
+      96,     0,    97
+};
+
+static const yytype_int8 yycheck[] =
+{
+      10,     7,    27,    13,    29,     3,     4,     5,     0,    34,
+      15,    18,    10,    11,    12,    13,    14,    22,     7,    17,
+     116,   117,    20,    21,   120,    23,     3,     4,     5,    54,
+      55,     3,     4,     5,     6,    33,    61,    62,    36,     3,
+       4,     5,    49,    21,    21,    51,    19,    25,    21,    21,
+       3,     4,     5,     3,     4,     5,    33,    21,    22,    36,
+      19,    33,    23,    22,    36,     8,     9,     3,    21,    33,
+       3,    21,    36,    20,    84,     3,    28,    29,    30,    31,
+      33,    26,    27,    36,    19,   110,    74,    75,    76,    77,
+      32,    33,    22,    34,    35,     3,    72,    73,   108,    78,
+      79,    35,    36,     3,    20,    80,    81,    21,    21,    24,
+      20,    37,    19,    38,    20,    20,    20,    20,    84,    20,
+      22,    15,    21,    18,    22,    22,    16,   108,    39,    -1,
+      70,    -1,    71
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     8,     9,    40,    41,    49,     0,     7,    42,     3,
+      23,    47,    19,    21,    43,    44,    48,    49,     3,    45,
+      46,    49,    20,    41,     3,     4,     5,    10,    11,    12,
+      13,    14,    17,    20,    21,    33,    36,    47,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,     3,
+      43,    22,     3,    41,    21,    25,    52,     3,     6,    52,
+      20,    21,    21,    52,     3,    60,    60,    24,    50,    20,
+      37,    38,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    43,    47,    19,    22,    52,    61,    52,    20,
+      20,    20,    20,    52,    52,    22,    54,    55,    56,    56,
+      57,    57,    57,    57,    58,    58,    59,    59,    20,    46,
+      19,    22,    22,    22,    48,    52,    15,    18,    51,    51,
+      16,    51
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    39,    40,    41,    41,    41,    42,    43,    43,    44,
+      45,    45,    46,    46,    47,    48,    48,    49,    49,    50,
+      50,    51,    51,    51,    51,    51,    51,    51,    51,    51,
+      51,    51,    52,    52,    53,    53,    54,    54,    55,    55,
+      55,    56,    56,    56,    56,    56,    57,    57,    57,    58,
+      58,    58,    59,    59,    59,    60,    60,    60,    60,    60,
+      60,    61,    61
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     2,     5,     4,     0,     2,     3,     0,     4,
+       0,     1,     2,     4,     4,     0,     5,     1,     1,     1,
+       2,     1,     2,     3,     3,     3,     3,     2,     6,     8,
+       6,     1,     1,     3,     3,     1,     3,     1,     3,     3,
+       1,     3,     3,     3,     3,     1,     3,     3,     1,     3,
+       3,     1,     2,     2,     1,     4,     3,     1,     1,     1,
+       3,     1,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Location data for the lookahead symbol.  */
+YYLTYPE yylloc
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* Programa: DeclFuncVar DeclProg  */
+#line 41 "./Analise_Sintatica/goianinha.y"
+    {
+        // Nó raiz do programa. 
+        // Child1: Lista de declarações. 
+        // Child2: Programa principal.
+
+        (yyval.node) = new_ast_node(AST_PROGRAMA, (yylsp[0]).first_line);
+        (yyval.node)->child1 = (yyvsp[-1].node);
+        (yyval.node)->child2 = (yyvsp[0].node);
+        root_ast = (yyval.node); // Define a raiz global
+    }
+#line 1343 "goianinha.tab.c"
+    break;
+
+  case 3: /* DeclFuncVar: Tipo ID DeclVar PONTO_VIRGULA DeclFuncVar  */
+#line 54 "./Analise_Sintatica/goianinha.y"
+    {
+        // Tipo
+        AST_Node* type_node = (yyvsp[-4].node);
+
+        // Lista de IDs adicionais
+        AST_Node* id_list = (yyvsp[-2].node); 
+        
+        // Cria o nó para a PRIMEIRA variável
+        AST_Node* head = new_ast_node(AST_DECL_VAR, (yylsp[-4]).first_line);
+        head->child1 = type_node;
+        head->child2 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-3].text), (yylsp[-3]).first_line);
+        
+        // Itera sobre a lista de IDs restantes e cria um nó AST_DECL_VAR para cada.
+        AST_Node* current_decl = head;
+        AST_Node* current_id = id_list;
+        
+        while (current_id != NULL) {
+            // Cria um NOVO nó AST_DECL_VAR para a variável
+            AST_Node* new_decl = new_ast_node(AST_DECL_VAR, (yylsp[-4]).first_line);
+            new_decl->child1 = type_node;
+            
+            // Desliga o nó ID da lista para usá-lo como child2
+            AST_Node* next_id_temp = current_id->next;
+            current_id->next = NULL; 
+            
+            new_decl->child2 = current_id;
+            
+            // Liga a nova declaração (new_decl) à lista de declarações globais.
+            current_decl->next = new_decl;
+            current_decl = new_decl;
+            
+            current_id = next_id_temp; 
+        }
+        
+        // Liga a lista de novas declarações (head) ao restante das globais.
+        current_decl->next = (yyvsp[0].node);
+        (yyval.node) = head; 
+    }
+#line 1386 "goianinha.tab.c"
+    break;
+
+  case 4: /* DeclFuncVar: Tipo ID DeclFunc DeclFuncVar  */
+#line 93 "./Analise_Sintatica/goianinha.y"
+    {
+        // Declaração de Função
+        AST_Node* func_node = new_ast_node(AST_DECL_FUNC, (yylsp[-3]).first_line);
+        func_node->child1 = (yyvsp[-3].node);                                           // Tipo de retorno
+        func_node->child2 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-2].text), (yylsp[-2]).first_line); // ID
+        func_node->child3 = (yyvsp[-1].node)->child1;                                   // Lista de Parâmetros (extraída do nó DeclFunc)
+        func_node->child4 = (yyvsp[-1].node)->child2;                                   // Bloco de Comandos (extraído do nó DeclFunc)
+        
+        // Encadeia a nova função no topo da lista DeclFuncVar
+        (yyval.node) = create_list_item(AST_LISTA_DECL_FUNC_VAR, func_node, (yyvsp[0].node));
+    }
+#line 1402 "goianinha.tab.c"
+    break;
+
+  case 5: /* DeclFuncVar: %empty  */
+#line 105 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = NULL; }
+#line 1408 "goianinha.tab.c"
+    break;
+
+  case 6: /* DeclProg: PROGRAMA Bloco  */
+#line 108 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1414 "goianinha.tab.c"
+    break;
+
+  case 7: /* DeclVar: VIRGULA ID DeclVar  */
+#line 111 "./Analise_Sintatica/goianinha.y"
+    {
+        // Cria um nó para a variável atual (ID) e encadeia no próximo nó ($3)
+        AST_Node* current_id = new_ast_leaf(AST_EXPR_ID, (yyvsp[-1].text), (yylsp[-1]).first_line);
+        current_id->next = (yyvsp[0].node); // Encadeia o restante da lista de IDs
+        (yyval.node) = current_id;
+    }
+#line 1425 "goianinha.tab.c"
+    break;
+
+  case 8: /* DeclVar: %empty  */
+#line 118 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = NULL; }
+#line 1431 "goianinha.tab.c"
+    break;
+
+  case 9: /* DeclFunc: ABRE_PAR ListaParametros FECHA_PAR Bloco  */
+#line 121 "./Analise_Sintatica/goianinha.y"
+    {
+        // Cria um nó temporário para a função. Child1: Parâmetros. Child2: Bloco.
+        (yyval.node) = new_ast_node(AST_DECL_FUNC, (yylsp[-3]).first_line);
+        (yyval.node)->child1 = (yyvsp[-2].node);                                  // ListaParametros
+        (yyval.node)->child2 = (yyvsp[0].node);                                  // Bloco
+    }
+#line 1442 "goianinha.tab.c"
+    break;
+
+  case 10: /* ListaParametros: %empty  */
+#line 130 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = NULL; }
+#line 1448 "goianinha.tab.c"
+    break;
+
+  case 11: /* ListaParametros: ListaParametrosCont  */
+#line 132 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1454 "goianinha.tab.c"
+    break;
+
+  case 12: /* ListaParametrosCont: Tipo ID  */
+#line 135 "./Analise_Sintatica/goianinha.y"
+    {
+        // Cria o nó para este Parâmetro individual.
+        AST_Node* param_node = new_ast_node(AST_LISTA_PARAMETROS, (yylsp[-1]).first_line);
+        param_node->child1 = (yyvsp[-1].node);                                           // O Tipo (nó AST_TIPO_INT ou AST_TIPO_CAR)
+        param_node->child2 = new_ast_leaf(AST_EXPR_ID, (yyvsp[0].text), (yylsp[0]).first_line); // O ID (nome do parâmetro)
+        
+        (yyval.node) = param_node;
+    }
+#line 1467 "goianinha.tab.c"
+    break;
+
+  case 13: /* ListaParametrosCont: Tipo ID VIRGULA ListaParametrosCont  */
+#line 144 "./Analise_Sintatica/goianinha.y"
+    {
+        // Cria o nó para o Parâmetro atual.
+        AST_Node* param_node = new_ast_node(AST_LISTA_PARAMETROS, (yylsp[-3]).first_line);
+        param_node->child1 = (yyvsp[-3].node); // O Tipo
+        param_node->child2 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-2].text), (yylsp[-2]).first_line); // O ID
+
+        // Encadeia o restante da lista
+        param_node->next = (yyvsp[0].node);
+        
+        (yyval.node) = param_node;
+    }
+#line 1483 "goianinha.tab.c"
+    break;
+
+  case 14: /* Bloco: ABRE_CHAVE ListaDeclVar ListaComando FECHA_CHAVE  */
+#line 158 "./Analise_Sintatica/goianinha.y"
+    {
+        // Child1: Declarações Locais. 
+        // Child2: Lista de Comandos.
+        
+        (yyval.node) = new_ast_node(AST_BLOCO, (yylsp[-3]).first_line);
+        (yyval.node)->child1 = (yyvsp[-2].node);
+        (yyval.node)->child2 = (yyvsp[-1].node);
+    }
+#line 1496 "goianinha.tab.c"
+    break;
+
+  case 15: /* ListaDeclVar: %empty  */
+#line 169 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = NULL; }
+#line 1502 "goianinha.tab.c"
+    break;
+
+  case 16: /* ListaDeclVar: Tipo ID DeclVar PONTO_VIRGULA ListaDeclVar  */
+#line 171 "./Analise_Sintatica/goianinha.y"
+    {
+        // Tipo
+        AST_Node* type_node = (yyvsp[-4].node);
+        
+        // Lista de IDs
+        AST_Node* id_list = (yyvsp[-2].node); 
+        
+        // Cria o nó para a PRIMEIRA
+        AST_Node* head = new_ast_node(AST_DECL_VAR, (yylsp[-4]).first_line);
+        head->child1 = type_node; 
+        head->child2 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-3].text), (yylsp[-3]).first_line); // ID
+        
+        // Itera sobre a lista de IDs restantes e cria um nó AST_DECL_VAR para cada.
+        AST_Node* current_decl = head;
+        AST_Node* current_id = id_list;
+        
+        while (current_id != NULL) {
+            // Cria um NOVO nó AST_DECL_VAR para o ID atual
+            AST_Node* new_decl = new_ast_node(AST_DECL_VAR, (yylsp[-4]).first_line);
+            new_decl->child1 = type_node; 
+            
+            // Desligando o nó ID para usá-lo como child2
+            AST_Node* next_id_temp = current_id->next;
+            current_id->next = NULL; 
+            
+            new_decl->child2 = current_id; 
+            
+            // Ligando a nova declaração à lista de declarações.
+            current_decl->next = new_decl;
+            current_decl = new_decl;
+            
+            current_id = next_id_temp; 
+        }
+        
+        // Ligando a lista de novos nós de declaração (head) ao restante da lista ($5)
+        current_decl->next = (yyvsp[0].node);
+        (yyval.node) = head; 
+    }
+#line 1545 "goianinha.tab.c"
+    break;
+
+  case 17: /* Tipo: INT  */
+#line 211 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_node(AST_TIPO_INT, (yylsp[0]).first_line); }
+#line 1551 "goianinha.tab.c"
+    break;
+
+  case 18: /* Tipo: CAR  */
+#line 213 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_node(AST_TIPO_CAR, (yylsp[0]).first_line); }
+#line 1557 "goianinha.tab.c"
+    break;
+
+  case 19: /* ListaComando: Comando  */
+#line 216 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1563 "goianinha.tab.c"
+    break;
+
+  case 20: /* ListaComando: Comando ListaComando  */
+#line 218 "./Analise_Sintatica/goianinha.y"
+    { 
+        (yyvsp[-1].node)->next = (yyvsp[0].node); 
+        (yyval.node) = (yyvsp[-1].node); 
+    }
+#line 1572 "goianinha.tab.c"
+    break;
+
+  case 21: /* Comando: PONTO_VIRGULA  */
+#line 224 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_node(AST_COMANDO_VAZIO, (yylsp[0]).first_line); }
+#line 1578 "goianinha.tab.c"
+    break;
+
+  case 22: /* Comando: Expr PONTO_VIRGULA  */
+#line 226 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[-1].node); }
+#line 1584 "goianinha.tab.c"
+    break;
+
+  case 23: /* Comando: RETORNE Expr PONTO_VIRGULA  */
+#line 228 "./Analise_Sintatica/goianinha.y"
+    {
+        (yyval.node) = new_ast_node(AST_COMANDO_RETORNE, (yylsp[-2]).first_line);
+        (yyval.node)->child1 = (yyvsp[-1].node);
+    }
+#line 1593 "goianinha.tab.c"
+    break;
+
+  case 24: /* Comando: LEIA ID PONTO_VIRGULA  */
+#line 233 "./Analise_Sintatica/goianinha.y"
+    {
+        (yyval.node) = new_ast_node(AST_COMANDO_LEIA, (yylsp[-2]).first_line);
+        (yyval.node)->child1 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-1].text), (yylsp[-1]).first_line);
+    }
+#line 1602 "goianinha.tab.c"
+    break;
+
+  case 25: /* Comando: ESCREVA Expr PONTO_VIRGULA  */
+#line 238 "./Analise_Sintatica/goianinha.y"
+    {
+        (yyval.node) = new_ast_node(AST_COMANDO_ESCREVA, (yylsp[-2]).first_line);
+        (yyval.node)->child1 = (yyvsp[-1].node);
+    }
+#line 1611 "goianinha.tab.c"
+    break;
+
+  case 26: /* Comando: ESCREVA CADEIA_CARACTERES PONTO_VIRGULA  */
+#line 243 "./Analise_Sintatica/goianinha.y"
+    {
+        (yyval.node) = new_ast_node(AST_COMANDO_ESCREVA, (yylsp[-2]).first_line);
+        (yyval.node)->child1 = new_ast_leaf(AST_CONST_CADEIA, (yyvsp[-1].text), (yylsp[-1]).first_line);
+    }
+#line 1620 "goianinha.tab.c"
+    break;
+
+  case 27: /* Comando: NOVALINHA PONTO_VIRGULA  */
+#line 248 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_node(AST_COMANDO_NOVALINHA, (yylsp[-1]).first_line); }
+#line 1626 "goianinha.tab.c"
+    break;
+
+  case 28: /* Comando: SE ABRE_PAR Expr FECHA_PAR ENTAO Comando  */
+#line 250 "./Analise_Sintatica/goianinha.y"
+    {
+        // SE sem SENAO
+        (yyval.node) = new_ast_node(AST_COMANDO_SE, (yylsp[-5]).first_line);
+        (yyval.node)->child1 = (yyvsp[-3].node); // Condição (Expr)
+        (yyval.node)->child2 = (yyvsp[0].node); // Bloco ENTAO (Comando)
+    }
+#line 1637 "goianinha.tab.c"
+    break;
+
+  case 29: /* Comando: SE ABRE_PAR Expr FECHA_PAR ENTAO Comando SENAO Comando  */
+#line 257 "./Analise_Sintatica/goianinha.y"
+    {
+        // SE com SENAO
+        (yyval.node) = new_ast_node(AST_COMANDO_SE_SENAO, (yylsp[-7]).first_line);
+        (yyval.node)->child1 = (yyvsp[-5].node); // Condição (Expr)
+        (yyval.node)->child2 = (yyvsp[-2].node); // Bloco ENTAO (Comando)
+        (yyval.node)->child3 = (yyvsp[0].node); // Bloco SENAO (Comando)
+    }
+#line 1649 "goianinha.tab.c"
+    break;
+
+  case 30: /* Comando: ENQUANTO ABRE_PAR Expr FECHA_PAR EXECUTE Comando  */
+#line 265 "./Analise_Sintatica/goianinha.y"
+    {
+        (yyval.node) = new_ast_node(AST_COMANDO_ENQUANTO, (yylsp[-5]).first_line);
+        (yyval.node)->child1 = (yyvsp[-3].node); // Condição (Expr)
+        (yyval.node)->child2 = (yyvsp[0].node); // Corpo do loop (Comando)
+    }
+#line 1659 "goianinha.tab.c"
+    break;
+
+  case 31: /* Comando: Bloco  */
+#line 271 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1665 "goianinha.tab.c"
+    break;
+
+  case 32: /* Expr: OrExpr  */
+#line 274 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1671 "goianinha.tab.c"
+    break;
+
+  case 33: /* Expr: ID ATRIBUICAO Expr  */
+#line 276 "./Analise_Sintatica/goianinha.y"
+    {
+        // Cria um nó de atribuição. Filhos: ID e a Expressão à direita.
+        (yyval.node) = new_ast_node(AST_COMANDO_ATRIB, (yylsp[-2]).first_line);       // @1 é a linha do primeiro token (ID)
+        (yyval.node)->child1 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-2].text), (yylsp[-2]).first_line); // $1 é o lexema do ID
+        (yyval.node)->child2 = (yyvsp[0].node);                                           // $3 é o nó da Expr
+    }
+#line 1682 "goianinha.tab.c"
+    break;
+
+  case 34: /* OrExpr: OrExpr OU AndExpr  */
+#line 286 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("OU", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1688 "goianinha.tab.c"
+    break;
+
+  case 35: /* OrExpr: AndExpr  */
+#line 288 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1694 "goianinha.tab.c"
+    break;
+
+  case 36: /* AndExpr: AndExpr E EqExpr  */
+#line 291 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("E", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1700 "goianinha.tab.c"
+    break;
+
+  case 37: /* AndExpr: EqExpr  */
+#line 293 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1706 "goianinha.tab.c"
+    break;
+
+  case 38: /* EqExpr: EqExpr IGUAL DesigExpr  */
+#line 296 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("==", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1712 "goianinha.tab.c"
+    break;
+
+  case 39: /* EqExpr: EqExpr DIFERENTE DesigExpr  */
+#line 298 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("!=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1718 "goianinha.tab.c"
+    break;
+
+  case 40: /* EqExpr: DesigExpr  */
+#line 300 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1724 "goianinha.tab.c"
+    break;
+
+  case 41: /* DesigExpr: DesigExpr MENOR AddExpr  */
+#line 303 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("<", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1730 "goianinha.tab.c"
+    break;
+
+  case 42: /* DesigExpr: DesigExpr MAIOR AddExpr  */
+#line 305 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op(">", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1736 "goianinha.tab.c"
+    break;
+
+  case 43: /* DesigExpr: DesigExpr MENOR_IGUAL AddExpr  */
+#line 307 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("<=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1742 "goianinha.tab.c"
+    break;
+
+  case 44: /* DesigExpr: DesigExpr MAIOR_IGUAL AddExpr  */
+#line 309 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op(">=", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1748 "goianinha.tab.c"
+    break;
+
+  case 45: /* DesigExpr: AddExpr  */
+#line 311 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1754 "goianinha.tab.c"
+    break;
+
+  case 46: /* AddExpr: AddExpr MAIS MulExpr  */
+#line 314 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("+", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1760 "goianinha.tab.c"
+    break;
+
+  case 47: /* AddExpr: AddExpr MENOS MulExpr  */
+#line 316 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("-", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1766 "goianinha.tab.c"
+    break;
+
+  case 48: /* AddExpr: MulExpr  */
+#line 318 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1772 "goianinha.tab.c"
+    break;
+
+  case 49: /* MulExpr: MulExpr MULT UnExpr  */
+#line 321 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("*", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1778 "goianinha.tab.c"
+    break;
+
+  case 50: /* MulExpr: MulExpr DIV UnExpr  */
+#line 323 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_binary_op("/", (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 1784 "goianinha.tab.c"
+    break;
+
+  case 51: /* MulExpr: UnExpr  */
+#line 325 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1790 "goianinha.tab.c"
+    break;
+
+  case 52: /* UnExpr: MENOS PrimExpr  */
+#line 328 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_unary_op("-", (yyvsp[0].node)); }
+#line 1796 "goianinha.tab.c"
+    break;
+
+  case 53: /* UnExpr: NOT PrimExpr  */
+#line 330 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_unary_op("!", (yyvsp[0].node)); }
+#line 1802 "goianinha.tab.c"
+    break;
+
+  case 54: /* UnExpr: PrimExpr  */
+#line 332 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1808 "goianinha.tab.c"
+    break;
+
+  case 55: /* PrimExpr: ID ABRE_PAR ListExpr FECHA_PAR  */
+#line 336 "./Analise_Sintatica/goianinha.y"
+    {
+        // Chamada de função com argumentos
+        (yyval.node) = new_ast_node(AST_EXPR_CHAMADA_FUNC, (yylsp[-3]).first_line);
+        (yyval.node)->child1 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-3].text), (yylsp[-3]).first_line);
+        (yyval.node)->child2 = (yyvsp[-1].node); // Lista de Expressões (Argumentos)
+    }
+#line 1819 "goianinha.tab.c"
+    break;
+
+  case 56: /* PrimExpr: ID ABRE_PAR FECHA_PAR  */
+#line 343 "./Analise_Sintatica/goianinha.y"
+    {
+        // Chamada de função sem argumentos
+        (yyval.node) = new_ast_node(AST_EXPR_CHAMADA_FUNC, (yylsp[-2]).first_line);
+        (yyval.node)->child1 = new_ast_leaf(AST_EXPR_ID, (yyvsp[-2].text), (yylsp[-2]).first_line);
+        (yyval.node)->child2 = NULL;
+    }
+#line 1830 "goianinha.tab.c"
+    break;
+
+  case 57: /* PrimExpr: ID  */
+#line 350 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_leaf(AST_EXPR_ID, (yyvsp[0].text), (yylsp[0]).first_line); }
+#line 1836 "goianinha.tab.c"
+    break;
+
+  case 58: /* PrimExpr: CARCONST  */
+#line 352 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_leaf(AST_CONST_CAR, (yyvsp[0].text), (yylsp[0]).first_line); }
+#line 1842 "goianinha.tab.c"
+    break;
+
+  case 59: /* PrimExpr: INTCONST  */
+#line 354 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = new_ast_leaf(AST_CONST_INT, (yyvsp[0].text), (yylsp[0]).first_line); }
+#line 1848 "goianinha.tab.c"
+    break;
+
+  case 60: /* PrimExpr: ABRE_PAR Expr FECHA_PAR  */
+#line 356 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[-1].node); }
+#line 1854 "goianinha.tab.c"
+    break;
+
+  case 61: /* ListExpr: Expr  */
+#line 360 "./Analise_Sintatica/goianinha.y"
+    { (yyval.node) = (yyvsp[0].node); }
+#line 1860 "goianinha.tab.c"
+    break;
+
+  case 62: /* ListExpr: ListExpr VIRGULA Expr  */
+#line 362 "./Analise_Sintatica/goianinha.y"
+    { 
+        (yyval.node) = create_list_item(AST_LISTA_EXPRESSOES, (yyvsp[0].node), (yyvsp[-2].node));
+    }
+#line 1868 "goianinha.tab.c"
+    break;
+
+
+#line 1872 "goianinha.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 366 "./Analise_Sintatica/goianinha.y"
+
+
+void yyerror(const char *s) {
+    fprintf(COMPILE_ERR, "ERRO: %s na linha %d\n\n", s, yylineno);
+    compile_abort(1);
+}
@@ -0,0 +1,135 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_GOIANINHA_TAB_H_INCLUDED
+# define YY_YY_GOIANINHA_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ID = 258,                      /* ID  */
+    INTCONST = 259,                /* INTCONST  */
+    CARCONST = 260,                /* CARCONST  */
+    CADEIA_CARACTERES = 261,       /* CADEIA_CARACTERES  */
+    PROGRAMA = 262,                /* PROGRAMA  */
+    CAR = 263,                     /* CAR  */
+    INT = 264,                     /* INT  */
+    RETORNE = 265,                 /* RETORNE  */
+    LEIA = 266,                    /* LEIA  */
+    ESCREVA = 267,                 /* ESCREVA  */
+    NOVALINHA = 268,               /* NOVALINHA  */
+    SE = 269,                      /* SE  */
+    ENTAO = 270,                   /* ENTAO  */
+    SENAO = 271,                   /* SENAO  */
+    ENQUANTO = 272,                /* ENQUANTO  */
+    EXECUTE = 273,                 /* EXECUTE  */
+    VIRGULA = 274,                 /* VIRGULA  */
+    PONTO_VIRGULA = 275,           /* PONTO_VIRGULA  */
+    ABRE_PAR = 276,                /* ABRE_PAR  */
+    FECHA_PAR = 277,               /* FECHA_PAR  */
+    ABRE_CHAVE = 278,              /* ABRE_CHAVE  */
+    FECHA_CHAVE = 279,             /* FECHA_CHAVE  */
+    ATRIBUICAO = 280,              /* ATRIBUICAO  */
+    IGUAL = 281,                   /* IGUAL  */
+    DIFERENTE = 282,               /* DIFERENTE  */
+    MENOR = 283,                   /* MENOR  */
+    MAIOR = 284,                   /* MAIOR  */
+    MENOR_IGUAL = 285,             /* MENOR_IGUAL  */
+    MAIOR_IGUAL = 286,             /* MAIOR_IGUAL  */
+    MAIS = 287,                    /* MAIS  */
+    MENOS = 288,                   /* MENOS  */
+    MULT = 289,                    /* MULT  */
+    DIV = 290,                     /* DIV  */
+    NOT = 291,                     /* NOT  */
+    OU = 292,                      /* OU  */
+    E = 293                        /* E  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 19 "./Analise_Sintatica/goianinha.y"
+
+    struct AST_Node *node;   // Para todos os não-terminais e tokens com valor
+    char *text;              // Para tokens como ID, INTCONST, etc., que carregam o lexema
+
+#line 107 "goianinha.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+extern YYSTYPE yylval;
+extern YYLTYPE yylloc;
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_GOIANINHA_TAB_H_INCLUDED  */
@@ -0,0 +1,108 @@
+/* Substituto manual do lexer gerado pelo flex (apenas para testes locais). */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "./AST/ast.h"
+#include "./Relatorio/time_report.h"
+#include "goianinha.tab.h"
+
+FILE *yyin = NULL;
+char *yytext = NULL;
+int yylineno = 1;
+static char tokbuf[4096];
+
+void reportar_erro(const char* mensagem, int linha) {
+    fprintf(COMPILE_OUT, "\nERRO: %s %d\n\n", mensagem, linha);
+}
+
+typedef struct yy_buffer_state* YY_BUFFER_STATE;
+static FILE* scan_file = NULL;
+YY_BUFFER_STATE yy_scan_bytes(const char* bytes, int len) {
+    if (scan_file) fclose(scan_file);
+    scan_file = fmemopen((void*)bytes, len, "r");
+    yyin = scan_file;
+    return (YY_BUFFER_STATE)scan_file;
+}
+int yylex_destroy(void) {
+    if (scan_file) { fclose(scan_file); scan_file = NULL; }
+    yyin = NULL; yylineno = 1;
+    return 0;
+}
+
+static int peekc(void) { int c = getc(yyin); if (c != EOF) ungetc(c, yyin); return c; }
+
+static int lex_next_token(void) {
+    int c;
+    if (!yyin) yyin = stdin;
+again:
+    c = getc(yyin);
+    while (c == ' ' || c == '\t' || c == '\r' || c == '\n') { if (c == '\n') yylineno++; c = getc(yyin); }
+    yylloc.first_line = yylloc.last_line = yylineno;
+    yytext = tokbuf;
+    tokbuf[0] = 0;
+    if (c == EOF) return 0;
+    if (c == '/' && peekc() == '*') {
+        getc(yyin);
+        int start = yylineno, prev = 0;
+        for (;;) {
+            int d = getc(yyin);
+            if (d == EOF) { reportar_erro("COMENTARIO NAO TERMINA", start); compile_abort(1); }
+            if (d == '\n') yylineno++;
+            if (prev == '*' && d == '/') break;
+            prev = d;
+        }
+        goto again;
+    }
+    if (isalpha(c) || c == '_') {
+        int n = 0; tokbuf[n++] = c;
+        while (isalnum(peekc()) || peekc() == '_') tokbuf[n++] = getc(yyin);
+        tokbuf[n] = 0;
+        static const struct { const char* k; int t; } kw[] = {
+            {"programa",PROGRAMA},{"car",CAR},{"int",INT},{"retorne",RETORNE},{"leia",LEIA},
+            {"escreva",ESCREVA},{"novalinha",NOVALINHA},{"se",SE},{"entao",ENTAO},{"senao",SENAO},
+            {"enquanto",ENQUANTO},{"execute",EXECUTE},{"ou",OU},{"e",E}};
+        for (size_t i = 0; i < sizeof(kw)/sizeof(kw[0]); i++) if (!strcmp(kw[i].k, tokbuf)) return kw[i].t;
+        yylval.text = ast_copy_lexeme(tokbuf); return ID;
+    }
+    if (isdigit(c)) {
+        int n = 0; tokbuf[n++] = c;
+        while (isdigit(peekc())) tokbuf[n++] = getc(yyin);
+        tokbuf[n] = 0; yylval.text = ast_copy_lexeme(tokbuf); return INTCONST;
+    }
+    if (c == '\'') {
+        int a = getc(yyin), b = getc(yyin);
+        if (a == '\n' || b != '\'') { reportar_erro("CARACTERE INVALIDO, LINHA", yylineno); compile_abort(1); }
+        tokbuf[0] = '\''; tokbuf[1] = a; tokbuf[2] = '\''; tokbuf[3] = 0;
+        yylval.text = ast_copy_lexeme(tokbuf); return CARCONST;
+    }
+    if (c == '"') {
+        int n = 0; tokbuf[n++] = c;
+        for (;;) {
+            int d = getc(yyin);
+            if (d == EOF || d == '\n') { reportar_erro("CADEIA DE CARACTERES OCUPA MAIS DE UMA LINHA", yylineno); compile_abort(1); }
+            tokbuf[n++] = d;
+            if (d == '"') break;
+        }
+        tokbuf[n] = 0; yylval.text = ast_copy_lexeme(tokbuf); return CADEIA_CARACTERES;
+    }
+    int d = peekc();
+    switch (c) {
+        case ',': return VIRGULA; case ';': return PONTO_VIRGULA; case '(': return ABRE_PAR;
+        case ')': return FECHA_PAR; case '{': return ABRE_CHAVE; case '}': return FECHA_CHAVE;
+        case '+': return MAIS; case '-': return MENOS; case '*': return MULT; case '/': return DIV;
+        case '=': if (d == '=') { getc(yyin); return IGUAL; } return ATRIBUICAO;
+        case '!': if (d == '=') { getc(yyin); return DIFERENTE; } return NOT;
+        case '<': if (d == '=') { getc(yyin); return MENOR_IGUAL; } return MENOR;
+        case '>': if (d == '=') { getc(yyin); return MAIOR_IGUAL; } return MAIOR;
+    }
+    reportar_erro("CARACTERE INVALIDO, LINHA", yylineno); compile_abort(1);
+}
+
+int yylex(void) {
+    time_report_begin(PHASE_LEXICA);
+    int token = lex_next_token();
+    time_report_end(PHASE_LEXICA);
+    if (token != 0) time_counters.tokens++;
+    return token;
+}
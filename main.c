@@ -1,7 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include "./AST/ast.h"
 #include "./Tabela_Simbulos/symbolTable.h"
+#include "./Codigo_Intermediario/ir.h"
+#include "./Maquina_Virtual/vm.h"
+#include "./Maquina_Virtual/jit.h"
+#include "./Maquina_Virtual/mips_emu.h"
+#include "./Servidor/server.h"
+#include "./Relatorio/time_report.h"
+#include "./Cache/cache.h"
 
 // Declarações externas
 extern FILE *yyin;                                           // Arquivo que o Flex lê
@@ -9,10 +24,32 @@ extern char* yytext;                                         // Lexema atual rec
 extern int yyparse();                                        // Função do Bison para iniciar o parsing
 extern void analyze_ast(SymbolTableRef symtab);              // Função de análise semântica
 extern void generate_mips_code(const char *output_filename); // Função de geração de código MIPS
+extern void generate_c_code(AST_Node* root, const char* output_filename); // Geração de C (--target=c)
 extern AST_Node* root_ast;                                   // Declaração da raiz global da AST, preenchida pelo Bison
+extern int peephole_enabled;                                 // Flag do otimizador peephole (codigo/peephole.c)
+extern int schedule_enabled;                                 // Flag do escalonador (codigo/scheduler.c)
+extern int delay_slots_enabled;                              // Preenchimento de delay slots (codigo/scheduler.c)
+extern int mips_set_latencies(const char* spec);             // Modelo de latência do escalonador
+extern int line_profile_enabled;                             // Perfil por linha do fonte (codigo/line_profile.c)
+extern const char* line_profile_source;                      // Fonte mostrado no relatório do perfil por linha
 
-// Variável Global para a Tabela de Símbolos (Usada pelo codigo.c)
-SymbolTableRef global_symtab = NULL; 
+// Opções da geração de código
+int use_ir = 1;                                              // 0 traduz a AST direto para MIPS (-fno-ir)
+int emit_ir = 0;                                             // 1 escreve a IR em output.ir (--emit-ir)
+int run_program = 0;                                         // 1 executa na máquina virtual em vez de gerar código (--run)
+int jit_program = 0;                                         // 1 executa com o compilador JIT para x86-64 (--jit)
+int emulate_program = 0;                                     // 1 executa o output.asm no emulador MIPS (--emulate)
+
+// Arquitetura de destino (--target=)
+typedef enum {
+    TARGET_MIPS,                                             // output.asm (padrão)
+    TARGET_X86_64,                                           // output.s, montado com as/ld
+    TARGET_C,                                                // output.c, compilado com gcc/clang
+} CompileTarget;
+CompileTarget target = TARGET_MIPS;
+
+// Variável Global para a Tabela de Símbolos (definida e usada pelo codigo.c)
+extern SymbolTableRef global_symtab;
 
 // Nomes dos tipos de nós da AST para impressão
 const char *AST_NodeKind_Names[] = {
@@ -115,23 +152,102 @@ void print_ast_node(AST_Node* node, int depth) {
 }
 
 
-int main(int argc, char** argv) {
-    if (argc != 2) {
-        fprintf(stderr, "Uso: %s <arquivo_fonte>\n", argv[0]);
-        return 1;
+/*
+    * Função: report_times
+    * -------------------------------
+    * Com --time-report, imprime o relatório de tempo em stderr e escreve o
+    * JSON, se pedido. Roda antes de executar o programa (--run, --jit e
+    * --emulate), para que a execução não entre nas medidas.
+*/
+static void report_times(const char* source_file) {
+    if (!time_report_enabled) return;
+    time_report_print(source_file, stderr);
+    if (time_report_json && !time_report_write_json(source_file, time_report_json)) {
+        exit(EXIT_FAILURE);
     }
+}
+
+/*
+    * Função: cache_outputs
+    * -------------------------------
+    * Extensões das saídas que o cache guarda para o destino atual.
+    * Retorna: o número de extensões escritas em 'exts'.
+*/
+static int cache_outputs(const char** exts) {
+    int n = 0;
+    if (target == TARGET_X86_64) {
+        exts[n++] = ".s";
+    } else if (target == TARGET_C) {
+        exts[n++] = ".c";
+    } else {
+        exts[n++] = ".asm";
+        exts[n++] = ".linhas";
+    }
+    if (emit_ir && target != TARGET_C) exts[n++] = ".ir";
+    return n;
+}
+
+/*
+    * Função: compile_file
+    * -------------------------------
+    * Compila um arquivo fonte com as opções já lidas. Os arquivos gerados
+    * recebem o nome 'base' com a extensão de cada saída (base.asm, base.s,
+    * base.c, base.ir e a tabela de linhas base.linhas).
+    * Retorna: 0 em caso de sucesso (erros do fonte encerram o processo).
+*/
+static int compile_file(const char* source_file, const char* base) {
+    char asm_name[PATH_MAX], s_name[PATH_MAX], c_name[PATH_MAX], ir_name[PATH_MAX];
+    snprintf(asm_name, sizeof(asm_name), "%s.asm", base);
+    snprintf(s_name, sizeof(s_name), "%s.s", base);
+    snprintf(c_name, sizeof(c_name), "%s.c", base);
+    snprintf(ir_name, sizeof(ir_name), "%s.ir", base);
+    line_profile_source = source_file;
+
+    // Com --cache-dir, a chave é calculada antes de abrir o fonte para o parser. --run e --jit
+    // não geram arquivos, e --time-report e o relatório de -fprofile-use medem a compilação
+    char cache_key[CACHE_KEY_LEN];
+    int use_cache = cache_dir != NULL && !run_program && !jit_program && !time_report_enabled &&
+                    !(line_profile_enabled && profile_use_file && !emulate_program) &&
+                    cache_compute_key(source_file, profile_use_file, cache_key);
+    struct timespec compile_start;
+    clock_gettime(CLOCK_MONOTONIC, &compile_start);
 
     // Abre o arquivo de entrada
-    yyin = fopen(argv[1], "r");
+    yyin = fopen(source_file, "r");
     if (!yyin) {
-        fprintf(stderr, "Erro ao abrir arquivo: %s\n", argv[1]);
+        fprintf(stderr, "Erro ao abrir arquivo: %s\n", source_file);
         return 1;
     }
 
     int print_tree = 0; // 1 para imprimir a árvore, 0 para não imprimir
+
+    // Com --run, as mensagens da compilação vão para stderr: stdout fica só com a saída do programa
+    int saved_stdout = -1;
+    if (run_program || jit_program || emulate_program) {
+        fflush(stdout);
+        saved_stdout = dup(STDOUT_FILENO);
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+    }
+
+    // Acerto no cache: as saídas são copiadas sem análise léxica nem sintática
+    if (use_cache && cache_fetch(cache_key, base)) {
+        fclose(yyin);
+        printf("Codigo obtido do cache (%.16s) no arquivo: %s%s\n", cache_key, base,
+               target == TARGET_X86_64 ? ".s" : target == TARGET_C ? ".c" : ".asm");
+        if (emulate_program) {
+            fflush(stdout);
+            dup2(saved_stdout, STDOUT_FILENO);
+            close(saved_stdout);
+            return mips_emulate(asm_name);
+        }
+        return 0;
+    }
     
     // Executa o parser
-    if (yyparse() == 0) {
+    time_report_begin(PHASE_SINTATICA);
+    int parse_status = yyparse();
+    time_report_end(PHASE_SINTATICA);
+    if (parse_status == 0) {
         printf("\nAnálise sintática concluída com sucesso!\n");
         
         if (root_ast != NULL) {
@@ -146,16 +262,121 @@ int main(int argc, char** argv) {
             }
                         
             // Análise Semântica
+            time_report_begin(PHASE_SEMANTICA);
             analyze_ast(symtab);
+            time_report_end(PHASE_SEMANTICA);
             printf("Análise semantica concluída com sucesso!\n");
 
             global_symtab = symtab;
 
-            // Geração de Código MIPS
-            generate_mips_code("output.asm");
+            // Geração de Código MIPS (pela IR ou direto da AST); o x86-64 sempre parte da IR
+            if (target == TARGET_C && !run_program && !jit_program) {
+                time_report_begin(PHASE_GERA_CODIGO);
+                generate_c_code(root_ast, c_name);
+                time_report_end(PHASE_GERA_CODIGO);
+            } else if (use_ir || emit_ir || run_program || jit_program || target == TARGET_X86_64) {
+                time_report_begin(PHASE_GERA_IR);
+                IrProgram* ir = ir_generate_program(root_ast);
+                time_report_end(PHASE_GERA_IR);
+
+                // Perfil: as contagens e os contadores se referem aos blocos recém-gerados
+                if (profile_use_file && !ir_load_profile(ir, profile_use_file)) {
+                    exit(EXIT_FAILURE);
+                }
+                if (profile_use_file && line_profile_enabled && !emulate_program) {
+                    ir_report_line_profile(ir);     // Sem emulador: operações da IR pelas contagens do perfil
+                }
+                if (profile_generate) {
+                    ir_instrument_program(ir);
+                }
+
+                // Otimizações sobre a IR
+                ir_optimize_program(ir);
+
+                time_report_begin(PHASE_VERIFICA_IR);
+                int ir_errors = ir_verify_program(ir);
+                time_report_end(PHASE_VERIFICA_IR);
+                if (ir_errors > 0) {
+                    fprintf(stderr, "IR invalida. Geracao de codigo abortada.\n");
+                    exit(EXIT_FAILURE);
+                }
+
+                if (emit_ir) {
+                    FILE* ir_file = fopen(ir_name, "w");
+                    if (ir_file) {
+                        ir_dump_program(ir, ir_file);
+                        fclose(ir_file);
+                        printf("IR gerada no arquivo: %s\n", ir_name);
+                    } else {
+                        perror("Erro ao abrir arquivo da IR");
+                    }
+                }
+
+                if (jit_program) {
+                    symtab_destroy(symtab);
+                    fclose(yyin);
+                    report_times(source_file);
+
+                    fflush(stdout);
+                    dup2(saved_stdout, STDOUT_FILENO);
+                    close(saved_stdout);
+
+                    int status = jit_run(ir);       // As funções são compiladas durante a execução
+                    ir_free_program(ir);
+                    return status;
+                } else if (run_program) {
+                    VmProgram* program = vm_compile(ir);
+                    ir_free_program(ir);
+                    symtab_destroy(symtab);
+                    fclose(yyin);
+                    report_times(source_file);
+
+                    fflush(stdout);
+                    dup2(saved_stdout, STDOUT_FILENO);
+                    close(saved_stdout);
+
+                    int status = vm_run(program);
+                    vm_free(program);
+                    return status;
+                } else {
+                    time_report_begin(PHASE_GERA_CODIGO);
+                    if (target == TARGET_X86_64) {
+                        ir_generate_x86(ir, s_name);
+                    } else if (use_ir) {
+                        ir_generate_mips(ir, asm_name);
+                    } else {
+                        generate_mips_code(asm_name);
+                    }
+                    time_report_end(PHASE_GERA_CODIGO);
+                }
+                ir_free_program(ir);
+            } else {
+                time_report_begin(PHASE_GERA_CODIGO);
+                generate_mips_code(asm_name);
+                time_report_end(PHASE_GERA_CODIGO);
+            }
 
 
             symtab_destroy(symtab);
+            report_times(source_file);
+
+            if (use_cache) {
+                struct timespec compile_end;
+                clock_gettime(CLOCK_MONOTONIC, &compile_end);
+                double ms = (compile_end.tv_sec - compile_start.tv_sec) * 1000.0 +
+                            (compile_end.tv_nsec - compile_start.tv_nsec) / 1e6;
+                const char* exts[3];
+                cache_store(cache_key, base, exts, cache_outputs(exts), ms);
+            }
+
+            // O .asm recém-gerado roda no emulador, com a saída do programa em stdout
+            if (emulate_program && !run_program && !jit_program) {
+                fclose(yyin);
+                fflush(stdout);
+                dup2(saved_stdout, STDOUT_FILENO);
+                close(saved_stdout);
+                return mips_emulate(asm_name);
+            }
         } else {
             printf("A AST foi aceita, mas root_ast está NULL (Verifique se a regra 'Programa' em goianinha.y está atribuindo $$ e root_ast).\n");
         }
@@ -165,4 +386,342 @@ int main(int argc, char** argv) {
 
     fclose(yyin);
     return 0;
-}
\ No newline at end of file
+}
+
+/*
+    * Função: make_output_dir
+    * -------------------------------
+    * Cria o diretório de saída (-o) se ele ainda não existe.
+*/
+static int make_output_dir(const char* dir) {
+    if (mkdir(dir, 0777) == 0 || errno == EEXIST) return 1;
+    fprintf(stderr, "Erro ao criar o diretorio de saida '%s': %s\n", dir, strerror(errno));
+    return 0;
+}
+
+/*
+    * Função: output_base
+    * -------------------------------
+    * Nome das saídas de um fonte no diretório: dir/prog.g -> dir/prog.
+*/
+static void output_base(const char* dir, const char* source_file, char* out, size_t size) {
+    const char* name = strrchr(source_file, '/');
+    name = name ? name + 1 : source_file;
+    const char* dot = strrchr(name, '.');
+    int length = dot && dot != name ? (int)(dot - name) : (int)strlen(name);
+    snprintf(out, size, "%s/%.*s", dir, length, name);
+}
+
+/*
+    * Função: set_cache_options
+    * -------------------------------
+    * Passa ao cache as opções que mudam o código gerado, na ordem da linha de
+    * comando. Ficam de fora os fontes, -j, -o, --cache-*, --server,
+    * --time-report, --emulate e --profile-lines, que não mudam as saídas.
+*/
+static void set_cache_options(int argc, char** argv) {
+    size_t size = 1;
+    for (int i = 1; i < argc; i++) size += strlen(argv[i]) + 1;
+    char* options = (char*)calloc(size, 1);
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "-o") == 0) && i + 1 < argc) {
+            i++;
+            continue;
+        }
+        if (argv[i][0] != '-' || strncmp(argv[i], "-j", 2) == 0 || strncmp(argv[i], "--cache-", 8) == 0 ||
+            strncmp(argv[i], "--server", 8) == 0 || strncmp(argv[i], "--time-report", 13) == 0 ||
+            strcmp(argv[i], "--emulate") == 0 || strcmp(argv[i], "--profile-lines") == 0) {
+            continue;
+        }
+        strcat(options, argv[i]);
+        strcat(options, " ");
+    }
+    cache_set_options(options);
+    free(options);
+}
+
+static int compare_names(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/*
+    * Função: compile_batch
+    * -------------------------------
+    * Compila vários arquivos (-j N -o diretorio). Cada compilação roda em um
+    * processo filho criado com fork: o filho herda as opções já lidas e tem
+    * o seu próprio estado do analisador léxico, do parser, da tabela de
+    * símbolos e dos geradores, sem pagar de novo a carga do executável. Um
+    * erro no fonte encerra só o filho. As mensagens de cada compilação vão
+    * para diretorio/<nome>.log, que é apagado quando ela dá certo.
+    *
+    * O estado do compilador continua global (yyin, root_ast, global_symtab,
+    * as seções de codigo.c e ir_mips.c, os contadores das otimizações): as
+    * compilações não rodam em threads do mesmo processo. Para isso seria
+    * preciso um parser Bison puro, um analisador léxico reentrante e o
+    * estado de cada passo e gerador em uma estrutura por compilação; o fork
+    * isola esse estado sem mudar o resto do compilador.
+*/
+static int compile_batch(const char** sources, int nsources, const char* output_dir, int jobs) {
+    if (jobs <= 0) jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs <= 0) jobs = 1;
+    if (jobs > nsources) jobs = nsources;
+    if (!make_output_dir(output_dir)) return 1;
+
+    // Dois fontes com o mesmo nome escreveriam nos mesmos arquivos de saída
+    char** bases = (char**)malloc(sizeof(char*) * nsources);
+    for (int i = 0; i < nsources; i++) {
+        char base[PATH_MAX];
+        output_base(output_dir, sources[i], base, sizeof(base));
+        bases[i] = strdup(base);
+    }
+    char** sorted = (char**)malloc(sizeof(char*) * nsources);
+    memcpy(sorted, bases, sizeof(char*) * nsources);
+    qsort(sorted, nsources, sizeof(char*), compare_names);
+    for (int i = 1; i < nsources; i++) {
+        if (strcmp(sorted[i - 1], sorted[i]) == 0) {
+            fprintf(stderr, "Dois arquivos fonte gerariam a mesma saida: %s\n", sorted[i]);
+            for (int j = 0; j < nsources; j++) free(bases[j]);
+            free(bases);
+            free(sorted);
+            return 1;
+        }
+    }
+    free(sorted);
+
+    // Processos em andamento: pid e arquivo de cada vaga
+    pid_t* slot_pid = (pid_t*)calloc(jobs, sizeof(pid_t));
+    int* slot_file = (int*)calloc(jobs, sizeof(int));
+    int next = 0, running = 0, failed = 0;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    fflush(NULL);                               // O filho não pode herdar saída pendente
+
+    while (next < nsources || running > 0) {
+        while (running < jobs && next < nsources) {
+            pid_t pid = fork();
+            if (pid < 0) {
+                perror("Erro ao criar processo de compilacao");
+                if (running == 0) {
+                    failed += nsources - next;  // Sem processos para esperar: desiste do resto
+                    next = nsources;
+                }
+                break;
+            }
+            if (pid == 0) {
+                char log_name[PATH_MAX];
+                snprintf(log_name, sizeof(log_name), "%s.log", bases[next]);
+                int fd = open(log_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+                if (fd >= 0) {
+                    dup2(fd, STDOUT_FILENO);
+                    dup2(fd, STDERR_FILENO);
+                    close(fd);
+                }
+                exit(compile_file(sources[next], bases[next]));
+            }
+
+            int slot = 0;
+            while (slot_pid[slot] != 0) slot++;
+            slot_pid[slot] = pid;
+            slot_file[slot] = next++;
+            running++;
+        }
+        if (running == 0) break;
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            perror("Erro ao esperar processo de compilacao");
+            break;
+        }
+        for (int slot = 0; slot < jobs; slot++) {
+            if (slot_pid[slot] != pid) continue;
+            slot_pid[slot] = 0;
+            running--;
+
+            int file = slot_file[slot];
+            char log_name[PATH_MAX];
+            snprintf(log_name, sizeof(log_name), "%s.log", bases[file]);
+            if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+                unlink(log_name);
+            } else {
+                fprintf(stderr, "Falha ao compilar %s (mensagens em %s)\n", sources[file], log_name);
+                failed++;
+            }
+            break;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double ms = (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_nsec - start.tv_nsec) / 1e6;
+    printf("Compilados %d arquivos em %s com %d processos em %.1f ms: %d com sucesso, %d com erro\n",
+           nsources, output_dir, jobs, ms, nsources - failed, failed);
+
+    for (int i = 0; i < nsources; i++) free(bases[i]);
+    free(bases);
+    free(slot_pid);
+    free(slot_file);
+    return failed > 0;
+}
+
+int main(int argc, char** argv) {
+    const char** sources = (const char**)malloc(sizeof(const char*) * argc);
+    int nsources = 0;
+    const char* output_dir = NULL;
+    int jobs = 0;
+    const char* server_socket = NULL;
+    int cache_stats = 0;
+    int usage_error = 0;
+
+    // Lendo as opções de linha de comando
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-fno-peephole") == 0) {
+            peephole_enabled = 0;
+        } else if (strcmp(argv[i], "-fno-schedule") == 0) {
+            schedule_enabled = 0;
+        } else if (strncmp(argv[i], "-fsched-latency=", 16) == 0) {
+            if (!mips_set_latencies(argv[i] + 16)) {
+                fprintf(stderr, "Modelo de latencia invalido: %s\n", argv[i] + 16);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--delay-slots") == 0) {
+            delay_slots_enabled = 1;
+        } else if (strcmp(argv[i], "-fno-ir") == 0) {
+            use_ir = 0;
+        } else if (strcmp(argv[i], "-fno-inline") == 0) {
+            inline_enabled = 0;
+        } else if (strncmp(argv[i], "-finline-limit=", 15) == 0) {
+            inline_threshold = atoi(argv[i] + 15);
+        } else if (strcmp(argv[i], "-fno-tail-calls") == 0) {
+            tail_calls_enabled = 0;
+        } else if (strcmp(argv[i], "-fno-licm") == 0) {
+            licm_enabled = 0;
+        } else if (strcmp(argv[i], "-fno-cse") == 0) {
+            cse_enabled = 0;
+        } else if (strcmp(argv[i], "-fno-dce") == 0) {
+            dce_enabled = 0;
+        } else if (strcmp(argv[i], "--target=mips") == 0) {
+            target = TARGET_MIPS;
+        } else if (strcmp(argv[i], "--target=x86-64") == 0) {
+            target = TARGET_X86_64;
+        } else if (strcmp(argv[i], "--target=c") == 0) {
+            target = TARGET_C;
+        } else if (strcmp(argv[i], "--run") == 0) {
+            run_program = 1;
+        } else if (strcmp(argv[i], "--jit") == 0) {
+            jit_program = 1;
+        } else if (strcmp(argv[i], "--emulate") == 0) {
+            emulate_program = 1;
+        } else if (strcmp(argv[i], "--profile-lines") == 0) {
+            line_profile_enabled = 1;
+        } else if (strcmp(argv[i], "-fprofile-generate") == 0) {
+            profile_generate = 1;
+        } else if (strcmp(argv[i], "-fprofile-use") == 0) {
+            profile_use_file = "goianinha.perfil";
+        } else if (strncmp(argv[i], "-fprofile-use=", 14) == 0) {
+            profile_use_file = argv[i] + 14;
+        } else if (strcmp(argv[i], "--emit-ir") == 0) {
+            emit_ir = 1;
+        } else if (strcmp(argv[i], "--time-report") == 0) {
+            time_report_enabled = 1;
+        } else if (strncmp(argv[i], "--time-report=", 14) == 0) {
+            time_report_enabled = 1;
+            time_report_json = argv[i] + 14;
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            jobs = atoi(argv[++i]);
+        } else if (strncmp(argv[i], "-j", 2) == 0 && argv[i][2] != '\0') {
+            jobs = atoi(argv[i] + 2);
+        } else if (strcmp(argv[i], "--server") == 0) {
+            server_socket = SERVER_DEFAULT_SOCKET;
+        } else if (strncmp(argv[i], "--server=", 9) == 0) {
+            server_socket = argv[i] + 9;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output_dir = argv[++i];
+        } else if (strncmp(argv[i], "--cache-dir=", 12) == 0) {
+            cache_dir = argv[i] + 12;
+        } else if (strcmp(argv[i], "--cache-stats") == 0) {
+            cache_stats = 1;
+        } else if (argv[i][0] == '-') {
+            usage_error = 1;
+            break;
+        } else {
+            sources[nsources++] = argv[i];
+        }
+    }
+
+    // Sem --cache-dir, o diretório pode vir do ambiente (útil na CI)
+    if (cache_dir == NULL && getenv("GOIANINHA_CACHE") != NULL && getenv("GOIANINHA_CACHE")[0] != '\0') {
+        cache_dir = getenv("GOIANINHA_CACHE");
+    }
+
+    if (cache_stats) {
+        free(sources);
+        if (cache_dir == NULL) {
+            fprintf(stderr, "--cache-stats precisa de --cache-dir=diretorio ou da variavel GOIANINHA_CACHE.\n");
+            return 1;
+        }
+        return cache_print_stats();
+    }
+
+    if (usage_error || (nsources == 0 && server_socket == NULL)) {
+        fprintf(stderr, "Uso: %s [-fno-peephole] [-fno-schedule] [-fsched-latency=op:N,...] [--delay-slots] [-fno-ir] [-fno-inline] [-finline-limit=N] [-fno-tail-calls] [-fno-cse] [-fno-dce] [-fno-licm] [-fprofile-generate] [-fprofile-use[=arquivo]] [--emit-ir] [--target=mips|x86-64|c] [--run] [--jit] [--emulate] [--profile-lines] [--time-report[=arquivo.json]] [--cache-dir=diretorio] [--cache-stats] [-j N] [-o diretorio] <arquivo_fonte>...\n"
+                        "       %s [opcoes] --server[=socket]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    if (emulate_program && target != TARGET_MIPS) {
+        fprintf(stderr, "--emulate so pode ser usado com --target=mips.\n");
+        return 1;
+    }
+
+    if ((profile_generate || profile_use_file) && (!use_ir || target == TARGET_C)) {
+        fprintf(stderr, "-fprofile-generate e -fprofile-use dependem da IR: nao podem ser usados com -fno-ir nem com --target=c.\n");
+        return 1;
+    }
+
+    if (line_profile_enabled && !emulate_program && !profile_use_file) {
+        fprintf(stderr, "--profile-lines precisa de --emulate (contagens do emulador) ou de -fprofile-use (perfil coletado em qualquer simulador).\n");
+        return 1;
+    }
+
+    if (nsources > 1 && (run_program || jit_program || emulate_program)) {
+        fprintf(stderr, "--run, --jit e --emulate executam um programa so: passe apenas um arquivo fonte.\n");
+        return 1;
+    }
+
+    if (nsources > 1 && time_report_enabled) {
+        fprintf(stderr, "--time-report mede uma compilacao: passe apenas um arquivo fonte.\n");
+        return 1;
+    }
+
+    if (cache_dir != NULL) set_cache_options(argc, argv);
+
+    // Servidor: as opções lidas valem para todas as compilações recebidas
+    if (server_socket != NULL) {
+        if (nsources > 0 || run_program || jit_program || emulate_program) {
+            fprintf(stderr, "--server recebe os fontes pelo socket: nao passe arquivos nem --run, --jit ou --emulate.\n");
+            return 1;
+        }
+        free(sources);
+        const char* extension = target == TARGET_X86_64 ? ".s" : target == TARGET_C ? ".c" : ".asm";
+        return run_server(server_socket, extension, compile_file);
+    }
+
+    // Vários arquivos: um processo por compilação, até 'jobs' ao mesmo tempo
+    if (nsources > 1) {
+        int status = compile_batch(sources, nsources, output_dir ? output_dir : ".", jobs);
+        free(sources);
+        return status;
+    }
+
+    char base[PATH_MAX] = "output";
+    if (output_dir != NULL) {
+        if (!make_output_dir(output_dir)) return 1;
+        output_base(output_dir, sources[0], base, sizeof(base));
+    }
+    int status = compile_file(sources[0], base);
+    free(sources);
+    return status;
+}
+
@@ -0,0 +1,480 @@
+.data
+__globais:
+__newline: .asciiz "\n"
+L3: .asciiz "sim"
+L5: .asciiz "nao negado\n"
+.text
+
+.globl soma
+soma:
+
+  # Prologo: Salva $ra e $fp, e configura $fp
+  addi $sp, $sp, -4
+  sw $fp, 0($sp)
+  sw $ra, 4($sp)
+  move $fp, $sp
+  addi $sp, $sp, -12
+
+  # Salvando argumento 1 (a) de $a0 para -4($fp)
+  sw $a0, -4($fp)
+
+  # Salvando argumento 2 (b) de $a1 para -8($fp)
+  sw $a1, -8($fp)
+
+  # Bloco de comandos (Entrada)
+
+  # Expressao: Binaria +
+
+  # Expressao: Variavel ID (a)
+  lw $t1, -4($fp)
+
+  # Expressao: Variavel ID (b)
+  lw $t0, -8($fp)
+
+  # Comando: Retorne
+
+  # Epilogo: Restaura $fp e $ra
+  move $sp, $fp
+  lw $ra, 4($fp)
+  lw $fp, 0($sp)
+  add $v0, $t1, $t0
+  addi $sp, $sp, 4
+  jr $ra
+
+  # Bloco de comandos (Saida)
+
+.globl f
+f:
+
+  # Prologo: Salva $ra e $fp, e configura $fp
+  addi $sp, $sp, -4
+  sw $fp, 0($sp)
+  sw $ra, 4($sp)
+  move $fp, $sp
+
+  # Salvando argumento 1 (a) de $a0 para -4($fp)
+  sw $a0, -4($fp)
+
+  # Mapeando argumento 5 (k) em 8($fp)
+
+  # Mapeando argumento 6 (g) em 12($fp)
+
+  # Bloco de comandos (Entrada)
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria *
+
+  # Expressao: Variavel ID (a)
+  lw $t1, -4($fp)
+
+  # Expressao: Constante INT
+  li $t0, 100000
+  mult $t1, $t0
+  addi $sp, $sp, -20
+
+  # Salvando argumento 2 (b) de $a1 para -8($fp)
+  sw $a1, -8($fp)
+
+  # Salvando argumento 3 (c) de $a2 para -12($fp)
+  sw $a2, -12($fp)
+
+  # Salvando argumento 4 (d) de $a3 para -16($fp)
+  sw $a3, -16($fp)
+  mflo $t0
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Variavel ID (b)
+  lw $t1, -8($fp)
+
+  # Expressao: Constante INT
+  li $t0, 10000
+  mult $t1, $t0
+  addi $sp, $sp, -4
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+  mflo $t0
+  add $t0, $t1, $t0
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Variavel ID (c)
+  lw $t1, -12($fp)
+
+  # Expressao: Constante INT
+  li $t0, 1000
+  mult $t1, $t0
+  addi $sp, $sp, -4
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+  mflo $t0
+  add $t0, $t1, $t0
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Variavel ID (d)
+  lw $t1, -16($fp)
+
+  # Expressao: Constante INT
+  li $t0, 100
+  mult $t1, $t0
+  addi $sp, $sp, -4
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+  mflo $t0
+  add $t0, $t1, $t0
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Variavel ID (k)
+  lw $t1, 8($fp)
+
+  # Expressao: Constante INT
+  li $t0, 10
+  mult $t1, $t0
+  addi $sp, $sp, -4
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+
+  # Comando: Retorne
+
+  # Epilogo: Restaura $fp e $ra
+  move $sp, $fp
+  lw $ra, 4($fp)
+  mflo $t0
+  add $t0, $t1, $t0
+  move $t1, $t0
+
+  # Expressao: Variavel ID (g)
+  lw $t0, 12($fp)
+  lw $fp, 0($sp)
+  add $v0, $t1, $t0
+  addi $sp, $sp, 4
+  jr $ra
+
+  # Bloco de comandos (Saida)
+.globl main
+main:
+
+  # Prologo: Salva $ra e $fp, e configura $fp para main
+  addi $sp, $sp, -4
+  sw $ra, 4($sp)
+  sw $fp, 0($sp)
+  move $fp, $sp
+  addi $sp, $sp, -12
+  la $gp, __globais
+
+  # Bloco de comandos (Entrada)
+
+  # Declaracao de variavel: x
+
+  # Declaracao de variavel: y
+
+  # Expressao: Constante INT
+  li $t0, 3
+
+  # Comando: Atribuicao x = 
+  sw $t0, -4($fp)
+
+  # Expressao: Constante INT
+  li $t0, 4
+
+  # Comando: Atribuicao y = 
+  sw $t0, -8($fp)
+
+  # Comando: Escreva Valor (Int ou Char)
+
+  # Expressao: Chamada de Funcao f
+
+  # Expressao: Constante INT
+  li $a0, 1
+
+  # Expressao: Constante INT
+  li $a1, 2
+
+  # Expressao: Constante INT
+  li $a2, 3
+
+  # Expressao: Constante INT
+  li $a3, 4
+
+  # Expressao: Constante INT
+  li $t0, 5
+
+  # Argumento 5 vai para a pilha
+  sw $t0, 0($sp)
+  addi $sp, $sp, -4
+
+  # Expressao: Constante INT
+  li $t0, 6
+
+  # Argumento 6 vai para a pilha
+  sw $t0, 0($sp)
+  addi $sp, $sp, -4
+  jal f
+
+  # Limpa 8 bytes de argumentos da pilha
+  addi $sp, $sp, 8
+  move $t0, $v0
+  li $v0, 1
+  move $a0, $t0
+  syscall
+
+  # Comando: Novalinha
+  li $v0, 4
+  la $a0, __newline
+  syscall
+
+  # Comando: Escreva Valor (Int ou Char)
+
+  # Expressao: Chamada de Funcao soma
+
+  # Expressao: Chamada de Funcao soma
+
+  # Expressao: Variavel ID (x)
+  lw $a0, -4($fp)
+
+  # Expressao: Variavel ID (y)
+  lw $a1, -8($fp)
+  jal soma
+  move $a0, $v0
+
+  # Expressao: Chamada de Funcao soma
+
+  # Expressao: Variavel ID (y)
+  lw $a0, -8($fp)
+
+  # Expressao: Chamada de Funcao soma
+
+  # Expressao: Constante INT
+  li $a0, 1
+
+  # Expressao: Constante INT
+  li $a1, 2
+  jal soma
+  move $a1, $v0
+  jal soma
+  move $a1, $v0
+  jal soma
+  move $t0, $v0
+  li $v0, 1
+  move $a0, $t0
+  syscall
+
+  # Comando: Novalinha
+  li $v0, 4
+  la $a0, __newline
+  syscall
+
+  # Comando: SE
+
+  # Condicao: <=
+
+  # Expressao: Variavel ID (x)
+  lw $t1, -4($fp)
+
+  # Expressao: Constante INT
+  li $t0, 3
+  bgt $t1, $t0, L2
+
+  # Condicao: >=
+
+  # Expressao: Variavel ID (y)
+  lw $t1, -8($fp)
+
+  # Expressao: Constante INT
+  li $t0, 4
+  bge $t1, $t0, L1
+L2:
+
+  # Condicao: ==
+
+  # Expressao: Variavel ID (x)
+  lw $t1, -4($fp)
+
+  # Expressao: Constante INT
+  li $t0, 0
+  bne $t1, $t0, L0
+L1:
+
+  # Comando: Escreva String
+  li $v0, 4
+  la $a0, L3
+  syscall
+L0:
+
+  # Comando: Novalinha
+  li $v0, 4
+  la $a0, __newline
+  syscall
+
+  # Comando: SE
+
+  # Condicao: >
+
+  # Expressao: Variavel ID (x)
+  lw $t1, -4($fp)
+
+  # Expressao: Constante INT
+  li $t0, 3
+  bgt $t1, $t0, L4
+
+  # Condicao: <
+
+  # Expressao: Variavel ID (y)
+  lw $t1, -8($fp)
+
+  # Expressao: Constante INT
+  li $t0, 4
+  blt $t1, $t0, L4
+
+  # Bloco de comandos (Entrada)
+
+  # Comando: Escreva (2 escritas juntadas)
+  li $v0, 4
+  la $a0, L5
+  syscall
+
+  # Bloco de comandos (Saida)
+L4:
+
+  # Comando: Escreva Valor (Int ou Char)
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria +
+
+  # Expressao: Binaria <=
+
+  # Expressao: Variavel ID (x)
+  lw $t1, -4($fp)
+
+  # Expressao: Constante INT
+  li $t0, 2
+  slt $t0, $t0, $t1
+  xori $t0, $t0, 1
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Binaria >=
+
+  # Expressao: Variavel ID (y)
+  lw $t1, -8($fp)
+
+  # Expressao: Constante INT
+  li $t0, 4
+  slt $t0, $t1, $t0
+  xori $t1, $t0, 1
+
+  # Expressao: Constante INT
+  li $t0, 10
+  mult $t1, $t0
+  addi $sp, $sp, -4
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+  mflo $t0
+  add $t0, $t1, $t0
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Binaria E
+
+  # Condicao: <
+
+  # Expressao: Variavel ID (x)
+  lw $t1, -4($fp)
+
+  # Expressao: Variavel ID (y)
+  lw $t0, -8($fp)
+  addi $sp, $sp, -4
+  bge $t1, $t0, L6
+
+  # Condicao: >
+
+  # Expressao: Variavel ID (y)
+  lw $t0, -8($fp)
+  blez $t0, L6
+  li $t0, 1
+  j L7
+L6:
+  li $t0, 0
+L7:
+  move $t1, $t0
+
+  # Expressao: Constante INT
+  li $t0, 100
+  mult $t1, $t0
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+  mflo $t0
+  add $t0, $t1, $t0
+  sw $t0, 0($sp)
+
+  # Expressao: Binaria *
+
+  # Expressao: Binaria OU
+
+  # Condicao: >
+
+  # Expressao: Variavel ID (x)
+  lw $t1, -4($fp)
+
+  # Expressao: Variavel ID (y)
+  lw $t0, -8($fp)
+  addi $sp, $sp, -4
+  bgt $t1, $t0, L10
+
+  # Expressao: Constante INT
+  li $t0, 0
+  beq $t0, $zero, L8
+L10:
+  li $t0, 1
+  j L9
+L8:
+  li $t0, 0
+L9:
+  move $t1, $t0
+
+  # Expressao: Constante INT
+  li $t0, 1000
+  mult $t1, $t0
+  lw $t1, 4($sp)
+  addi $sp, $sp, 4
+  li $v0, 1
+  mflo $t0
+  add $t0, $t1, $t0
+  move $a0, $t0
+  syscall
+
+  # Comando: Novalinha
+  li $v0, 4
+  la $a0, __newline
+  syscall
+
+  # Bloco de comandos (Saida)
+
+  # Epilogo: Restaura $fp e $ra
+  lw $ra, 4($fp)
+  lw $fp, 0($fp)
+  addi $sp, $sp, 4
+
+  # Fim da execucao
+  li $v0, 10
+  syscall
@@ -0,0 +1,67 @@
+/* Gerado pelo compilador Goianinha (--target=c) */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static inline int32_t gn_add(int32_t a, int32_t b) { return (int32_t)((uint32_t)a + (uint32_t)b); }
+static inline int32_t gn_sub(int32_t a, int32_t b) { return (int32_t)((uint32_t)a - (uint32_t)b); }
+static inline int32_t gn_mul(int32_t a, int32_t b) { return (int32_t)((uint32_t)a * (uint32_t)b); }
+static inline int32_t gn_div(int32_t a, int32_t b) {
+    if (b == 0) {
+        fflush(stdout);
+        fputs("Erro de execucao: divisao por zero.\n", stderr);
+        exit(1);
+    }
+    return b == -1 ? (int32_t)(0u - (uint32_t)a) : a / b;
+}
+static inline int32_t gn_neg(int32_t a) { return (int32_t)(0u - (uint32_t)a); }
+static inline int32_t gn_leia(void) {
+    int valor = 0;
+    if (scanf("%d", &valor) != 1) valor = 0;
+    return valor;
+}
+
+static int32_t f_soma(int32_t v_a, int32_t v_b);
+static int32_t f_f(int32_t v_a, int32_t v_b, int32_t v_c, int32_t v_d, int32_t v_k, int32_t v_g);
+
+static int32_t f_soma(int32_t v_a, int32_t v_b) {
+    {
+        return gn_add(v_a, v_b);
+    }
+    return 0;
+}
+
+static int32_t f_f(int32_t v_a, int32_t v_b, int32_t v_c, int32_t v_d, int32_t v_k, int32_t v_g) {
+    {
+        return gn_add(gn_add(gn_add(gn_add(gn_add(gn_mul(v_a, 100000), gn_mul(v_b, 10000)), gn_mul(v_c, 1000)), gn_mul(v_d, 100)), gn_mul(v_k, 10)), v_g);
+    }
+    return 0;
+}
+
+int main(void) {
+    int32_t t_0;
+    int32_t t_1;
+    int32_t t_2;
+    int32_t t_3;
+    {
+        int32_t v_x = 0;
+        int32_t v_y = 0;
+        v_x = 3;
+        v_y = 4;
+        printf("%d", (int)f_f(1, 2, 3, 4, 5, 6));
+        putchar('\n');
+        printf("%d", (int)(t_0 = f_soma(v_x, v_y), t_1 = (t_2 = v_y, t_3 = f_soma(1, 2), f_soma(t_2, t_3)), f_soma(t_0, t_1)));
+        putchar('\n');
+        if ((((v_x <= 3) && (v_y >= 4)) || (v_x == 0))) {
+            fputs("sim", stdout);
+        }
+        putchar('\n');
+        if (((!(v_x > 3)) && (!(v_y < 4)))) {
+            fputs("nao negado", stdout);
+            putchar('\n');
+        }
+        printf("%d", (int)gn_add(gn_add(gn_add((v_x <= 2), gn_mul((v_y >= 4), 10)), gn_mul(((v_x < v_y) && (v_y > 0)), 100)), gn_mul(((v_x > v_y) || 0), 1000)));
+        putchar('\n');
+    }
+    return 0;
+}
@@ -0,0 +1,499 @@
+# Gerado pelo compilador Goianinha (x86-64, System V)
+  .text
+
+  .globl gn_f
+gn_f:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $224, %rsp
+  movl %edi, -8(%rbp)
+  movl %esi, -16(%rbp)
+  movl %edx, -24(%rbp)
+  movl %ecx, -32(%rbp)
+  movl %r8d, -40(%rbp)
+  movl %r9d, -48(%rbp)
+.Lf_bb0:
+  movl -8(%rbp), %eax
+  movl %eax, -56(%rbp)
+  movl $100000, -64(%rbp)
+  movl -56(%rbp), %eax
+  imull -64(%rbp), %eax
+  movl %eax, -72(%rbp)
+  movl -16(%rbp), %eax
+  movl %eax, -80(%rbp)
+  movl $10000, -88(%rbp)
+  movl -80(%rbp), %eax
+  imull -88(%rbp), %eax
+  movl %eax, -96(%rbp)
+  movl -72(%rbp), %eax
+  addl -96(%rbp), %eax
+  movl %eax, -104(%rbp)
+  movl -24(%rbp), %eax
+  movl %eax, -112(%rbp)
+  movl $1000, -120(%rbp)
+  movl -112(%rbp), %eax
+  imull -120(%rbp), %eax
+  movl %eax, -128(%rbp)
+  movl -104(%rbp), %eax
+  addl -128(%rbp), %eax
+  movl %eax, -136(%rbp)
+  movl -32(%rbp), %eax
+  movl %eax, -144(%rbp)
+  movl $100, -152(%rbp)
+  movl -144(%rbp), %eax
+  imull -152(%rbp), %eax
+  movl %eax, -160(%rbp)
+  movl -136(%rbp), %eax
+  addl -160(%rbp), %eax
+  movl %eax, -168(%rbp)
+  movl -40(%rbp), %eax
+  movl %eax, -176(%rbp)
+  movl $10, -184(%rbp)
+  movl -176(%rbp), %eax
+  imull -184(%rbp), %eax
+  movl %eax, -192(%rbp)
+  movl -168(%rbp), %eax
+  addl -192(%rbp), %eax
+  movl %eax, -200(%rbp)
+  movl -48(%rbp), %eax
+  movl %eax, -208(%rbp)
+  movl -200(%rbp), %eax
+  addl -208(%rbp), %eax
+  movl %eax, -216(%rbp)
+  movl -216(%rbp), %eax
+  leave
+  ret
+
+  .globl gn_main
+gn_main:
+  pushq %rbp
+  movq %rsp, %rbp
+  subq $736, %rsp
+  movl $0, -8(%rbp)
+  movl $0, -16(%rbp)
+  movl $0, -24(%rbp)
+  movl $0, -32(%rbp)
+  movl $0, -40(%rbp)
+  movl $0, -48(%rbp)
+  movl $0, -56(%rbp)
+  movl $0, -64(%rbp)
+  movl $0, -72(%rbp)
+  movl $0, -80(%rbp)
+  movl $0, -88(%rbp)
+  movl $0, -96(%rbp)
+  movl $0, -104(%rbp)
+  movl $0, -112(%rbp)
+  movl $0, -120(%rbp)
+  movl $0, -128(%rbp)
+.Lmain_bb0:
+  movl $3, -136(%rbp)
+  movl -136(%rbp), %eax
+  movl %eax, -8(%rbp)
+  movl $4, -144(%rbp)
+  movl -144(%rbp), %eax
+  movl %eax, -16(%rbp)
+  movl $1, -152(%rbp)
+  movl $2, -160(%rbp)
+  movl $5, -184(%rbp)
+  movl $6, -192(%rbp)
+  movl -152(%rbp), %edi
+  movl -160(%rbp), %esi
+  movl -136(%rbp), %edx
+  movl -144(%rbp), %ecx
+  movl -184(%rbp), %r8d
+  movl -192(%rbp), %r9d
+  call gn_f
+  movl %eax, -200(%rbp)
+  movl -200(%rbp), %edi
+  call __gn_write_int
+  movl $10, %edi
+  call __gn_putc
+  movl -8(%rbp), %eax
+  movl %eax, -208(%rbp)
+  movl -16(%rbp), %eax
+  movl %eax, -216(%rbp)
+  movl -208(%rbp), %eax
+  movl %eax, -40(%rbp)
+  movl -216(%rbp), %eax
+  movl %eax, -48(%rbp)
+  movl -40(%rbp), %eax
+  movl %eax, -648(%rbp)
+  movl -48(%rbp), %eax
+  movl %eax, -656(%rbp)
+  movl -648(%rbp), %eax
+  addl -656(%rbp), %eax
+  movl %eax, -664(%rbp)
+  movl -664(%rbp), %eax
+  movl %eax, -56(%rbp)
+  movl -56(%rbp), %eax
+  movl %eax, -224(%rbp)
+  movl -16(%rbp), %eax
+  movl %eax, -232(%rbp)
+  movl $1, -240(%rbp)
+  movl $2, -248(%rbp)
+  movl -240(%rbp), %eax
+  movl %eax, -64(%rbp)
+  movl -248(%rbp), %eax
+  movl %eax, -72(%rbp)
+  movl -64(%rbp), %eax
+  movl %eax, -672(%rbp)
+  movl -72(%rbp), %eax
+  movl %eax, -680(%rbp)
+  movl -672(%rbp), %eax
+  addl -680(%rbp), %eax
+  movl %eax, -688(%rbp)
+  movl -688(%rbp), %eax
+  movl %eax, -80(%rbp)
+  movl -80(%rbp), %eax
+  movl %eax, -256(%rbp)
+  movl -232(%rbp), %eax
+  movl %eax, -88(%rbp)
+  movl -256(%rbp), %eax
+  movl %eax, -96(%rbp)
+  movl -88(%rbp), %eax
+  movl %eax, -696(%rbp)
+  movl -96(%rbp), %eax
+  movl %eax, -704(%rbp)
+  movl -696(%rbp), %eax
+  addl -704(%rbp), %eax
+  movl %eax, -712(%rbp)
+  movl -712(%rbp), %eax
+  movl %eax, -104(%rbp)
+  movl -104(%rbp), %eax
+  movl %eax, -264(%rbp)
+  movl -224(%rbp), %eax
+  movl %eax, -112(%rbp)
+  movl -264(%rbp), %eax
+  movl %eax, -120(%rbp)
+  movl -112(%rbp), %eax
+  movl %eax, -720(%rbp)
+  movl -120(%rbp), %eax
+  movl %eax, -728(%rbp)
+  movl -720(%rbp), %eax
+  addl -728(%rbp), %eax
+  movl %eax, -736(%rbp)
+  movl -736(%rbp), %eax
+  movl %eax, -128(%rbp)
+  movl -128(%rbp), %eax
+  movl %eax, -272(%rbp)
+  movl -272(%rbp), %edi
+  call __gn_write_int
+  movl $10, %edi
+  call __gn_putc
+  movl -8(%rbp), %eax
+  movl %eax, -280(%rbp)
+  movl $3, -288(%rbp)
+  movl -280(%rbp), %eax
+  cmpl -288(%rbp), %eax
+  jg .Lmain_bb3
+.Lmain_bb4:
+  movl -16(%rbp), %eax
+  movl %eax, -304(%rbp)
+  movl $4, -312(%rbp)
+  movl -304(%rbp), %eax
+  cmpl -312(%rbp), %eax
+  jge .Lmain_bb1
+.Lmain_bb3:
+  movl -8(%rbp), %eax
+  movl %eax, -328(%rbp)
+  movl $0, -336(%rbp)
+  movl -328(%rbp), %eax
+  cmpl -336(%rbp), %eax
+  jne .Lmain_bb2
+.Lmain_bb1:
+  leaq .Lstr0(%rip), %rdi
+  call __gn_write_str
+.Lmain_bb2:
+  movl $10, %edi
+  call __gn_putc
+  movl -8(%rbp), %eax
+  movl %eax, -352(%rbp)
+  movl $3, -360(%rbp)
+  movl -352(%rbp), %eax
+  cmpl -360(%rbp), %eax
+  jg .Lmain_bb6
+.Lmain_bb7:
+  movl -16(%rbp), %eax
+  movl %eax, -376(%rbp)
+  movl $4, -384(%rbp)
+  movl -376(%rbp), %eax
+  cmpl -384(%rbp), %eax
+  jl .Lmain_bb6
+.Lmain_bb5:
+  leaq .Lstr1(%rip), %rdi
+  call __gn_write_str
+  movl $10, %edi
+  call __gn_putc
+.Lmain_bb6:
+  movl -8(%rbp), %eax
+  movl %eax, -400(%rbp)
+  movl $2, -408(%rbp)
+  movl -400(%rbp), %eax
+  cmpl -408(%rbp), %eax
+  setle %al
+  movzbl %al, %eax
+  movl %eax, -416(%rbp)
+  movl -16(%rbp), %eax
+  movl %eax, -424(%rbp)
+  movl $4, -432(%rbp)
+  movl -424(%rbp), %eax
+  cmpl -432(%rbp), %eax
+  setge %al
+  movzbl %al, %eax
+  movl %eax, -440(%rbp)
+  movl $10, -448(%rbp)
+  movl -440(%rbp), %eax
+  imull -448(%rbp), %eax
+  movl %eax, -456(%rbp)
+  movl -416(%rbp), %eax
+  addl -456(%rbp), %eax
+  movl %eax, -464(%rbp)
+  movl -400(%rbp), %eax
+  cmpl -424(%rbp), %eax
+  jge .Lmain_bb9
+.Lmain_bb11:
+  movl -16(%rbp), %eax
+  movl %eax, -496(%rbp)
+  movl $0, -504(%rbp)
+  movl -496(%rbp), %eax
+  cmpl -504(%rbp), %eax
+  jle .Lmain_bb9
+.Lmain_bb8:
+  movl $1, -520(%rbp)
+  movl -520(%rbp), %eax
+  movl %eax, -24(%rbp)
+  jmp .Lmain_bb10
+.Lmain_bb9:
+  movl $0, -528(%rbp)
+  movl -528(%rbp), %eax
+  movl %eax, -24(%rbp)
+.Lmain_bb10:
+  movl -24(%rbp), %eax
+  movl %eax, -536(%rbp)
+  movl $100, -544(%rbp)
+  movl -536(%rbp), %eax
+  imull -544(%rbp), %eax
+  movl %eax, -552(%rbp)
+  movl -464(%rbp), %eax
+  addl -552(%rbp), %eax
+  movl %eax, -560(%rbp)
+  movl -8(%rbp), %eax
+  movl %eax, -568(%rbp)
+  movl -16(%rbp), %eax
+  movl %eax, -576(%rbp)
+  movl -568(%rbp), %eax
+  cmpl -576(%rbp), %eax
+  jg .Lmain_bb12
+.Lmain_bb15:
+  movl $0, -608(%rbp)
+  movl -608(%rbp), %eax
+  movl %eax, -32(%rbp)
+  jmp .Lmain_bb14
+.Lmain_bb12:
+  movl $1, -600(%rbp)
+  movl -600(%rbp), %eax
+  movl %eax, -32(%rbp)
+.Lmain_bb14:
+  movl -32(%rbp), %eax
+  movl %eax, -616(%rbp)
+  movl $1000, -624(%rbp)
+  movl -616(%rbp), %eax
+  imull -624(%rbp), %eax
+  movl %eax, -632(%rbp)
+  movl -560(%rbp), %eax
+  addl -632(%rbp), %eax
+  movl %eax, -640(%rbp)
+  movl -640(%rbp), %edi
+  call __gn_write_int
+  movl $10, %edi
+  call __gn_putc
+  leave
+  ret
+
+# --- Runtime ---
+  .globl _start
+_start:
+  andq $-16, %rsp
+  call gn_main
+  call __gn_flush
+  movl $60, %eax
+  xorl %edi, %edi
+  syscall
+
+# Escreve o byte %dil no buffer de saída
+__gn_putc:
+  movq __gn_outlen(%rip), %rax
+  leaq __gn_outbuf(%rip), %rcx
+  movb %dil, (%rcx,%rax)
+  incq %rax
+  movq %rax, __gn_outlen(%rip)
+  cmpq $4096, %rax
+  jae __gn_flush
+  ret
+
+# Esvazia o buffer de saída (write no descritor 1)
+__gn_flush:
+  leaq __gn_outbuf(%rip), %rsi
+  movq __gn_outlen(%rip), %rdx
+1:
+  testq %rdx, %rdx
+  jle 2f
+  movl $1, %eax
+  movl $1, %edi
+  pushq %rsi
+  pushq %rdx
+  syscall
+  popq %rdx
+  popq %rsi
+  testq %rax, %rax
+  jle 2f
+  addq %rax, %rsi
+  subq %rax, %rdx
+  jmp 1b
+2:
+  movq $0, __gn_outlen(%rip)
+  ret
+
+# Escreve a cadeia terminada em zero apontada por %rdi
+__gn_write_str:
+  pushq %rbx
+  movq %rdi, %rbx
+1:
+  movzbl (%rbx), %edi
+  testl %edi, %edi
+  je 2f
+  call __gn_putc
+  incq %rbx
+  jmp 1b
+2:
+  popq %rbx
+  ret
+
+# Escreve o inteiro %edi em decimal
+__gn_write_int:
+  subq $40, %rsp
+  movslq %edi, %rax
+  movq %rax, %r9
+  leaq 31(%rsp), %rsi
+  movb $0, (%rsi)
+  testq %rax, %rax
+  jns 1f
+  negq %rax
+1:
+  movl $10, %r8d
+2:
+  xorl %edx, %edx
+  divq %r8
+  addb $48, %dl
+  decq %rsi
+  movb %dl, (%rsi)
+  testq %rax, %rax
+  jne 2b
+  testq %r9, %r9
+  jns 3f
+  decq %rsi
+  movb $45, (%rsi)
+3:
+  movq %rsi, %rdi
+  call __gn_write_str
+  addq $40, %rsp
+  ret
+
+# Lê um byte da entrada (read no descritor 0); -1 no fim da entrada
+__gn_getc:
+  movq __gn_inpos(%rip), %rax
+  cmpq __gn_inlen(%rip), %rax
+  jb 1f
+  xorl %eax, %eax
+  xorl %edi, %edi
+  leaq __gn_inbuf(%rip), %rsi
+  movl $4096, %edx
+  syscall
+  testq %rax, %rax
+  jle 2f
+  movq %rax, __gn_inlen(%rip)
+  xorl %eax, %eax
+1:
+  leaq __gn_inbuf(%rip), %rcx
+  movzbl (%rcx,%rax), %edx
+  incq %rax
+  movq %rax, __gn_inpos(%rip)
+  movl %edx, %eax
+  ret
+2:
+  movl $-1, %eax
+  ret
+
+# Lê um inteiro em decimal (como a syscall 5 do MIPS) e o devolve em %eax
+__gn_read_int:
+  pushq %rbx
+  pushq %r12
+  subq $8, %rsp
+  call __gn_flush
+1:
+  call __gn_getc
+  cmpl $-1, %eax
+  je 5f
+  cmpl $32, %eax
+  jle 1b
+  xorl %r12d, %r12d
+  cmpl $45, %eax
+  jne 2f
+  movl $1, %r12d
+  call __gn_getc
+2:
+  xorl %ebx, %ebx
+3:
+  subl $48, %eax
+  cmpl $9, %eax
+  ja 4f
+  imull $10, %ebx, %ebx
+  addl %eax, %ebx
+  call __gn_getc
+  jmp 3b
+4:
+  movl %ebx, %eax
+  testl %r12d, %r12d
+  je 6f
+  negl %eax
+  jmp 6f
+5:
+  xorl %eax, %eax
+6:
+  addq $8, %rsp
+  popq %r12
+  popq %rbx
+  ret
+
+# Divisão por zero: esvazia a saída, escreve o erro em stderr e termina com 1
+__gn_div_zero:
+  call __gn_flush
+  movl $1, %eax
+  movl $2, %edi
+  leaq __gn_div_msg(%rip), %rsi
+  movl $__gn_div_msg_len, %edx
+  syscall
+  movl $60, %eax
+  movl $1, %edi
+  syscall
+
+  .section .rodata
+__gn_div_msg: .ascii "Erro de execucao: divisao por zero.\n"
+  .set __gn_div_msg_len, . - __gn_div_msg
+
+  .bss
+  .align 16
+__gn_outbuf: .zero 4096
+__gn_inbuf: .zero 4096
+__gn_outlen: .zero 8
+__gn_inpos: .zero 8
+__gn_inlen: .zero 8
+
+  .bss
+  .align 4
+
+  .section .rodata
+.Lstr0: .asciz "sim"
+.Lstr1: .asciz "nao negado"
+
+  .section .note.GNU-stack,"",@progbits
@@ -0,0 +1,135 @@
+#!/bin/bash
+
+# Testes de regressão sem interação: roda cada programa de TESTES/Execucao em
+# cada modo de execução e compara a saída com a esperada; depois, testa a
+# libgoianinha (TESTES/Biblioteca), o servidor de compilação e o cache de
+# compilação (--cache-dir).
+# Uso: ./teste_execucao.sh   (depois do make)
+#   <nome>.g         programa
+#   <nome>.entrada   entrada padrão (opcional)
+#   <nome>.saida     saída padrão esperada
+#   <nome>.codigo    código de saída esperado (opcional; padrão 0)
+# Termina com código 1 se algum teste falhar.
+
+# Definindo o executável do compilador (caminho absoluto: os testes rodam em um diretório temporário)
+ROOT="$(pwd)"
+EXECUTABLE="$ROOT/goianinha"
+
+# Definindo o diretório dos testes
+TEST_DIR="$ROOT/TESTES/Execucao"
+
+# Modos de execução testados (--target=c compila o output.c com o gcc e roda o binário;
+# --target=x86-64 monta e liga o output.s com as + ld e roda o binário)
+MODES=("--run" "--jit" "--emulate" "--target=c" "--target=x86-64")
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+FAILED=0
+TOTAL=0
+
+# Registra o resultado de um teste
+report() {
+    TOTAL=$((TOTAL + 1))
+    if [ "$1" -eq 0 ]; then
+        echo "ok      $2"
+    else
+        echo "FALHOU  $2"
+        FAILED=$((FAILED + 1))
+    fi
+}
+
+for file in "$TEST_DIR"/*.g; do
+    name=$(basename "$file" .g)
+    input="$TEST_DIR/$name.entrada"
+    [ -f "$input" ] || input=/dev/null
+    expected_status=0
+    [ -f "$TEST_DIR/$name.codigo" ] && expected_status=$(cat "$TEST_DIR/$name.codigo")
+
+    for mode in "${MODES[@]}"; do
+        # As mensagens da compilação e do ambiente de execução vão para stderr
+        rm -f "$WORK/saida"
+        if [ "$mode" == "--target=c" ]; then
+            (cd "$WORK" && rm -f programa output.c && "$EXECUTABLE" "$mode" "$file" > mensagens 2>&1 &&
+                gcc -O2 -o programa output.c >> mensagens 2>&1 && ./programa < "$input" > saida 2>> mensagens)
+        elif [ "$mode" == "--target=x86-64" ]; then
+            (cd "$WORK" && rm -f programa programa.o output.s && "$EXECUTABLE" "$mode" "$file" > mensagens 2>&1 &&
+                as -o programa.o output.s >> mensagens 2>&1 && ld -o programa programa.o >> mensagens 2>&1 &&
+                ./programa < "$input" > saida 2>> mensagens)
+        else
+            (cd "$WORK" && "$EXECUTABLE" "$mode" "$file" < "$input" > saida 2> mensagens)
+        fi
+        status=$?
+        if [ "$status" -eq "$expected_status" ] && diff -q "$TEST_DIR/$name.saida" "$WORK/saida" > /dev/null; then
+            report 0 "$name ($mode)"
+        else
+            report 1 "$name ($mode): codigo $status (esperado $expected_status)"
+            diff "$TEST_DIR/$name.saida" "$WORK/saida" | head -20
+        fi
+    done
+done
+
+# Biblioteca: gn_compile em memória deve gerar o mesmo código do executável
+(cd "$WORK" && "$EXECUTABLE" "$TEST_DIR/recursao.g" > /dev/null 2>&1)
+if gcc -o "$WORK/teste_biblioteca" "$ROOT/TESTES/Biblioteca/teste_biblioteca.c" -I"$ROOT/Biblioteca" \
+       -L"$ROOT" -l:libgoianinha.a -lstdc++ -lpthread > "$WORK/mensagens" 2>&1; then
+    "$WORK/teste_biblioteca" "$TEST_DIR/recursao.g" "$WORK/output.asm" "$TEST_DIR/../Errados/erroLin6AsteriscoAmais.g"
+    report $? "biblioteca (gn_compile)"
+else
+    cat "$WORK/mensagens"
+    report 1 "biblioteca (gn_compile): teste nao compilou"
+fi
+
+# Servidor: compilação pelo cliente, resposta do cache do servidor e erro no fonte
+SOCKET="$WORK/servidor.sock"
+"$EXECUTABLE" --server="$SOCKET" > "$WORK/servidor.log" 2>&1 &
+SERVER_PID=$!
+for _ in $(seq 50); do
+    [ -S "$SOCKET" ] && break
+    sleep 0.1
+done
+CLIENT="$ROOT/goianinha-cliente"
+"$CLIENT" -s "$SOCKET" -o "$WORK/servidor.asm" "$TEST_DIR/recursao.g" > "$WORK/mensagens" 2>&1 &&
+    cmp -s "$WORK/servidor.asm" "$WORK/output.asm"
+report $? "servidor: codigo igual ao do executavel"
+grep -q "$TEST_DIR/recursao.asm" "$WORK/mensagens" && ! grep -q "goianinha-servidor-" "$WORK/mensagens"
+report $? "servidor: mensagens com o nome do arquivo do cliente"
+"$CLIENT" -s "$SOCKET" -o "$WORK/servidor.asm" "$TEST_DIR/recursao.g" > /dev/null 2>&1 &&
+    "$CLIENT" -s "$SOCKET" --estado | grep -q "1 respondidas pelo cache"
+report $? "servidor: mesmo texto respondido pelo cache"
+WRONG="$ROOT/TESTES/Errados/erroLin6AsteriscoAmais.g"
+"$CLIENT" -s "$SOCKET" -o "$WORK/servidor.asm" "$WRONG" > "$WORK/mensagens" 2>&1
+[ $? -ne 0 ] && grep -q "linha 6" "$WORK/mensagens"
+report $? "servidor: erro no fonte"
+timeout 5 "$EXECUTABLE" --server="$SOCKET" > /dev/null 2>&1
+[ $? -eq 1 ] && "$CLIENT" -s "$SOCKET" --estado > /dev/null 2>&1
+report $? "servidor: segundo --server no mesmo socket recusado"
+"$CLIENT" -s "$SOCKET" --parar > /dev/null 2>&1
+wait "$SERVER_PID"
+report $? "servidor: encerrado por --parar"
+
+# Cache de compilação: falha, acerto com o mesmo código, e falhas quando o fonte ou as opções mudam
+CACHE="$WORK/cache"
+mkdir -p "$WORK/cache_saida"
+cached() { (cd "$WORK/cache_saida" && "$EXECUTABLE" --cache-dir="$CACHE" "$@" > mensagens 2>&1); }
+cached "$TEST_DIR/recursao.g" && ! grep -q "obtido do cache" "$WORK/cache_saida/mensagens" &&
+    cmp -s "$WORK/cache_saida/output.asm" "$WORK/output.asm"
+report $? "cache: primeira compilacao e uma falha"
+rm -f "$WORK/cache_saida/output.asm"
+cached "$TEST_DIR/recursao.g" && grep -q "obtido do cache" "$WORK/cache_saida/mensagens" &&
+    cmp -s "$WORK/cache_saida/output.asm" "$WORK/output.asm"
+report $? "cache: acerto com o mesmo codigo"
+{ cat "$TEST_DIR/recursao.g"; echo "/* mudou */"; } > "$WORK/mudou.g"
+cached "$WORK/mudou.g" && ! grep -q "obtido do cache" "$WORK/cache_saida/mensagens"
+report $? "cache: fonte diferente e uma falha"
+cached -fno-inline "$TEST_DIR/recursao.g" && ! grep -q "obtido do cache" "$WORK/cache_saida/mensagens"
+report $? "cache: opcoes diferentes sao uma falha"
+"$EXECUTABLE" --cache-dir="$CACHE" --cache-stats | grep -q "Acertos: 1, falhas: 3"
+report $? "cache: estatisticas"
+for entry in "$CACHE"/*.gcache; do sed -i 's|^arquivo .linhas |arquivo .x |' "$entry"; done
+cached "$TEST_DIR/recursao.g" && ! grep -q "obtido do cache" "$WORK/cache_saida/mensagens" &&
+    [ ! -e "$WORK/cache_saida/output.x" ]
+report $? "cache: entrada com extensao desconhecida e rejeitada"
+
+echo -e "\n$((TOTAL - FAILED)) de $TOTAL testes passaram."
+[ "$FAILED" -eq 0 ]